@@ -0,0 +1,259 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/sptk.dir/DependInfo.cmake"
+  "CMakeFiles/acorr.dir/DependInfo.cmake"
+  "CMakeFiles/acr2csm.dir/DependInfo.cmake"
+  "CMakeFiles/aeq.dir/DependInfo.cmake"
+  "CMakeFiles/amgcep.dir/DependInfo.cmake"
+  "CMakeFiles/average.dir/DependInfo.cmake"
+  "CMakeFiles/b2mc.dir/DependInfo.cmake"
+  "CMakeFiles/bcp.dir/DependInfo.cmake"
+  "CMakeFiles/bcut.dir/DependInfo.cmake"
+  "CMakeFiles/c2acr.dir/DependInfo.cmake"
+  "CMakeFiles/c2mpir.dir/DependInfo.cmake"
+  "CMakeFiles/c2ndps.dir/DependInfo.cmake"
+  "CMakeFiles/cdist.dir/DependInfo.cmake"
+  "CMakeFiles/clip.dir/DependInfo.cmake"
+  "CMakeFiles/csm2acr.dir/DependInfo.cmake"
+  "CMakeFiles/dct.dir/DependInfo.cmake"
+  "CMakeFiles/decimate.dir/DependInfo.cmake"
+  "CMakeFiles/delay.dir/DependInfo.cmake"
+  "CMakeFiles/delta.dir/DependInfo.cmake"
+  "CMakeFiles/dequantize.dir/DependInfo.cmake"
+  "CMakeFiles/df2.dir/DependInfo.cmake"
+  "CMakeFiles/dfs.dir/DependInfo.cmake"
+  "CMakeFiles/dmp.dir/DependInfo.cmake"
+  "CMakeFiles/drc.dir/DependInfo.cmake"
+  "CMakeFiles/dtw.dir/DependInfo.cmake"
+  "CMakeFiles/dtw_merge.dir/DependInfo.cmake"
+  "CMakeFiles/entropy.dir/DependInfo.cmake"
+  "CMakeFiles/excite.dir/DependInfo.cmake"
+  "CMakeFiles/extract.dir/DependInfo.cmake"
+  "CMakeFiles/fbank.dir/DependInfo.cmake"
+  "CMakeFiles/fd.dir/DependInfo.cmake"
+  "CMakeFiles/fft.dir/DependInfo.cmake"
+  "CMakeFiles/fft2.dir/DependInfo.cmake"
+  "CMakeFiles/fftcep.dir/DependInfo.cmake"
+  "CMakeFiles/fftr.dir/DependInfo.cmake"
+  "CMakeFiles/fftr2.dir/DependInfo.cmake"
+  "CMakeFiles/frame.dir/DependInfo.cmake"
+  "CMakeFiles/freqt.dir/DependInfo.cmake"
+  "CMakeFiles/gmm.dir/DependInfo.cmake"
+  "CMakeFiles/gmmp.dir/DependInfo.cmake"
+  "CMakeFiles/gnorm.dir/DependInfo.cmake"
+  "CMakeFiles/grpdelay.dir/DependInfo.cmake"
+  "CMakeFiles/histogram.dir/DependInfo.cmake"
+  "CMakeFiles/huffman.dir/DependInfo.cmake"
+  "CMakeFiles/huffman_decode.dir/DependInfo.cmake"
+  "CMakeFiles/huffman_encode.dir/DependInfo.cmake"
+  "CMakeFiles/idct.dir/DependInfo.cmake"
+  "CMakeFiles/ifft.dir/DependInfo.cmake"
+  "CMakeFiles/ifft2.dir/DependInfo.cmake"
+  "CMakeFiles/ignorm.dir/DependInfo.cmake"
+  "CMakeFiles/imglsadf.dir/DependInfo.cmake"
+  "CMakeFiles/impulse.dir/DependInfo.cmake"
+  "CMakeFiles/imsvq.dir/DependInfo.cmake"
+  "CMakeFiles/interpolate.dir/DependInfo.cmake"
+  "CMakeFiles/ipqmf.dir/DependInfo.cmake"
+  "CMakeFiles/iulaw.dir/DependInfo.cmake"
+  "CMakeFiles/lar2par.dir/DependInfo.cmake"
+  "CMakeFiles/lbg.dir/DependInfo.cmake"
+  "CMakeFiles/levdur.dir/DependInfo.cmake"
+  "CMakeFiles/linear_intpl.dir/DependInfo.cmake"
+  "CMakeFiles/lpc.dir/DependInfo.cmake"
+  "CMakeFiles/lpc2c.dir/DependInfo.cmake"
+  "CMakeFiles/lpc2lsp.dir/DependInfo.cmake"
+  "CMakeFiles/lpc2par.dir/DependInfo.cmake"
+  "CMakeFiles/lpccheck.dir/DependInfo.cmake"
+  "CMakeFiles/lsp2lpc.dir/DependInfo.cmake"
+  "CMakeFiles/lspcheck.dir/DependInfo.cmake"
+  "CMakeFiles/lspdf.dir/DependInfo.cmake"
+  "CMakeFiles/ltcdf.dir/DependInfo.cmake"
+  "CMakeFiles/magic_intpl.dir/DependInfo.cmake"
+  "CMakeFiles/mc2b.dir/DependInfo.cmake"
+  "CMakeFiles/mcpf.dir/DependInfo.cmake"
+  "CMakeFiles/medfilt.dir/DependInfo.cmake"
+  "CMakeFiles/median.dir/DependInfo.cmake"
+  "CMakeFiles/merge.dir/DependInfo.cmake"
+  "CMakeFiles/mfcc.dir/DependInfo.cmake"
+  "CMakeFiles/mgc2mgc.dir/DependInfo.cmake"
+  "CMakeFiles/mgc2sp.dir/DependInfo.cmake"
+  "CMakeFiles/mgcep.dir/DependInfo.cmake"
+  "CMakeFiles/mglsadf.dir/DependInfo.cmake"
+  "CMakeFiles/mglsp2sp.dir/DependInfo.cmake"
+  "CMakeFiles/minmax.dir/DependInfo.cmake"
+  "CMakeFiles/mlpg.dir/DependInfo.cmake"
+  "CMakeFiles/mlsacheck.dir/DependInfo.cmake"
+  "CMakeFiles/mpir2c.dir/DependInfo.cmake"
+  "CMakeFiles/mseq.dir/DependInfo.cmake"
+  "CMakeFiles/msvq.dir/DependInfo.cmake"
+  "CMakeFiles/nan.dir/DependInfo.cmake"
+  "CMakeFiles/ndps2c.dir/DependInfo.cmake"
+  "CMakeFiles/norm0.dir/DependInfo.cmake"
+  "CMakeFiles/nrand.dir/DependInfo.cmake"
+  "CMakeFiles/par2lar.dir/DependInfo.cmake"
+  "CMakeFiles/par2lpc.dir/DependInfo.cmake"
+  "CMakeFiles/pca.dir/DependInfo.cmake"
+  "CMakeFiles/pcas.dir/DependInfo.cmake"
+  "CMakeFiles/phase.dir/DependInfo.cmake"
+  "CMakeFiles/pitch.dir/DependInfo.cmake"
+  "CMakeFiles/pitch_mark.dir/DependInfo.cmake"
+  "CMakeFiles/poledf.dir/DependInfo.cmake"
+  "CMakeFiles/pqmf.dir/DependInfo.cmake"
+  "CMakeFiles/quantize.dir/DependInfo.cmake"
+  "CMakeFiles/ramp.dir/DependInfo.cmake"
+  "CMakeFiles/reverse.dir/DependInfo.cmake"
+  "CMakeFiles/rlevdur.dir/DependInfo.cmake"
+  "CMakeFiles/rmse.dir/DependInfo.cmake"
+  "CMakeFiles/root_pol.dir/DependInfo.cmake"
+  "CMakeFiles/sin.dir/DependInfo.cmake"
+  "CMakeFiles/smcep.dir/DependInfo.cmake"
+  "CMakeFiles/snr.dir/DependInfo.cmake"
+  "CMakeFiles/sopr.dir/DependInfo.cmake"
+  "CMakeFiles/spec.dir/DependInfo.cmake"
+  "CMakeFiles/step.dir/DependInfo.cmake"
+  "CMakeFiles/swab.dir/DependInfo.cmake"
+  "CMakeFiles/symmetrize.dir/DependInfo.cmake"
+  "CMakeFiles/train.dir/DependInfo.cmake"
+  "CMakeFiles/transpose.dir/DependInfo.cmake"
+  "CMakeFiles/ulaw.dir/DependInfo.cmake"
+  "CMakeFiles/vc.dir/DependInfo.cmake"
+  "CMakeFiles/vopr.dir/DependInfo.cmake"
+  "CMakeFiles/vstat.dir/DependInfo.cmake"
+  "CMakeFiles/vsum.dir/DependInfo.cmake"
+  "CMakeFiles/wav2mgc.dir/DependInfo.cmake"
+  "CMakeFiles/window.dir/DependInfo.cmake"
+  "CMakeFiles/x2x.dir/DependInfo.cmake"
+  "CMakeFiles/zcross.dir/DependInfo.cmake"
+  "CMakeFiles/zerodf.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/acorr.dir/src/main/acorr.cc.o"
+  "CMakeFiles/acorr.dir/src/main/acorr.cc.o.d"
+  "acorr"
+  "acorr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/acorr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
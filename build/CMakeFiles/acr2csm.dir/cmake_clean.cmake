@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/acr2csm.dir/src/main/acr2csm.cc.o"
+  "CMakeFiles/acr2csm.dir/src/main/acr2csm.cc.o.d"
+  "acr2csm"
+  "acr2csm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/acr2csm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
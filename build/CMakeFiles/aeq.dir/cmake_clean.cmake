@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aeq.dir/src/main/aeq.cc.o"
+  "CMakeFiles/aeq.dir/src/main/aeq.cc.o.d"
+  "aeq"
+  "aeq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aeq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
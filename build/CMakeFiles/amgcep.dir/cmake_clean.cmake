@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/amgcep.dir/src/main/amgcep.cc.o"
+  "CMakeFiles/amgcep.dir/src/main/amgcep.cc.o.d"
+  "amgcep"
+  "amgcep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/amgcep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
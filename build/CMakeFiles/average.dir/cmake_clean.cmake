@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/average.dir/src/main/average.cc.o"
+  "CMakeFiles/average.dir/src/main/average.cc.o.d"
+  "average"
+  "average.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/average.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
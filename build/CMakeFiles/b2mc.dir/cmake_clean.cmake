@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/b2mc.dir/src/main/b2mc.cc.o"
+  "CMakeFiles/b2mc.dir/src/main/b2mc.cc.o.d"
+  "b2mc"
+  "b2mc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/b2mc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bcp.dir/src/main/bcp.cc.o"
+  "CMakeFiles/bcp.dir/src/main/bcp.cc.o.d"
+  "bcp"
+  "bcp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bcut.dir/src/main/bcut.cc.o"
+  "CMakeFiles/bcut.dir/src/main/bcut.cc.o.d"
+  "bcut"
+  "bcut.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bcut.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
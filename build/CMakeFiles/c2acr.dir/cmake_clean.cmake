@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c2acr.dir/src/main/c2acr.cc.o"
+  "CMakeFiles/c2acr.dir/src/main/c2acr.cc.o.d"
+  "c2acr"
+  "c2acr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c2acr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
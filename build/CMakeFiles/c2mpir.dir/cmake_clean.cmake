@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c2mpir.dir/src/main/c2mpir.cc.o"
+  "CMakeFiles/c2mpir.dir/src/main/c2mpir.cc.o.d"
+  "c2mpir"
+  "c2mpir.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c2mpir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
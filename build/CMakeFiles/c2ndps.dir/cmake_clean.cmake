@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c2ndps.dir/src/main/c2ndps.cc.o"
+  "CMakeFiles/c2ndps.dir/src/main/c2ndps.cc.o.d"
+  "c2ndps"
+  "c2ndps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c2ndps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
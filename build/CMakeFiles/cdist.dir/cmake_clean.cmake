@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdist.dir/src/main/cdist.cc.o"
+  "CMakeFiles/cdist.dir/src/main/cdist.cc.o.d"
+  "cdist"
+  "cdist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clip.dir/src/main/clip.cc.o"
+  "CMakeFiles/clip.dir/src/main/clip.cc.o.d"
+  "clip"
+  "clip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/csm2acr.dir/src/main/csm2acr.cc.o"
+  "CMakeFiles/csm2acr.dir/src/main/csm2acr.cc.o.d"
+  "csm2acr"
+  "csm2acr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csm2acr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dct.dir/src/main/dct.cc.o"
+  "CMakeFiles/dct.dir/src/main/dct.cc.o.d"
+  "dct"
+  "dct.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
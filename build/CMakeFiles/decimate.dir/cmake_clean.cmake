@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/decimate.dir/src/main/decimate.cc.o"
+  "CMakeFiles/decimate.dir/src/main/decimate.cc.o.d"
+  "decimate"
+  "decimate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/decimate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
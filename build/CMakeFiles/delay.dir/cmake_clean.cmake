@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/delay.dir/src/main/delay.cc.o"
+  "CMakeFiles/delay.dir/src/main/delay.cc.o.d"
+  "delay"
+  "delay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/delta.dir/src/main/delta.cc.o"
+  "CMakeFiles/delta.dir/src/main/delta.cc.o.d"
+  "delta"
+  "delta.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
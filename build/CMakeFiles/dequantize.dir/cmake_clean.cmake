@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dequantize.dir/src/main/dequantize.cc.o"
+  "CMakeFiles/dequantize.dir/src/main/dequantize.cc.o.d"
+  "dequantize"
+  "dequantize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dequantize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/df2.dir/src/main/df2.cc.o"
+  "CMakeFiles/df2.dir/src/main/df2.cc.o.d"
+  "df2"
+  "df2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/df2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dfs.dir/src/main/dfs.cc.o"
+  "CMakeFiles/dfs.dir/src/main/dfs.cc.o.d"
+  "dfs"
+  "dfs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dmp.dir/src/main/dmp.cc.o"
+  "CMakeFiles/dmp.dir/src/main/dmp.cc.o.d"
+  "dmp"
+  "dmp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/drc.dir/src/main/drc.cc.o"
+  "CMakeFiles/drc.dir/src/main/drc.cc.o.d"
+  "drc"
+  "drc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/drc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
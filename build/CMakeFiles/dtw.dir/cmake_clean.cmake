@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtw.dir/src/main/dtw.cc.o"
+  "CMakeFiles/dtw.dir/src/main/dtw.cc.o.d"
+  "dtw"
+  "dtw.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dtw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtw_merge.dir/src/main/dtw_merge.cc.o"
+  "CMakeFiles/dtw_merge.dir/src/main/dtw_merge.cc.o.d"
+  "dtw_merge"
+  "dtw_merge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dtw_merge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
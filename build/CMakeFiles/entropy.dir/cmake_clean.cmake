@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/entropy.dir/src/main/entropy.cc.o"
+  "CMakeFiles/entropy.dir/src/main/entropy.cc.o.d"
+  "entropy"
+  "entropy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/entropy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
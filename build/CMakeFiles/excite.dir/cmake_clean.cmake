@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/excite.dir/src/main/excite.cc.o"
+  "CMakeFiles/excite.dir/src/main/excite.cc.o.d"
+  "excite"
+  "excite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/excite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
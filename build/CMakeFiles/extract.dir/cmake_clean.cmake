@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extract.dir/src/main/extract.cc.o"
+  "CMakeFiles/extract.dir/src/main/extract.cc.o.d"
+  "extract"
+  "extract.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/extract.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fbank.dir/src/main/fbank.cc.o"
+  "CMakeFiles/fbank.dir/src/main/fbank.cc.o.d"
+  "fbank"
+  "fbank.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fbank.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fd.dir/src/main/fd.cc.o"
+  "CMakeFiles/fd.dir/src/main/fd.cc.o.d"
+  "fd"
+  "fd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fft.dir/src/main/fft.cc.o"
+  "CMakeFiles/fft.dir/src/main/fft.cc.o.d"
+  "fft"
+  "fft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fft2.dir/src/main/fft2.cc.o"
+  "CMakeFiles/fft2.dir/src/main/fft2.cc.o.d"
+  "fft2"
+  "fft2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fft2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fftcep.dir/src/main/fftcep.cc.o"
+  "CMakeFiles/fftcep.dir/src/main/fftcep.cc.o.d"
+  "fftcep"
+  "fftcep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fftcep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fftr.dir/src/main/fftr.cc.o"
+  "CMakeFiles/fftr.dir/src/main/fftr.cc.o.d"
+  "fftr"
+  "fftr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fftr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fftr2.dir/src/main/fftr2.cc.o"
+  "CMakeFiles/fftr2.dir/src/main/fftr2.cc.o.d"
+  "fftr2"
+  "fftr2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fftr2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frame.dir/src/main/frame.cc.o"
+  "CMakeFiles/frame.dir/src/main/frame.cc.o.d"
+  "frame"
+  "frame.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frame.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/freqt.dir/src/main/freqt.cc.o"
+  "CMakeFiles/freqt.dir/src/main/freqt.cc.o.d"
+  "freqt"
+  "freqt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/freqt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
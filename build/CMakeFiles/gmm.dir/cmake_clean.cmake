@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmm.dir/src/main/gmm.cc.o"
+  "CMakeFiles/gmm.dir/src/main/gmm.cc.o.d"
+  "gmm"
+  "gmm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmmp.dir/src/main/gmmp.cc.o"
+  "CMakeFiles/gmmp.dir/src/main/gmmp.cc.o.d"
+  "gmmp"
+  "gmmp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gnorm.dir/src/main/gnorm.cc.o"
+  "CMakeFiles/gnorm.dir/src/main/gnorm.cc.o.d"
+  "gnorm"
+  "gnorm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gnorm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/grpdelay.dir/src/main/grpdelay.cc.o"
+  "CMakeFiles/grpdelay.dir/src/main/grpdelay.cc.o.d"
+  "grpdelay"
+  "grpdelay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/grpdelay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
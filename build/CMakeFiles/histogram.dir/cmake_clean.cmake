@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/histogram.dir/src/main/histogram.cc.o"
+  "CMakeFiles/histogram.dir/src/main/histogram.cc.o.d"
+  "histogram"
+  "histogram.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/histogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/huffman.dir/src/main/huffman.cc.o"
+  "CMakeFiles/huffman.dir/src/main/huffman.cc.o.d"
+  "huffman"
+  "huffman.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/huffman.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/huffman_decode.dir/src/main/huffman_decode.cc.o"
+  "CMakeFiles/huffman_decode.dir/src/main/huffman_decode.cc.o.d"
+  "huffman_decode"
+  "huffman_decode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/huffman_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/huffman_encode.dir/src/main/huffman_encode.cc.o"
+  "CMakeFiles/huffman_encode.dir/src/main/huffman_encode.cc.o.d"
+  "huffman_encode"
+  "huffman_encode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/huffman_encode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/idct.dir/src/main/idct.cc.o"
+  "CMakeFiles/idct.dir/src/main/idct.cc.o.d"
+  "idct"
+  "idct.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/idct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
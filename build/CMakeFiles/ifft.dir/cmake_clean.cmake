@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ifft.dir/src/main/ifft.cc.o"
+  "CMakeFiles/ifft.dir/src/main/ifft.cc.o.d"
+  "ifft"
+  "ifft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ifft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
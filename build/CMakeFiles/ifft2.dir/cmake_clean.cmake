@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ifft2.dir/src/main/ifft2.cc.o"
+  "CMakeFiles/ifft2.dir/src/main/ifft2.cc.o.d"
+  "ifft2"
+  "ifft2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ifft2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ignorm.dir/src/main/ignorm.cc.o"
+  "CMakeFiles/ignorm.dir/src/main/ignorm.cc.o.d"
+  "ignorm"
+  "ignorm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ignorm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
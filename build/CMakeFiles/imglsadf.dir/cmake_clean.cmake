@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imglsadf.dir/src/main/imglsadf.cc.o"
+  "CMakeFiles/imglsadf.dir/src/main/imglsadf.cc.o.d"
+  "imglsadf"
+  "imglsadf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imglsadf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/impulse.dir/src/main/impulse.cc.o"
+  "CMakeFiles/impulse.dir/src/main/impulse.cc.o.d"
+  "impulse"
+  "impulse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/impulse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imsvq.dir/src/main/imsvq.cc.o"
+  "CMakeFiles/imsvq.dir/src/main/imsvq.cc.o.d"
+  "imsvq"
+  "imsvq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imsvq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
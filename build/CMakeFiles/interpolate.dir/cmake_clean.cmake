@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/interpolate.dir/src/main/interpolate.cc.o"
+  "CMakeFiles/interpolate.dir/src/main/interpolate.cc.o.d"
+  "interpolate"
+  "interpolate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interpolate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ipqmf.dir/src/main/ipqmf.cc.o"
+  "CMakeFiles/ipqmf.dir/src/main/ipqmf.cc.o.d"
+  "ipqmf"
+  "ipqmf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ipqmf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
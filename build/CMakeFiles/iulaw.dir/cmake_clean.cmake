@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iulaw.dir/src/main/iulaw.cc.o"
+  "CMakeFiles/iulaw.dir/src/main/iulaw.cc.o.d"
+  "iulaw"
+  "iulaw.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iulaw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lar2par.dir/src/main/lar2par.cc.o"
+  "CMakeFiles/lar2par.dir/src/main/lar2par.cc.o.d"
+  "lar2par"
+  "lar2par.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lar2par.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lbg.dir/src/main/lbg.cc.o"
+  "CMakeFiles/lbg.dir/src/main/lbg.cc.o.d"
+  "lbg"
+  "lbg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lbg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/levdur.dir/src/main/levdur.cc.o"
+  "CMakeFiles/levdur.dir/src/main/levdur.cc.o.d"
+  "levdur"
+  "levdur.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levdur.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
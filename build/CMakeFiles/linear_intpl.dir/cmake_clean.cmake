@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linear_intpl.dir/src/main/linear_intpl.cc.o"
+  "CMakeFiles/linear_intpl.dir/src/main/linear_intpl.cc.o.d"
+  "linear_intpl"
+  "linear_intpl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linear_intpl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lpc.dir/src/main/lpc.cc.o"
+  "CMakeFiles/lpc.dir/src/main/lpc.cc.o.d"
+  "lpc"
+  "lpc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lpc2c.dir/src/main/lpc2c.cc.o"
+  "CMakeFiles/lpc2c.dir/src/main/lpc2c.cc.o.d"
+  "lpc2c"
+  "lpc2c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpc2c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
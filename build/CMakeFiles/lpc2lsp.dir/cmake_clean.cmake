@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lpc2lsp.dir/src/main/lpc2lsp.cc.o"
+  "CMakeFiles/lpc2lsp.dir/src/main/lpc2lsp.cc.o.d"
+  "lpc2lsp"
+  "lpc2lsp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpc2lsp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lpc2par.dir/src/main/lpc2par.cc.o"
+  "CMakeFiles/lpc2par.dir/src/main/lpc2par.cc.o.d"
+  "lpc2par"
+  "lpc2par.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpc2par.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
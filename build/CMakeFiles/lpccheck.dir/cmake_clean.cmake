@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lpccheck.dir/src/main/lpccheck.cc.o"
+  "CMakeFiles/lpccheck.dir/src/main/lpccheck.cc.o.d"
+  "lpccheck"
+  "lpccheck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpccheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
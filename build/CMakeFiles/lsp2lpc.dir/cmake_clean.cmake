@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lsp2lpc.dir/src/main/lsp2lpc.cc.o"
+  "CMakeFiles/lsp2lpc.dir/src/main/lsp2lpc.cc.o.d"
+  "lsp2lpc"
+  "lsp2lpc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lsp2lpc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
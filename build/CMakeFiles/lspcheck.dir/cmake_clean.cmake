@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lspcheck.dir/src/main/lspcheck.cc.o"
+  "CMakeFiles/lspcheck.dir/src/main/lspcheck.cc.o.d"
+  "lspcheck"
+  "lspcheck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lspcheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lspdf.dir/src/main/lspdf.cc.o"
+  "CMakeFiles/lspdf.dir/src/main/lspdf.cc.o.d"
+  "lspdf"
+  "lspdf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lspdf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ltcdf.dir/src/main/ltcdf.cc.o"
+  "CMakeFiles/ltcdf.dir/src/main/ltcdf.cc.o.d"
+  "ltcdf"
+  "ltcdf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ltcdf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/magic_intpl.dir/src/main/magic_intpl.cc.o"
+  "CMakeFiles/magic_intpl.dir/src/main/magic_intpl.cc.o.d"
+  "magic_intpl"
+  "magic_intpl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/magic_intpl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
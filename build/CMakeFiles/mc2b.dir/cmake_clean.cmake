@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mc2b.dir/src/main/mc2b.cc.o"
+  "CMakeFiles/mc2b.dir/src/main/mc2b.cc.o.d"
+  "mc2b"
+  "mc2b.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mc2b.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
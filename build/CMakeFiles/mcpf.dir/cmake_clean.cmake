@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mcpf.dir/src/main/mcpf.cc.o"
+  "CMakeFiles/mcpf.dir/src/main/mcpf.cc.o.d"
+  "mcpf"
+  "mcpf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcpf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/medfilt.dir/src/main/medfilt.cc.o"
+  "CMakeFiles/medfilt.dir/src/main/medfilt.cc.o.d"
+  "medfilt"
+  "medfilt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/medfilt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
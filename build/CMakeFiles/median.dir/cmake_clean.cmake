@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/median.dir/src/main/median.cc.o"
+  "CMakeFiles/median.dir/src/main/median.cc.o.d"
+  "median"
+  "median.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/median.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
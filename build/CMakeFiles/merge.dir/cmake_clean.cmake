@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge.dir/src/main/merge.cc.o"
+  "CMakeFiles/merge.dir/src/main/merge.cc.o.d"
+  "merge"
+  "merge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mfcc.dir/src/main/mfcc.cc.o"
+  "CMakeFiles/mfcc.dir/src/main/mfcc.cc.o.d"
+  "mfcc"
+  "mfcc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mfcc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
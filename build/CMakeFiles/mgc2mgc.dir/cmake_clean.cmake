@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mgc2mgc.dir/src/main/mgc2mgc.cc.o"
+  "CMakeFiles/mgc2mgc.dir/src/main/mgc2mgc.cc.o.d"
+  "mgc2mgc"
+  "mgc2mgc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mgc2mgc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
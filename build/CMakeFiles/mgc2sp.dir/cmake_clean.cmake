@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mgc2sp.dir/src/main/mgc2sp.cc.o"
+  "CMakeFiles/mgc2sp.dir/src/main/mgc2sp.cc.o.d"
+  "mgc2sp"
+  "mgc2sp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mgc2sp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
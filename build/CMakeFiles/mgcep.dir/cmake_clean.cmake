@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mgcep.dir/src/main/mgcep.cc.o"
+  "CMakeFiles/mgcep.dir/src/main/mgcep.cc.o.d"
+  "mgcep"
+  "mgcep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mgcep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
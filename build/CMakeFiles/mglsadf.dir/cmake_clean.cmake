@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mglsadf.dir/src/main/mglsadf.cc.o"
+  "CMakeFiles/mglsadf.dir/src/main/mglsadf.cc.o.d"
+  "mglsadf"
+  "mglsadf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mglsadf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
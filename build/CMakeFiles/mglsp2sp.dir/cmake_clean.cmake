@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mglsp2sp.dir/src/main/mglsp2sp.cc.o"
+  "CMakeFiles/mglsp2sp.dir/src/main/mglsp2sp.cc.o.d"
+  "mglsp2sp"
+  "mglsp2sp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mglsp2sp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/minmax.dir/src/main/minmax.cc.o"
+  "CMakeFiles/minmax.dir/src/main/minmax.cc.o.d"
+  "minmax"
+  "minmax.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minmax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mlpg.dir/src/main/mlpg.cc.o"
+  "CMakeFiles/mlpg.dir/src/main/mlpg.cc.o.d"
+  "mlpg"
+  "mlpg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mlpg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
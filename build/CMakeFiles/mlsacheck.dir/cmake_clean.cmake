@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mlsacheck.dir/src/main/mlsacheck.cc.o"
+  "CMakeFiles/mlsacheck.dir/src/main/mlsacheck.cc.o.d"
+  "mlsacheck"
+  "mlsacheck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mlsacheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mpir2c.dir/src/main/mpir2c.cc.o"
+  "CMakeFiles/mpir2c.dir/src/main/mpir2c.cc.o.d"
+  "mpir2c"
+  "mpir2c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpir2c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
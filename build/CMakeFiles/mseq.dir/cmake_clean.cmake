@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mseq.dir/src/main/mseq.cc.o"
+  "CMakeFiles/mseq.dir/src/main/mseq.cc.o.d"
+  "mseq"
+  "mseq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mseq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/msvq.dir/src/main/msvq.cc.o"
+  "CMakeFiles/msvq.dir/src/main/msvq.cc.o.d"
+  "msvq"
+  "msvq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/msvq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nan.dir/src/main/nan.cc.o"
+  "CMakeFiles/nan.dir/src/main/nan.cc.o.d"
+  "nan"
+  "nan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ndps2c.dir/src/main/ndps2c.cc.o"
+  "CMakeFiles/ndps2c.dir/src/main/ndps2c.cc.o.d"
+  "ndps2c"
+  "ndps2c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ndps2c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
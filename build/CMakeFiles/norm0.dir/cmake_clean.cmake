@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/norm0.dir/src/main/norm0.cc.o"
+  "CMakeFiles/norm0.dir/src/main/norm0.cc.o.d"
+  "norm0"
+  "norm0.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/norm0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nrand.dir/src/main/nrand.cc.o"
+  "CMakeFiles/nrand.dir/src/main/nrand.cc.o.d"
+  "nrand"
+  "nrand.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nrand.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
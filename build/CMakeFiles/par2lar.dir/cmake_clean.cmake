@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/par2lar.dir/src/main/par2lar.cc.o"
+  "CMakeFiles/par2lar.dir/src/main/par2lar.cc.o.d"
+  "par2lar"
+  "par2lar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/par2lar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
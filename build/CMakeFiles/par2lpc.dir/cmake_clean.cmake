@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/par2lpc.dir/src/main/par2lpc.cc.o"
+  "CMakeFiles/par2lpc.dir/src/main/par2lpc.cc.o.d"
+  "par2lpc"
+  "par2lpc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/par2lpc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
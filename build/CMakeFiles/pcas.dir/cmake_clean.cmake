@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pcas.dir/src/main/pcas.cc.o"
+  "CMakeFiles/pcas.dir/src/main/pcas.cc.o.d"
+  "pcas"
+  "pcas.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pcas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/phase.dir/src/main/phase.cc.o"
+  "CMakeFiles/phase.dir/src/main/phase.cc.o.d"
+  "phase"
+  "phase.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/phase.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
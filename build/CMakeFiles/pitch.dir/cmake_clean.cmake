@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pitch.dir/src/main/pitch.cc.o"
+  "CMakeFiles/pitch.dir/src/main/pitch.cc.o.d"
+  "pitch"
+  "pitch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pitch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
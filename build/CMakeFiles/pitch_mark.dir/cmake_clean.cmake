@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pitch_mark.dir/src/main/pitch_mark.cc.o"
+  "CMakeFiles/pitch_mark.dir/src/main/pitch_mark.cc.o.d"
+  "pitch_mark"
+  "pitch_mark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pitch_mark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poledf.dir/src/main/poledf.cc.o"
+  "CMakeFiles/poledf.dir/src/main/poledf.cc.o.d"
+  "poledf"
+  "poledf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poledf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
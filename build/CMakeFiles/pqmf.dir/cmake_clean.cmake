@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pqmf.dir/src/main/pqmf.cc.o"
+  "CMakeFiles/pqmf.dir/src/main/pqmf.cc.o.d"
+  "pqmf"
+  "pqmf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pqmf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
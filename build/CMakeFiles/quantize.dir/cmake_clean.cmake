@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/quantize.dir/src/main/quantize.cc.o"
+  "CMakeFiles/quantize.dir/src/main/quantize.cc.o.d"
+  "quantize"
+  "quantize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/quantize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ramp.dir/src/main/ramp.cc.o"
+  "CMakeFiles/ramp.dir/src/main/ramp.cc.o.d"
+  "ramp"
+  "ramp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ramp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reverse.dir/src/main/reverse.cc.o"
+  "CMakeFiles/reverse.dir/src/main/reverse.cc.o.d"
+  "reverse"
+  "reverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rlevdur.dir/src/main/rlevdur.cc.o"
+  "CMakeFiles/rlevdur.dir/src/main/rlevdur.cc.o.d"
+  "rlevdur"
+  "rlevdur.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rlevdur.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rmse.dir/src/main/rmse.cc.o"
+  "CMakeFiles/rmse.dir/src/main/rmse.cc.o.d"
+  "rmse"
+  "rmse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/root_pol.dir/src/main/root_pol.cc.o"
+  "CMakeFiles/root_pol.dir/src/main/root_pol.cc.o.d"
+  "root_pol"
+  "root_pol.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/root_pol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
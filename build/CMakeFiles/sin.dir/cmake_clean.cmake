@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sin.dir/src/main/sin.cc.o"
+  "CMakeFiles/sin.dir/src/main/sin.cc.o.d"
+  "sin"
+  "sin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smcep.dir/src/main/smcep.cc.o"
+  "CMakeFiles/smcep.dir/src/main/smcep.cc.o.d"
+  "smcep"
+  "smcep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smcep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
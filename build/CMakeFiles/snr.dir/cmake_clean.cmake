@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/snr.dir/src/main/snr.cc.o"
+  "CMakeFiles/snr.dir/src/main/snr.cc.o.d"
+  "snr"
+  "snr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/snr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sopr.dir/src/main/sopr.cc.o"
+  "CMakeFiles/sopr.dir/src/main/sopr.cc.o.d"
+  "sopr"
+  "sopr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sopr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
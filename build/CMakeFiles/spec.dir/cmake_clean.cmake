@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spec.dir/src/main/spec.cc.o"
+  "CMakeFiles/spec.dir/src/main/spec.cc.o.d"
+  "spec"
+  "spec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,176 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/analysis/adaptive_generalized_cepstral_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/adaptive_generalized_cepstral_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/adaptive_generalized_cepstral_analysis.cc.o.d"
+  "/root/repo/src/analysis/adaptive_mel_cepstral_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_cepstral_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_cepstral_analysis.cc.o.d"
+  "/root/repo/src/analysis/adaptive_mel_generalized_cepstral_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_generalized_cepstral_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_generalized_cepstral_analysis.cc.o.d"
+  "/root/repo/src/analysis/autocorrelation_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/autocorrelation_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/autocorrelation_analysis.cc.o.d"
+  "/root/repo/src/analysis/fast_fourier_transform_cepstral_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/fast_fourier_transform_cepstral_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/fast_fourier_transform_cepstral_analysis.cc.o.d"
+  "/root/repo/src/analysis/mel_cepstral_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/mel_cepstral_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/mel_cepstral_analysis.cc.o.d"
+  "/root/repo/src/analysis/mel_filter_bank_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/mel_filter_bank_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/mel_filter_bank_analysis.cc.o.d"
+  "/root/repo/src/analysis/mel_frequency_cepstral_coefficients_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/mel_frequency_cepstral_coefficients_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/mel_frequency_cepstral_coefficients_analysis.cc.o.d"
+  "/root/repo/src/analysis/mel_generalized_cepstral_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/mel_generalized_cepstral_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/mel_generalized_cepstral_analysis.cc.o.d"
+  "/root/repo/src/analysis/pitch_extraction.cc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction.cc.o.d"
+  "/root/repo/src/analysis/pitch_extraction_by_rapt.cc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_rapt.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_rapt.cc.o.d"
+  "/root/repo/src/analysis/pitch_extraction_by_reaper.cc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_reaper.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_reaper.cc.o.d"
+  "/root/repo/src/analysis/pitch_extraction_by_swipe.cc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_swipe.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_swipe.cc.o.d"
+  "/root/repo/src/analysis/pitch_extraction_by_world.cc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_world.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_world.cc.o.d"
+  "/root/repo/src/analysis/pitch_extraction_with_voting.cc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_with_voting.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_with_voting.cc.o.d"
+  "/root/repo/src/analysis/second_order_all_pass_mel_cepstral_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/second_order_all_pass_mel_cepstral_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/second_order_all_pass_mel_cepstral_analysis.cc.o.d"
+  "/root/repo/src/analysis/zero_crossing_analysis.cc" "CMakeFiles/sptk.dir/src/analysis/zero_crossing_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/analysis/zero_crossing_analysis.cc.o.d"
+  "/root/repo/src/check/line_spectral_pairs_stability_check.cc" "CMakeFiles/sptk.dir/src/check/line_spectral_pairs_stability_check.cc.o" "gcc" "CMakeFiles/sptk.dir/src/check/line_spectral_pairs_stability_check.cc.o.d"
+  "/root/repo/src/check/linear_predictive_coefficients_stability_check.cc" "CMakeFiles/sptk.dir/src/check/linear_predictive_coefficients_stability_check.cc.o" "gcc" "CMakeFiles/sptk.dir/src/check/linear_predictive_coefficients_stability_check.cc.o.d"
+  "/root/repo/src/check/mlsa_digital_filter_stability_check.cc" "CMakeFiles/sptk.dir/src/check/mlsa_digital_filter_stability_check.cc.o" "gcc" "CMakeFiles/sptk.dir/src/check/mlsa_digital_filter_stability_check.cc.o.d"
+  "/root/repo/src/compression/dynamic_range_compression.cc" "CMakeFiles/sptk.dir/src/compression/dynamic_range_compression.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/dynamic_range_compression.cc.o.d"
+  "/root/repo/src/compression/huffman_coding.cc" "CMakeFiles/sptk.dir/src/compression/huffman_coding.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/huffman_coding.cc.o.d"
+  "/root/repo/src/compression/huffman_decoding.cc" "CMakeFiles/sptk.dir/src/compression/huffman_decoding.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/huffman_decoding.cc.o.d"
+  "/root/repo/src/compression/huffman_encoding.cc" "CMakeFiles/sptk.dir/src/compression/huffman_encoding.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/huffman_encoding.cc.o.d"
+  "/root/repo/src/compression/inverse_multistage_vector_quantization.cc" "CMakeFiles/sptk.dir/src/compression/inverse_multistage_vector_quantization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/inverse_multistage_vector_quantization.cc.o.d"
+  "/root/repo/src/compression/inverse_uniform_quantization.cc" "CMakeFiles/sptk.dir/src/compression/inverse_uniform_quantization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/inverse_uniform_quantization.cc.o.d"
+  "/root/repo/src/compression/inverse_vector_quantization.cc" "CMakeFiles/sptk.dir/src/compression/inverse_vector_quantization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/inverse_vector_quantization.cc.o.d"
+  "/root/repo/src/compression/linde_buzo_gray_algorithm.cc" "CMakeFiles/sptk.dir/src/compression/linde_buzo_gray_algorithm.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/linde_buzo_gray_algorithm.cc.o.d"
+  "/root/repo/src/compression/mu_law_compression.cc" "CMakeFiles/sptk.dir/src/compression/mu_law_compression.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/mu_law_compression.cc.o.d"
+  "/root/repo/src/compression/mu_law_expansion.cc" "CMakeFiles/sptk.dir/src/compression/mu_law_expansion.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/mu_law_expansion.cc.o.d"
+  "/root/repo/src/compression/multistage_vector_quantization.cc" "CMakeFiles/sptk.dir/src/compression/multistage_vector_quantization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/multistage_vector_quantization.cc.o.d"
+  "/root/repo/src/compression/uniform_quantization.cc" "CMakeFiles/sptk.dir/src/compression/uniform_quantization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/uniform_quantization.cc.o.d"
+  "/root/repo/src/compression/vector_quantization.cc" "CMakeFiles/sptk.dir/src/compression/vector_quantization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/compression/vector_quantization.cc.o.d"
+  "/root/repo/src/conversion/all_pole_to_all_zero_digital_filter_coefficients.cc" "CMakeFiles/sptk.dir/src/conversion/all_pole_to_all_zero_digital_filter_coefficients.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/all_pole_to_all_zero_digital_filter_coefficients.cc.o.d"
+  "/root/repo/src/conversion/autocorrelation_to_composite_sinusoidal_modeling.cc" "CMakeFiles/sptk.dir/src/conversion/autocorrelation_to_composite_sinusoidal_modeling.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/autocorrelation_to_composite_sinusoidal_modeling.cc.o.d"
+  "/root/repo/src/conversion/cepstrum_to_autocorrelation.cc" "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_autocorrelation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_autocorrelation.cc.o.d"
+  "/root/repo/src/conversion/cepstrum_to_minimum_phase_impulse_response.cc" "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_minimum_phase_impulse_response.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_minimum_phase_impulse_response.cc.o.d"
+  "/root/repo/src/conversion/cepstrum_to_negative_derivative_of_phase_spectrum.cc" "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_negative_derivative_of_phase_spectrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_negative_derivative_of_phase_spectrum.cc.o.d"
+  "/root/repo/src/conversion/composite_sinusoidal_modeling_to_autocorrelation.cc" "CMakeFiles/sptk.dir/src/conversion/composite_sinusoidal_modeling_to_autocorrelation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/composite_sinusoidal_modeling_to_autocorrelation.cc.o.d"
+  "/root/repo/src/conversion/filter_coefficients_to_group_delay.cc" "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_group_delay.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_group_delay.cc.o.d"
+  "/root/repo/src/conversion/filter_coefficients_to_phase_spectrum.cc" "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_phase_spectrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_phase_spectrum.cc.o.d"
+  "/root/repo/src/conversion/filter_coefficients_to_spectrum.cc" "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_spectrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_spectrum.cc.o.d"
+  "/root/repo/src/conversion/generalized_cepstrum_gain_normalization.cc" "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_gain_normalization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_gain_normalization.cc.o.d"
+  "/root/repo/src/conversion/generalized_cepstrum_inverse_gain_normalization.cc" "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_inverse_gain_normalization.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_inverse_gain_normalization.cc.o.d"
+  "/root/repo/src/conversion/line_spectral_pairs_to_linear_predictive_coefficients.cc" "CMakeFiles/sptk.dir/src/conversion/line_spectral_pairs_to_linear_predictive_coefficients.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/line_spectral_pairs_to_linear_predictive_coefficients.cc.o.d"
+  "/root/repo/src/conversion/linear_predictive_coefficients_to_cepstrum.cc" "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_cepstrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_cepstrum.cc.o.d"
+  "/root/repo/src/conversion/linear_predictive_coefficients_to_line_spectral_pairs.cc" "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_line_spectral_pairs.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_line_spectral_pairs.cc.o.d"
+  "/root/repo/src/conversion/linear_predictive_coefficients_to_parcor_coefficients.cc" "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_parcor_coefficients.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_parcor_coefficients.cc.o.d"
+  "/root/repo/src/conversion/log_area_ratio_to_parcor_coefficients.cc" "CMakeFiles/sptk.dir/src/conversion/log_area_ratio_to_parcor_coefficients.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/log_area_ratio_to_parcor_coefficients.cc.o.d"
+  "/root/repo/src/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.cc" "CMakeFiles/sptk.dir/src/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.cc.o.d"
+  "/root/repo/src/conversion/mel_generalized_cepstrum_to_mel_generalized_cepstrum.cc" "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_mel_generalized_cepstrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_mel_generalized_cepstrum.cc.o.d"
+  "/root/repo/src/conversion/mel_generalized_cepstrum_to_spectrum.cc" "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_spectrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_spectrum.cc.o.d"
+  "/root/repo/src/conversion/mel_generalized_line_spectral_pairs_to_spectrum.cc" "CMakeFiles/sptk.dir/src/conversion/mel_generalized_line_spectral_pairs_to_spectrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/mel_generalized_line_spectral_pairs_to_spectrum.cc.o.d"
+  "/root/repo/src/conversion/minimum_phase_impulse_response_to_cepstrum.cc" "CMakeFiles/sptk.dir/src/conversion/minimum_phase_impulse_response_to_cepstrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/minimum_phase_impulse_response_to_cepstrum.cc.o.d"
+  "/root/repo/src/conversion/mlsa_digital_filter_coefficients_to_mel_cepstrum.cc" "CMakeFiles/sptk.dir/src/conversion/mlsa_digital_filter_coefficients_to_mel_cepstrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/mlsa_digital_filter_coefficients_to_mel_cepstrum.cc.o.d"
+  "/root/repo/src/conversion/negative_derivative_of_phase_spectrum_to_cepstrum.cc" "CMakeFiles/sptk.dir/src/conversion/negative_derivative_of_phase_spectrum_to_cepstrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/negative_derivative_of_phase_spectrum_to_cepstrum.cc.o.d"
+  "/root/repo/src/conversion/parcor_coefficients_to_linear_predictive_coefficients.cc" "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_linear_predictive_coefficients.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_linear_predictive_coefficients.cc.o.d"
+  "/root/repo/src/conversion/parcor_coefficients_to_log_area_ratio.cc" "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_log_area_ratio.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_log_area_ratio.cc.o.d"
+  "/root/repo/src/conversion/spectrum_to_autocorrelation.cc" "CMakeFiles/sptk.dir/src/conversion/spectrum_to_autocorrelation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/spectrum_to_autocorrelation.cc.o.d"
+  "/root/repo/src/conversion/spectrum_to_spectrum.cc" "CMakeFiles/sptk.dir/src/conversion/spectrum_to_spectrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/spectrum_to_spectrum.cc.o.d"
+  "/root/repo/src/conversion/waveform_to_autocorrelation.cc" "CMakeFiles/sptk.dir/src/conversion/waveform_to_autocorrelation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/waveform_to_autocorrelation.cc.o.d"
+  "/root/repo/src/conversion/waveform_to_mel_generalized_cepstrum.cc" "CMakeFiles/sptk.dir/src/conversion/waveform_to_mel_generalized_cepstrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/waveform_to_mel_generalized_cepstrum.cc.o.d"
+  "/root/repo/src/conversion/waveform_to_spectrum.cc" "CMakeFiles/sptk.dir/src/conversion/waveform_to_spectrum.cc.o" "gcc" "CMakeFiles/sptk.dir/src/conversion/waveform_to_spectrum.cc.o.d"
+  "/root/repo/src/filter/all_pole_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/all_pole_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/all_pole_digital_filter.cc.o.d"
+  "/root/repo/src/filter/all_pole_lattice_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/all_pole_lattice_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/all_pole_lattice_digital_filter.cc.o.d"
+  "/root/repo/src/filter/all_zero_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/all_zero_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/all_zero_digital_filter.cc.o.d"
+  "/root/repo/src/filter/infinite_impulse_response_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/infinite_impulse_response_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/infinite_impulse_response_digital_filter.cc.o.d"
+  "/root/repo/src/filter/inverse_mglsa_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/inverse_mglsa_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/inverse_mglsa_digital_filter.cc.o.d"
+  "/root/repo/src/filter/inverse_pseudo_quadrature_mirror_filter_banks.cc" "CMakeFiles/sptk.dir/src/filter/inverse_pseudo_quadrature_mirror_filter_banks.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/inverse_pseudo_quadrature_mirror_filter_banks.cc.o.d"
+  "/root/repo/src/filter/line_spectral_pairs_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/line_spectral_pairs_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/line_spectral_pairs_digital_filter.cc.o.d"
+  "/root/repo/src/filter/median_filter.cc" "CMakeFiles/sptk.dir/src/filter/median_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/median_filter.cc.o.d"
+  "/root/repo/src/filter/mglsa_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/mglsa_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/mglsa_digital_filter.cc.o.d"
+  "/root/repo/src/filter/mlsa_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/mlsa_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/mlsa_digital_filter.cc.o.d"
+  "/root/repo/src/filter/pseudo_quadrature_mirror_filter_banks.cc" "CMakeFiles/sptk.dir/src/filter/pseudo_quadrature_mirror_filter_banks.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/pseudo_quadrature_mirror_filter_banks.cc.o.d"
+  "/root/repo/src/filter/second_order_digital_filter.cc" "CMakeFiles/sptk.dir/src/filter/second_order_digital_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/filter/second_order_digital_filter.cc.o.d"
+  "/root/repo/src/generation/delta_calculation.cc" "CMakeFiles/sptk.dir/src/generation/delta_calculation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/generation/delta_calculation.cc.o.d"
+  "/root/repo/src/generation/excitation_generation.cc" "CMakeFiles/sptk.dir/src/generation/excitation_generation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/generation/excitation_generation.cc.o.d"
+  "/root/repo/src/generation/m_sequence_generation.cc" "CMakeFiles/sptk.dir/src/generation/m_sequence_generation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/generation/m_sequence_generation.cc.o.d"
+  "/root/repo/src/generation/nonrecursive_maximum_likelihood_parameter_generation.cc" "CMakeFiles/sptk.dir/src/generation/nonrecursive_maximum_likelihood_parameter_generation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/generation/nonrecursive_maximum_likelihood_parameter_generation.cc.o.d"
+  "/root/repo/src/generation/normal_distributed_random_value_generation.cc" "CMakeFiles/sptk.dir/src/generation/normal_distributed_random_value_generation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/generation/normal_distributed_random_value_generation.cc.o.d"
+  "/root/repo/src/generation/recursive_maximum_likelihood_parameter_generation.cc" "CMakeFiles/sptk.dir/src/generation/recursive_maximum_likelihood_parameter_generation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/generation/recursive_maximum_likelihood_parameter_generation.cc.o.d"
+  "/root/repo/src/input/input_source_delay.cc" "CMakeFiles/sptk.dir/src/input/input_source_delay.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_delay.cc.o.d"
+  "/root/repo/src/input/input_source_filling_magic_number.cc" "CMakeFiles/sptk.dir/src/input/input_source_filling_magic_number.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_filling_magic_number.cc.o.d"
+  "/root/repo/src/input/input_source_framing.cc" "CMakeFiles/sptk.dir/src/input/input_source_framing.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_framing.cc.o.d"
+  "/root/repo/src/input/input_source_from_array.cc" "CMakeFiles/sptk.dir/src/input/input_source_from_array.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_from_array.cc.o.d"
+  "/root/repo/src/input/input_source_from_matrix.cc" "CMakeFiles/sptk.dir/src/input/input_source_from_matrix.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_from_matrix.cc.o.d"
+  "/root/repo/src/input/input_source_from_stream.cc" "CMakeFiles/sptk.dir/src/input/input_source_from_stream.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_from_stream.cc.o.d"
+  "/root/repo/src/input/input_source_from_vector.cc" "CMakeFiles/sptk.dir/src/input/input_source_from_vector.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_from_vector.cc.o.d"
+  "/root/repo/src/input/input_source_interpolation.cc" "CMakeFiles/sptk.dir/src/input/input_source_interpolation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_interpolation.cc.o.d"
+  "/root/repo/src/input/input_source_interpolation_with_magic_number.cc" "CMakeFiles/sptk.dir/src/input/input_source_interpolation_with_magic_number.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_interpolation_with_magic_number.cc.o.d"
+  "/root/repo/src/input/input_source_preprocessing_for_filter_gain.cc" "CMakeFiles/sptk.dir/src/input/input_source_preprocessing_for_filter_gain.cc.o" "gcc" "CMakeFiles/sptk.dir/src/input/input_source_preprocessing_for_filter_gain.cc.o.d"
+  "/root/repo/src/math/discrete_cosine_transform.cc" "CMakeFiles/sptk.dir/src/math/discrete_cosine_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/discrete_cosine_transform.cc.o.d"
+  "/root/repo/src/math/discrete_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/discrete_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/discrete_fourier_transform.cc.o.d"
+  "/root/repo/src/math/distance_calculation.cc" "CMakeFiles/sptk.dir/src/math/distance_calculation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/distance_calculation.cc.o.d"
+  "/root/repo/src/math/durand_kerner_method.cc" "CMakeFiles/sptk.dir/src/math/durand_kerner_method.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/durand_kerner_method.cc.o.d"
+  "/root/repo/src/math/dynamic_time_warping.cc" "CMakeFiles/sptk.dir/src/math/dynamic_time_warping.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/dynamic_time_warping.cc.o.d"
+  "/root/repo/src/math/entropy_calculation.cc" "CMakeFiles/sptk.dir/src/math/entropy_calculation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/entropy_calculation.cc.o.d"
+  "/root/repo/src/math/fast_dynamic_time_warping.cc" "CMakeFiles/sptk.dir/src/math/fast_dynamic_time_warping.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/fast_dynamic_time_warping.cc.o.d"
+  "/root/repo/src/math/fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/fourier_transform.cc.o.d"
+  "/root/repo/src/math/frequency_transform.cc" "CMakeFiles/sptk.dir/src/math/frequency_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/frequency_transform.cc.o.d"
+  "/root/repo/src/math/gaussian_mixture_model_based_conversion.cc" "CMakeFiles/sptk.dir/src/math/gaussian_mixture_model_based_conversion.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/gaussian_mixture_model_based_conversion.cc.o.d"
+  "/root/repo/src/math/gaussian_mixture_modeling.cc" "CMakeFiles/sptk.dir/src/math/gaussian_mixture_modeling.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/gaussian_mixture_modeling.cc.o.d"
+  "/root/repo/src/math/histogram_calculation.cc" "CMakeFiles/sptk.dir/src/math/histogram_calculation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/histogram_calculation.cc.o.d"
+  "/root/repo/src/math/inverse_discrete_cosine_transform.cc" "CMakeFiles/sptk.dir/src/math/inverse_discrete_cosine_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/inverse_discrete_cosine_transform.cc.o.d"
+  "/root/repo/src/math/inverse_fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/inverse_fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/inverse_fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/levinson_durbin_recursion.cc" "CMakeFiles/sptk.dir/src/math/levinson_durbin_recursion.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/levinson_durbin_recursion.cc.o.d"
+  "/root/repo/src/math/matrix.cc" "CMakeFiles/sptk.dir/src/math/matrix.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/matrix.cc.o.d"
+  "/root/repo/src/math/matrix2d.cc" "CMakeFiles/sptk.dir/src/math/matrix2d.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/matrix2d.cc.o.d"
+  "/root/repo/src/math/median_accumulation.cc" "CMakeFiles/sptk.dir/src/math/median_accumulation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/median_accumulation.cc.o.d"
+  "/root/repo/src/math/minmax_accumulation.cc" "CMakeFiles/sptk.dir/src/math/minmax_accumulation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/minmax_accumulation.cc.o.d"
+  "/root/repo/src/math/mixed_radix_fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/mixed_radix_fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/mixed_radix_fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/principal_component_analysis.cc" "CMakeFiles/sptk.dir/src/math/principal_component_analysis.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/principal_component_analysis.cc.o.d"
+  "/root/repo/src/math/real_valued_fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/real_valued_fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/real_valued_fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/real_valued_inverse_fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/real_valued_inverse_fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/real_valued_inverse_fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/reverse_levinson_durbin_recursion.cc" "CMakeFiles/sptk.dir/src/math/reverse_levinson_durbin_recursion.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/reverse_levinson_durbin_recursion.cc.o.d"
+  "/root/repo/src/math/scalar_operation.cc" "CMakeFiles/sptk.dir/src/math/scalar_operation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/scalar_operation.cc.o.d"
+  "/root/repo/src/math/second_order_all_pass_frequency_transform.cc" "CMakeFiles/sptk.dir/src/math/second_order_all_pass_frequency_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/second_order_all_pass_frequency_transform.cc.o.d"
+  "/root/repo/src/math/second_order_all_pass_inverse_frequency_transform.cc" "CMakeFiles/sptk.dir/src/math/second_order_all_pass_inverse_frequency_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/second_order_all_pass_inverse_frequency_transform.cc.o.d"
+  "/root/repo/src/math/statistics_accumulation.cc" "CMakeFiles/sptk.dir/src/math/statistics_accumulation.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/statistics_accumulation.cc.o.d"
+  "/root/repo/src/math/symmetric_matrix.cc" "CMakeFiles/sptk.dir/src/math/symmetric_matrix.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/symmetric_matrix.cc.o.d"
+  "/root/repo/src/math/symmetric_system_solver.cc" "CMakeFiles/sptk.dir/src/math/symmetric_system_solver.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/symmetric_system_solver.cc.o.d"
+  "/root/repo/src/math/toeplitz_plus_hankel_system_solver.cc" "CMakeFiles/sptk.dir/src/math/toeplitz_plus_hankel_system_solver.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/toeplitz_plus_hankel_system_solver.cc.o.d"
+  "/root/repo/src/math/two_dimensional_fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/two_dimensional_fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/two_dimensional_fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/two_dimensional_inverse_fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/two_dimensional_inverse_fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/two_dimensional_inverse_fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/two_dimensional_real_valued_fast_fourier_transform.cc" "CMakeFiles/sptk.dir/src/math/two_dimensional_real_valued_fast_fourier_transform.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/two_dimensional_real_valued_fast_fourier_transform.cc.o.d"
+  "/root/repo/src/math/vandermonde_system_solver.cc" "CMakeFiles/sptk.dir/src/math/vandermonde_system_solver.cc.o" "gcc" "CMakeFiles/sptk.dir/src/math/vandermonde_system_solver.cc.o.d"
+  "/root/repo/src/postfilter/mel_cepstrum_postfilter.cc" "CMakeFiles/sptk.dir/src/postfilter/mel_cepstrum_postfilter.cc.o" "gcc" "CMakeFiles/sptk.dir/src/postfilter/mel_cepstrum_postfilter.cc.o.d"
+  "/root/repo/src/utils/buffered_input_stream.cc" "CMakeFiles/sptk.dir/src/utils/buffered_input_stream.cc.o" "gcc" "CMakeFiles/sptk.dir/src/utils/buffered_input_stream.cc.o.d"
+  "/root/repo/src/utils/buffered_output_stream.cc" "CMakeFiles/sptk.dir/src/utils/buffered_output_stream.cc.o" "gcc" "CMakeFiles/sptk.dir/src/utils/buffered_output_stream.cc.o.d"
+  "/root/repo/src/utils/data_symmetrizing.cc" "CMakeFiles/sptk.dir/src/utils/data_symmetrizing.cc.o" "gcc" "CMakeFiles/sptk.dir/src/utils/data_symmetrizing.cc.o.d"
+  "/root/repo/src/utils/misc_utils.cc" "CMakeFiles/sptk.dir/src/utils/misc_utils.cc.o" "gcc" "CMakeFiles/sptk.dir/src/utils/misc_utils.cc.o.d"
+  "/root/repo/src/utils/parallel_frame_executor.cc" "CMakeFiles/sptk.dir/src/utils/parallel_frame_executor.cc.o" "gcc" "CMakeFiles/sptk.dir/src/utils/parallel_frame_executor.cc.o.d"
+  "/root/repo/src/utils/sptk_utils.cc" "CMakeFiles/sptk.dir/src/utils/sptk_utils.cc.o" "gcc" "CMakeFiles/sptk.dir/src/utils/sptk_utils.cc.o.d"
+  "/root/repo/src/window/chebyshev_window.cc" "CMakeFiles/sptk.dir/src/window/chebyshev_window.cc.o" "gcc" "CMakeFiles/sptk.dir/src/window/chebyshev_window.cc.o.d"
+  "/root/repo/src/window/cosine_window.cc" "CMakeFiles/sptk.dir/src/window/cosine_window.cc.o" "gcc" "CMakeFiles/sptk.dir/src/window/cosine_window.cc.o.d"
+  "/root/repo/src/window/data_windowing.cc" "CMakeFiles/sptk.dir/src/window/data_windowing.cc.o" "gcc" "CMakeFiles/sptk.dir/src/window/data_windowing.cc.o.d"
+  "/root/repo/src/window/kaiser_window.cc" "CMakeFiles/sptk.dir/src/window/kaiser_window.cc.o" "gcc" "CMakeFiles/sptk.dir/src/window/kaiser_window.cc.o.d"
+  "/root/repo/src/window/standard_window.cc" "CMakeFiles/sptk.dir/src/window/standard_window.cc.o" "gcc" "CMakeFiles/sptk.dir/src/window/standard_window.cc.o.d"
+  "/root/repo/third_party/Getopt/getoptwin.cc" "CMakeFiles/sptk.dir/third_party/Getopt/getoptwin.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/Getopt/getoptwin.cc.o.d"
+  "/root/repo/third_party/REAPER/core/file_resource.cc" "CMakeFiles/sptk.dir/third_party/REAPER/core/file_resource.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/core/file_resource.cc.o.d"
+  "/root/repo/third_party/REAPER/core/float_matrix.cc" "CMakeFiles/sptk.dir/third_party/REAPER/core/float_matrix.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/core/float_matrix.cc.o.d"
+  "/root/repo/third_party/REAPER/core/track.cc" "CMakeFiles/sptk.dir/third_party/REAPER/core/track.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/core/track.cc.o.d"
+  "/root/repo/third_party/REAPER/epoch_tracker/epoch_tracker.cc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/epoch_tracker.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/epoch_tracker.cc.o.d"
+  "/root/repo/third_party/REAPER/epoch_tracker/fd_filter.cc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fd_filter.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fd_filter.cc.o.d"
+  "/root/repo/third_party/REAPER/epoch_tracker/fft_reaper.cc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fft_reaper.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fft_reaper.cc.o.d"
+  "/root/repo/third_party/REAPER/epoch_tracker/lpc_analyzer.cc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/lpc_analyzer.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/lpc_analyzer.cc.o.d"
+  "/root/repo/third_party/REAPER/wave/codec_riff.cc" "CMakeFiles/sptk.dir/third_party/REAPER/wave/codec_riff.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/wave/codec_riff.cc.o.d"
+  "/root/repo/third_party/REAPER/wave/wave.cc" "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave.cc.o.d"
+  "/root/repo/third_party/REAPER/wave/wave_io.cc" "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave_io.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave_io.cc.o.d"
+  "/root/repo/third_party/SWIPE/swipe.cc" "CMakeFiles/sptk.dir/third_party/SWIPE/swipe.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/SWIPE/swipe.cc.o.d"
+  "/root/repo/third_party/SWIPE/vector.cc" "CMakeFiles/sptk.dir/third_party/SWIPE/vector.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/SWIPE/vector.cc.o.d"
+  "/root/repo/third_party/Snack/jkGetF0.cc" "CMakeFiles/sptk.dir/third_party/Snack/jkGetF0.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/Snack/jkGetF0.cc.o.d"
+  "/root/repo/third_party/Snack/sigproc.cc" "CMakeFiles/sptk.dir/third_party/Snack/sigproc.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/Snack/sigproc.cc.o.d"
+  "/root/repo/third_party/WORLD/common.cc" "CMakeFiles/sptk.dir/third_party/WORLD/common.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/WORLD/common.cc.o.d"
+  "/root/repo/third_party/WORLD/dio.cc" "CMakeFiles/sptk.dir/third_party/WORLD/dio.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/WORLD/dio.cc.o.d"
+  "/root/repo/third_party/WORLD/fft_world.cc" "CMakeFiles/sptk.dir/third_party/WORLD/fft_world.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/WORLD/fft_world.cc.o.d"
+  "/root/repo/third_party/WORLD/matlabfunctions.cc" "CMakeFiles/sptk.dir/third_party/WORLD/matlabfunctions.cc.o" "gcc" "CMakeFiles/sptk.dir/third_party/WORLD/matlabfunctions.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,325 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sptk.dir/src/analysis/adaptive_generalized_cepstral_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/adaptive_generalized_cepstral_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_cepstral_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_cepstral_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_generalized_cepstral_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/adaptive_mel_generalized_cepstral_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/autocorrelation_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/autocorrelation_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/fast_fourier_transform_cepstral_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/fast_fourier_transform_cepstral_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/mel_cepstral_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/mel_cepstral_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/mel_filter_bank_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/mel_filter_bank_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/mel_frequency_cepstral_coefficients_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/mel_frequency_cepstral_coefficients_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/mel_generalized_cepstral_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/mel_generalized_cepstral_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_rapt.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_rapt.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_reaper.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_reaper.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_swipe.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_swipe.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_world.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_by_world.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_with_voting.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/pitch_extraction_with_voting.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/second_order_all_pass_mel_cepstral_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/second_order_all_pass_mel_cepstral_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/analysis/zero_crossing_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/analysis/zero_crossing_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/check/line_spectral_pairs_stability_check.cc.o"
+  "CMakeFiles/sptk.dir/src/check/line_spectral_pairs_stability_check.cc.o.d"
+  "CMakeFiles/sptk.dir/src/check/linear_predictive_coefficients_stability_check.cc.o"
+  "CMakeFiles/sptk.dir/src/check/linear_predictive_coefficients_stability_check.cc.o.d"
+  "CMakeFiles/sptk.dir/src/check/mlsa_digital_filter_stability_check.cc.o"
+  "CMakeFiles/sptk.dir/src/check/mlsa_digital_filter_stability_check.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/dynamic_range_compression.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/dynamic_range_compression.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/huffman_coding.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/huffman_coding.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/huffman_decoding.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/huffman_decoding.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/huffman_encoding.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/huffman_encoding.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/inverse_multistage_vector_quantization.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/inverse_multistage_vector_quantization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/inverse_uniform_quantization.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/inverse_uniform_quantization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/inverse_vector_quantization.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/inverse_vector_quantization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/linde_buzo_gray_algorithm.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/linde_buzo_gray_algorithm.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/mu_law_compression.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/mu_law_compression.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/mu_law_expansion.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/mu_law_expansion.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/multistage_vector_quantization.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/multistage_vector_quantization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/uniform_quantization.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/uniform_quantization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/compression/vector_quantization.cc.o"
+  "CMakeFiles/sptk.dir/src/compression/vector_quantization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/all_pole_to_all_zero_digital_filter_coefficients.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/all_pole_to_all_zero_digital_filter_coefficients.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/autocorrelation_to_composite_sinusoidal_modeling.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/autocorrelation_to_composite_sinusoidal_modeling.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_autocorrelation.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_autocorrelation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_minimum_phase_impulse_response.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_minimum_phase_impulse_response.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_negative_derivative_of_phase_spectrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/cepstrum_to_negative_derivative_of_phase_spectrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/composite_sinusoidal_modeling_to_autocorrelation.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/composite_sinusoidal_modeling_to_autocorrelation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_group_delay.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_group_delay.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_phase_spectrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_phase_spectrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_spectrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/filter_coefficients_to_spectrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_gain_normalization.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_gain_normalization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_inverse_gain_normalization.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/generalized_cepstrum_inverse_gain_normalization.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/line_spectral_pairs_to_linear_predictive_coefficients.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/line_spectral_pairs_to_linear_predictive_coefficients.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_cepstrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_cepstrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_line_spectral_pairs.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_line_spectral_pairs.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_parcor_coefficients.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/linear_predictive_coefficients_to_parcor_coefficients.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/log_area_ratio_to_parcor_coefficients.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/log_area_ratio_to_parcor_coefficients.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_mel_generalized_cepstrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_mel_generalized_cepstrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_spectrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/mel_generalized_cepstrum_to_spectrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/mel_generalized_line_spectral_pairs_to_spectrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/mel_generalized_line_spectral_pairs_to_spectrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/minimum_phase_impulse_response_to_cepstrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/minimum_phase_impulse_response_to_cepstrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/mlsa_digital_filter_coefficients_to_mel_cepstrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/mlsa_digital_filter_coefficients_to_mel_cepstrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/negative_derivative_of_phase_spectrum_to_cepstrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/negative_derivative_of_phase_spectrum_to_cepstrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_linear_predictive_coefficients.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_linear_predictive_coefficients.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_log_area_ratio.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/parcor_coefficients_to_log_area_ratio.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/spectrum_to_autocorrelation.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/spectrum_to_autocorrelation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/spectrum_to_spectrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/spectrum_to_spectrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/waveform_to_autocorrelation.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/waveform_to_autocorrelation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/waveform_to_mel_generalized_cepstrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/waveform_to_mel_generalized_cepstrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/conversion/waveform_to_spectrum.cc.o"
+  "CMakeFiles/sptk.dir/src/conversion/waveform_to_spectrum.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/all_pole_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/all_pole_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/all_pole_lattice_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/all_pole_lattice_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/all_zero_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/all_zero_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/infinite_impulse_response_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/infinite_impulse_response_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/inverse_mglsa_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/inverse_mglsa_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/inverse_pseudo_quadrature_mirror_filter_banks.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/inverse_pseudo_quadrature_mirror_filter_banks.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/line_spectral_pairs_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/line_spectral_pairs_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/median_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/median_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/mglsa_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/mglsa_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/mlsa_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/mlsa_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/pseudo_quadrature_mirror_filter_banks.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/pseudo_quadrature_mirror_filter_banks.cc.o.d"
+  "CMakeFiles/sptk.dir/src/filter/second_order_digital_filter.cc.o"
+  "CMakeFiles/sptk.dir/src/filter/second_order_digital_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/generation/delta_calculation.cc.o"
+  "CMakeFiles/sptk.dir/src/generation/delta_calculation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/generation/excitation_generation.cc.o"
+  "CMakeFiles/sptk.dir/src/generation/excitation_generation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/generation/m_sequence_generation.cc.o"
+  "CMakeFiles/sptk.dir/src/generation/m_sequence_generation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/generation/nonrecursive_maximum_likelihood_parameter_generation.cc.o"
+  "CMakeFiles/sptk.dir/src/generation/nonrecursive_maximum_likelihood_parameter_generation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/generation/normal_distributed_random_value_generation.cc.o"
+  "CMakeFiles/sptk.dir/src/generation/normal_distributed_random_value_generation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/generation/recursive_maximum_likelihood_parameter_generation.cc.o"
+  "CMakeFiles/sptk.dir/src/generation/recursive_maximum_likelihood_parameter_generation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_delay.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_delay.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_filling_magic_number.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_filling_magic_number.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_framing.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_framing.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_array.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_array.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_matrix.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_matrix.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_stream.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_stream.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_vector.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_from_vector.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_interpolation.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_interpolation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_interpolation_with_magic_number.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_interpolation_with_magic_number.cc.o.d"
+  "CMakeFiles/sptk.dir/src/input/input_source_preprocessing_for_filter_gain.cc.o"
+  "CMakeFiles/sptk.dir/src/input/input_source_preprocessing_for_filter_gain.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/discrete_cosine_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/discrete_cosine_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/discrete_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/discrete_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/distance_calculation.cc.o"
+  "CMakeFiles/sptk.dir/src/math/distance_calculation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/durand_kerner_method.cc.o"
+  "CMakeFiles/sptk.dir/src/math/durand_kerner_method.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/dynamic_time_warping.cc.o"
+  "CMakeFiles/sptk.dir/src/math/dynamic_time_warping.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/entropy_calculation.cc.o"
+  "CMakeFiles/sptk.dir/src/math/entropy_calculation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/fast_dynamic_time_warping.cc.o"
+  "CMakeFiles/sptk.dir/src/math/fast_dynamic_time_warping.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/frequency_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/frequency_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/gaussian_mixture_model_based_conversion.cc.o"
+  "CMakeFiles/sptk.dir/src/math/gaussian_mixture_model_based_conversion.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/gaussian_mixture_modeling.cc.o"
+  "CMakeFiles/sptk.dir/src/math/gaussian_mixture_modeling.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/histogram_calculation.cc.o"
+  "CMakeFiles/sptk.dir/src/math/histogram_calculation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/inverse_discrete_cosine_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/inverse_discrete_cosine_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/inverse_fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/inverse_fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/levinson_durbin_recursion.cc.o"
+  "CMakeFiles/sptk.dir/src/math/levinson_durbin_recursion.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/matrix.cc.o"
+  "CMakeFiles/sptk.dir/src/math/matrix.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/matrix2d.cc.o"
+  "CMakeFiles/sptk.dir/src/math/matrix2d.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/median_accumulation.cc.o"
+  "CMakeFiles/sptk.dir/src/math/median_accumulation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/minmax_accumulation.cc.o"
+  "CMakeFiles/sptk.dir/src/math/minmax_accumulation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/mixed_radix_fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/mixed_radix_fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/principal_component_analysis.cc.o"
+  "CMakeFiles/sptk.dir/src/math/principal_component_analysis.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/real_valued_fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/real_valued_fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/real_valued_inverse_fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/real_valued_inverse_fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/reverse_levinson_durbin_recursion.cc.o"
+  "CMakeFiles/sptk.dir/src/math/reverse_levinson_durbin_recursion.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/scalar_operation.cc.o"
+  "CMakeFiles/sptk.dir/src/math/scalar_operation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/second_order_all_pass_frequency_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/second_order_all_pass_frequency_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/second_order_all_pass_inverse_frequency_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/second_order_all_pass_inverse_frequency_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/statistics_accumulation.cc.o"
+  "CMakeFiles/sptk.dir/src/math/statistics_accumulation.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/symmetric_matrix.cc.o"
+  "CMakeFiles/sptk.dir/src/math/symmetric_matrix.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/symmetric_system_solver.cc.o"
+  "CMakeFiles/sptk.dir/src/math/symmetric_system_solver.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/toeplitz_plus_hankel_system_solver.cc.o"
+  "CMakeFiles/sptk.dir/src/math/toeplitz_plus_hankel_system_solver.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/two_dimensional_fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/two_dimensional_fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/two_dimensional_inverse_fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/two_dimensional_inverse_fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/two_dimensional_real_valued_fast_fourier_transform.cc.o"
+  "CMakeFiles/sptk.dir/src/math/two_dimensional_real_valued_fast_fourier_transform.cc.o.d"
+  "CMakeFiles/sptk.dir/src/math/vandermonde_system_solver.cc.o"
+  "CMakeFiles/sptk.dir/src/math/vandermonde_system_solver.cc.o.d"
+  "CMakeFiles/sptk.dir/src/postfilter/mel_cepstrum_postfilter.cc.o"
+  "CMakeFiles/sptk.dir/src/postfilter/mel_cepstrum_postfilter.cc.o.d"
+  "CMakeFiles/sptk.dir/src/utils/buffered_input_stream.cc.o"
+  "CMakeFiles/sptk.dir/src/utils/buffered_input_stream.cc.o.d"
+  "CMakeFiles/sptk.dir/src/utils/buffered_output_stream.cc.o"
+  "CMakeFiles/sptk.dir/src/utils/buffered_output_stream.cc.o.d"
+  "CMakeFiles/sptk.dir/src/utils/data_symmetrizing.cc.o"
+  "CMakeFiles/sptk.dir/src/utils/data_symmetrizing.cc.o.d"
+  "CMakeFiles/sptk.dir/src/utils/misc_utils.cc.o"
+  "CMakeFiles/sptk.dir/src/utils/misc_utils.cc.o.d"
+  "CMakeFiles/sptk.dir/src/utils/parallel_frame_executor.cc.o"
+  "CMakeFiles/sptk.dir/src/utils/parallel_frame_executor.cc.o.d"
+  "CMakeFiles/sptk.dir/src/utils/sptk_utils.cc.o"
+  "CMakeFiles/sptk.dir/src/utils/sptk_utils.cc.o.d"
+  "CMakeFiles/sptk.dir/src/window/chebyshev_window.cc.o"
+  "CMakeFiles/sptk.dir/src/window/chebyshev_window.cc.o.d"
+  "CMakeFiles/sptk.dir/src/window/cosine_window.cc.o"
+  "CMakeFiles/sptk.dir/src/window/cosine_window.cc.o.d"
+  "CMakeFiles/sptk.dir/src/window/data_windowing.cc.o"
+  "CMakeFiles/sptk.dir/src/window/data_windowing.cc.o.d"
+  "CMakeFiles/sptk.dir/src/window/kaiser_window.cc.o"
+  "CMakeFiles/sptk.dir/src/window/kaiser_window.cc.o.d"
+  "CMakeFiles/sptk.dir/src/window/standard_window.cc.o"
+  "CMakeFiles/sptk.dir/src/window/standard_window.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/Getopt/getoptwin.cc.o"
+  "CMakeFiles/sptk.dir/third_party/Getopt/getoptwin.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/core/file_resource.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/core/file_resource.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/core/float_matrix.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/core/float_matrix.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/core/track.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/core/track.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/epoch_tracker.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/epoch_tracker.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fd_filter.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fd_filter.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fft_reaper.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/fft_reaper.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/lpc_analyzer.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/epoch_tracker/lpc_analyzer.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/wave/codec_riff.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/wave/codec_riff.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave_io.cc.o"
+  "CMakeFiles/sptk.dir/third_party/REAPER/wave/wave_io.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/SWIPE/swipe.cc.o"
+  "CMakeFiles/sptk.dir/third_party/SWIPE/swipe.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/SWIPE/vector.cc.o"
+  "CMakeFiles/sptk.dir/third_party/SWIPE/vector.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/Snack/jkGetF0.cc.o"
+  "CMakeFiles/sptk.dir/third_party/Snack/jkGetF0.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/Snack/sigproc.cc.o"
+  "CMakeFiles/sptk.dir/third_party/Snack/sigproc.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/WORLD/common.cc.o"
+  "CMakeFiles/sptk.dir/third_party/WORLD/common.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/WORLD/dio.cc.o"
+  "CMakeFiles/sptk.dir/third_party/WORLD/dio.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/WORLD/fft_world.cc.o"
+  "CMakeFiles/sptk.dir/third_party/WORLD/fft_world.cc.o.d"
+  "CMakeFiles/sptk.dir/third_party/WORLD/matlabfunctions.cc.o"
+  "CMakeFiles/sptk.dir/third_party/WORLD/matlabfunctions.cc.o.d"
+  "libsptk.a"
+  "libsptk.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sptk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/step.dir/src/main/step.cc.o"
+  "CMakeFiles/step.dir/src/main/step.cc.o.d"
+  "step"
+  "step.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/step.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swab.dir/src/main/swab.cc.o"
+  "CMakeFiles/swab.dir/src/main/swab.cc.o.d"
+  "swab"
+  "swab.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symmetrize.dir/src/main/symmetrize.cc.o"
+  "CMakeFiles/symmetrize.dir/src/main/symmetrize.cc.o.d"
+  "symmetrize"
+  "symmetrize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symmetrize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/train.dir/src/main/train.cc.o"
+  "CMakeFiles/train.dir/src/main/train.cc.o.d"
+  "train"
+  "train.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/train.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
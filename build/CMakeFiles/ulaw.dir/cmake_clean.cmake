@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ulaw.dir/src/main/ulaw.cc.o"
+  "CMakeFiles/ulaw.dir/src/main/ulaw.cc.o.d"
+  "ulaw"
+  "ulaw.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ulaw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
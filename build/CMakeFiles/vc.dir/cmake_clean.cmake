@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vc.dir/src/main/vc.cc.o"
+  "CMakeFiles/vc.dir/src/main/vc.cc.o.d"
+  "vc"
+  "vc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vopr.dir/src/main/vopr.cc.o"
+  "CMakeFiles/vopr.dir/src/main/vopr.cc.o.d"
+  "vopr"
+  "vopr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vopr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
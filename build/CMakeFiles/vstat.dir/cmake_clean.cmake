@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vstat.dir/src/main/vstat.cc.o"
+  "CMakeFiles/vstat.dir/src/main/vstat.cc.o.d"
+  "vstat"
+  "vstat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vstat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsum.dir/src/main/vsum.cc.o"
+  "CMakeFiles/vsum.dir/src/main/vsum.cc.o.d"
+  "vsum"
+  "vsum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wav2mgc.dir/src/main/wav2mgc.cc.o"
+  "CMakeFiles/wav2mgc.dir/src/main/wav2mgc.cc.o.d"
+  "wav2mgc"
+  "wav2mgc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wav2mgc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/window.dir/src/main/window.cc.o"
+  "CMakeFiles/window.dir/src/main/window.cc.o.d"
+  "window"
+  "window.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/window.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/x2x.dir/src/main/x2x.cc.o"
+  "CMakeFiles/x2x.dir/src/main/x2x.cc.o.d"
+  "x2x"
+  "x2x.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/x2x.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zcross.dir/src/main/zcross.cc.o"
+  "CMakeFiles/zcross.dir/src/main/zcross.cc.o.d"
+  "zcross"
+  "zcross.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zcross.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
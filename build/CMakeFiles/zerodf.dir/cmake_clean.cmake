@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zerodf.dir/src/main/zerodf.cc.o"
+  "CMakeFiles/zerodf.dir/src/main/zerodf.cc.o.d"
+  "zerodf"
+  "zerodf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zerodf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -80,6 +80,12 @@ namespace sptk {
  * @endrst
  *
  * Note that the implemenation is based on an unpublished paper.
+ *
+ * If the warm start is enabled, the initial guess of the Newton-Raphson method
+ * is corrected by the half of the difference between the solution and the
+ * initial guess of the previous frame. Since the optimal @f$\tilde{c}(0)@f$
+ * makes @f$\tilde{r}(0)=1@f$, the iteration is restarted from the original
+ * initial guess if @f$|\tilde{r}(0)-1|@f$ increases.
  */
 class MelCepstralAnalysis {
  public:
@@ -105,6 +111,8 @@ class MelCepstralAnalysis {
     std::vector<double> rr_;
     std::vector<double> ra_;
     std::vector<double> gradient_;
+    std::vector<double> initial_guess_;
+    std::vector<double> correction_;
 
     RealValuedFastFourierTransform::Buffer buffer_for_fourier_transform_;
     RealValuedInverseFastFourierTransform::Buffer
@@ -123,9 +131,12 @@ class MelCepstralAnalysis {
    * @param[in] alpha All-pass constant, @f$\alpha@f$.
    * @param[in] num_iteration Number of iterations of Newton method, @f$J@f$.
    * @param[in] convergence_threshold Convergence threshold, @f$\epsilon@f$.
+   * @param[in] warm_start If true, the initial guess is corrected using the
+   *            result of the previous frame.
    */
   MelCepstralAnalysis(int fft_length, int num_order, double alpha,
-                      int num_iteration, double convergence_threshold);
+                      int num_iteration, double convergence_threshold,
+                      bool warm_start = false);
 
   virtual ~MelCepstralAnalysis() {
   }
@@ -165,6 +176,13 @@ class MelCepstralAnalysis {
     return convergence_threshold_;
   }
 
+  /**
+   * @return True if warm start is enabled.
+   */
+  bool GetWarmStartFlag() const {
+    return warm_start_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -175,7 +193,8 @@ class MelCepstralAnalysis {
   /**
    * @param[in] periodogram @f$(N/2+1)@f$-length periodogram.
    * @param[out] mel_cepstrum @f$M@f$-th order mel-cepstral coefficients.
-   * @param[out] buffer Buffer.
+   * @param[in,out] buffer Buffer. If warm start is enabled, the buffer must
+   *                be reused for consecutive frames.
    * @return True on success, false on failure.
    */
   bool Run(const std::vector<double>& periodogram,
@@ -183,11 +202,17 @@ class MelCepstralAnalysis {
            MelCepstralAnalysis::Buffer* buffer) const;
 
  private:
+  bool NewtonRaphsonMethod(bool is_warm_started,
+                           std::vector<double>* mel_cepstrum,
+                           MelCepstralAnalysis::Buffer* buffer,
+                           bool* is_diverged) const;
+
   const int fft_length_;
   const int num_order_;
   const double alpha_;
   const int num_iteration_;
   const double convergence_threshold_;
+  const bool warm_start_;
 
   const RealValuedFastFourierTransform fourier_transform_;
   const RealValuedInverseFastFourierTransform inverse_fourier_transform_;
@@ -68,6 +68,11 @@ namespace sptk {
  * @f[
  *   \tilde{z}^{-1} = \frac{z^{-1} - \alpha}{1 - \alpha z^{-1}}.
  * @f]
+ *
+ * If the warm start is enabled, the initial guess of the gradient method is
+ * corrected by the half of the difference between the solution and the initial
+ * guess of the previous frame. The iteration is restarted from the original
+ * initial guess if the criterion increases.
  */
 class MelGeneralizedCepstralAnalysis {
  public:
@@ -101,6 +106,8 @@ class MelGeneralizedCepstralAnalysis {
     std::vector<double> buffer_for_frequency_transform_;
     std::vector<double> periodogram_;
     std::vector<double> gradient_;
+    std::vector<double> initial_guess_;
+    std::vector<double> correction_;
 
     RealValuedFastFourierTransform::Buffer buffer_for_fourier_transform_;
     RealValuedInverseFastFourierTransform::Buffer
@@ -121,10 +128,13 @@ class MelGeneralizedCepstralAnalysis {
    * @param[in] gamma Exponent parameter, @f$\gamma@f$.
    * @param[in] num_iteration Number of iterations of Newton method, @f$J@f$.
    * @param[in] convergence_threshold Convergence threshold, @f$\epsilon@f$.
+   * @param[in] warm_start If true, the initial guess is corrected using the
+   *            result of the previous frame.
    */
   MelGeneralizedCepstralAnalysis(int fft_length, int num_order, double alpha,
                                  double gamma, int num_iteration,
-                                 double convergence_threshold);
+                                 double convergence_threshold,
+                                 bool warm_start = false);
 
   virtual ~MelGeneralizedCepstralAnalysis() {
     if (mel_cepstral_analysis_) delete mel_cepstral_analysis_;
@@ -172,6 +182,13 @@ class MelGeneralizedCepstralAnalysis {
     return convergence_threshold_;
   }
 
+  /**
+   * @return True if warm start is enabled.
+   */
+  bool GetWarmStartFlag() const {
+    return warm_start_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -183,7 +200,8 @@ class MelGeneralizedCepstralAnalysis {
    * @param[in] periodogram @f$(N/2+1)@f$-length periodogram.
    * @param[out] mel_generalized_cepstrum @f$M@f$-th order mel-generalized
    *             cepstral coefficients.
-   * @param[out] buffer Buffer.
+   * @param[in,out] buffer Buffer. If warm start is enabled, the buffer must
+   *                be reused for consecutive frames.
    * @return True on success, false on failure.
    */
   bool Run(const std::vector<double>& periodogram,
@@ -191,6 +209,11 @@ class MelGeneralizedCepstralAnalysis {
            MelGeneralizedCepstralAnalysis::Buffer* buffer) const;
 
  private:
+  bool UpdateCoefficients(bool is_warm_started, double initial_epsilon,
+                          MelGeneralizedCepstralAnalysis::Buffer* buffer,
+                          bool* is_diverged) const;
+
+
   bool NewtonRaphsonMethod(
       double gamma, double* epsilon,
       MelGeneralizedCepstralAnalysis::Buffer* buffer) const;
@@ -201,6 +224,7 @@ class MelGeneralizedCepstralAnalysis {
   const double gamma_;
   const int num_iteration_;
   const double convergence_threshold_;
+  const bool warm_start_;
 
   const RealValuedFastFourierTransform fourier_transform_;
   const RealValuedInverseFastFourierTransform inverse_fourier_transform_;
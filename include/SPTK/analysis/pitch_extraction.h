@@ -55,6 +55,25 @@ class PitchExtraction {
    */
   enum Algorithms { kRapt = 0, kSwipe, kReaper, kWorld, kNumAlgorithms };
 
+  /**
+   * Buffer for streaming mode of PitchExtraction class.
+   */
+  class Buffer {
+   public:
+    Buffer() : buffer_(NULL) {
+    }
+
+    virtual ~Buffer() {
+      delete buffer_;
+    }
+
+   private:
+    PitchExtractionInterface::Buffer* buffer_;
+
+    friend class PitchExtraction;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
   /**
    * @param[in] frame_shift Frame shift in point.
    * @param[in] sampling_rate Sampling rate in Hz.
@@ -104,6 +123,38 @@ class PitchExtraction {
             pitch_extraction_->Get(waveform, f0, epochs, polarity));
   }
 
+  /**
+   * @return True if the algorithm supports streaming mode.
+   */
+  bool IsStreamable() const {
+    return (NULL != pitch_extraction_ && pitch_extraction_->IsStreamable());
+  }
+
+  /**
+   * Extract pitch from a chunk of waveform in streaming mode.
+   *
+   * @param[in] waveform Waveform samples following the previous chunk.
+   * @param[in] is_last_chunk If true, the chunk is treated as the end of
+   *            waveform.
+   * @param[out] f0 Extracted pitch of finalized frames in Hz.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& waveform, bool is_last_chunk,
+           std::vector<double>* f0, PitchExtraction::Buffer* buffer) const {
+    if (NULL == pitch_extraction_ || NULL == buffer) {
+      return false;
+    }
+    if (NULL == buffer->buffer_) {
+      buffer->buffer_ = pitch_extraction_->CreateBuffer();
+      if (NULL == buffer->buffer_) {
+        return false;
+      }
+    }
+    return pitch_extraction_->GetIncrementally(waveform, is_last_chunk, f0,
+                                               buffer->buffer_);
+  }
+
  private: // visible only inside the class
   PitchExtractionInterface* pitch_extraction_;
 
@@ -17,18 +17,44 @@
 #ifndef SPTK_ANALYSIS_PITCH_EXTRACTION_BY_RAPT_H_
 #define SPTK_ANALYSIS_PITCH_EXTRACTION_BY_RAPT_H_
 
-#include <vector>  // std::vector
+#include <cstdint>  // std::int64_t
+#include <vector>   // std::vector
 
 #include "SPTK/analysis/pitch_extraction_interface.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
 
+namespace snack {
+struct f0_stream;
+}  // namespace snack
+
 /**
  * Extract pitch based on RAPT.
  */
 class PitchExtractionByRapt : public PitchExtractionInterface {
  public:
+  /**
+   * Buffer for streaming mode of PitchExtractionByRapt class.
+   */
+  class Buffer : public PitchExtractionInterface::Buffer {
+   public:
+    Buffer() : stream_(NULL), num_sample_(0), num_frame_(0), last_f0_(0.0) {
+    }
+
+    virtual ~Buffer();
+
+   private:
+    snack::f0_stream* stream_;
+    std::int64_t num_sample_;
+    std::int64_t num_frame_;
+    double last_f0_;
+    std::vector<double> f0_;
+
+    friend class PitchExtractionByRapt;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
   /**
    * @param[in] frame_shift Frame shift in point.
    * @param[in] sampling_rate Sampling rate in Hz.
@@ -94,6 +120,35 @@ class PitchExtractionByRapt : public PitchExtractionInterface {
                    std::vector<double>* epochs,
                    PitchExtractionInterface::Polarity* polarity) const;
 
+  /**
+   * @return True.
+   */
+  virtual bool IsStreamable() const {
+    return true;
+  }
+
+  /**
+   * @return Buffer for streaming mode.
+   */
+  virtual PitchExtractionInterface::Buffer* CreateBuffer() const {
+    return new PitchExtractionByRapt::Buffer();
+  }
+
+  /**
+   * Extract pitch from a chunk of waveform. The concatenation of the outputs
+   * is the same as the output of Get() given the whole waveform.
+   *
+   * @param[in] waveform Waveform samples following the previous chunk.
+   * @param[in] is_last_chunk If true, the chunk is treated as the end of
+   *            waveform.
+   * @param[out] f0 Extracted pitch of finalized frames in Hz.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  virtual bool GetIncrementally(const std::vector<double>& waveform,
+                                bool is_last_chunk, std::vector<double>* f0,
+                                PitchExtractionInterface::Buffer* buffer) const;
+
  private:
   const int frame_shift_;
   const double sampling_rate_;
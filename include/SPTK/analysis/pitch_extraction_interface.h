@@ -17,7 +17,8 @@
 #ifndef SPTK_ANALYSIS_PITCH_EXTRACTION_INTERFACE_H_
 #define SPTK_ANALYSIS_PITCH_EXTRACTION_INTERFACE_H_
 
-#include <vector>  // std::vector
+#include <cstddef>  // NULL
+#include <vector>   // std::vector
 
 namespace sptk {
 
@@ -35,6 +36,15 @@ class PitchExtractionInterface {
     kNegative,
   };
 
+  /**
+   * Buffer for streaming pitch extraction.
+   */
+  class Buffer {
+   public:
+    virtual ~Buffer() {
+    }
+  };
+
   virtual ~PitchExtractionInterface() {
   }
 
@@ -52,6 +62,39 @@ class PitchExtractionInterface {
    */
   virtual bool Get(const std::vector<double>& waveform, std::vector<double>* f0,
                    std::vector<double>* epochs, Polarity* polarity) const = 0;
+
+  /**
+   * @return True if streaming mode is supported.
+   */
+  virtual bool IsStreamable() const {
+    return false;
+  }
+
+  /**
+   * Create buffer for streaming mode.
+   *
+   * @return Buffer, or NULL if streaming mode is not supported. The returned
+   *         buffer must be deleted by the caller.
+   */
+  virtual Buffer* CreateBuffer() const {
+    return NULL;
+  }
+
+  /**
+   * Extract F0 from a chunk of waveform in streaming mode.
+   *
+   * @param[in] waveform Waveform samples following the previous chunk.
+   * @param[in] is_last_chunk If true, the chunk is treated as the end of
+   *            waveform and all remaining frames are output.
+   * @param[out] f0 F0 of frames finalized by this call.
+   * @param[in,out] buffer Buffer created by CreateBuffer().
+   * @return True on success, false on failure.
+   */
+  virtual bool GetIncrementally(const std::vector<double>& waveform,
+                                bool is_last_chunk, std::vector<double>* f0,
+                                Buffer* buffer) const {
+    return false;
+  }
 };
 
 }  // namespace sptk
@@ -0,0 +1,118 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_ANALYSIS_PITCH_EXTRACTION_WITH_VOTING_H_
+#define SPTK_ANALYSIS_PITCH_EXTRACTION_WITH_VOTING_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/analysis/pitch_extraction.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Extract pitch by voting of multiple algorithms.
+ *
+ * The algorithms are run concurrently on the same waveform, and their log F0s
+ * are fused by the median filter across the algorithms in the same way as
+ *
+ * @code{.sh}
+ *   medfilt -l K -k N -magic -1e+10 -w 1
+ * @endcode
+ *
+ * where @f$K@f$ is the number of algorithms and @f$N@f$ is the order of the
+ * filter. Let @f$K_t@f$ be the number of the algorithms which regard the
+ * @f$t@f$-th frame as voiced. If @f$N=0@f$, the frame is voiced if
+ * @f$K/2 \le K_t@f$, and the F0 of a voiced frame is given by the median of
+ * the @f$K_t@f$ voiced log F0s. If @f$N>0@f$, the estimates of @f$N+1@f$
+ * neighboring frames are pooled before the voting. The frames beyond the end
+ * of a shorter result are regarded as unvoiced.
+ */
+class PitchExtractionWithVoting {
+ public:
+  /**
+   * @param[in] frame_shift Frame shift in point.
+   * @param[in] sampling_rate Sampling rate in Hz.
+   * @param[in] lower_f0 Lower bound of F0 in Hz.
+   * @param[in] upper_f0 Upper bound of F0 in Hz.
+   * @param[in] voicing_thresholds Thresholds for determining voiced/unvoiced
+   *            of each algorithm.
+   * @param[in] algorithms Algorithms used for pitch extraction. The same
+   *            algorithm must not be given twice.
+   * @param[in] num_filter_order Order of median filter, @f$N@f$.
+   * @param[in] num_thread Maximum number of threads.
+   */
+  PitchExtractionWithVoting(
+      int frame_shift, double sampling_rate, double lower_f0, double upper_f0,
+      const std::vector<double>& voicing_thresholds,
+      const std::vector<PitchExtraction::Algorithms>& algorithms,
+      int num_filter_order, int num_thread);
+
+  virtual ~PitchExtractionWithVoting();
+
+  /**
+   * @return Number of algorithms.
+   */
+  int GetNumAlgorithm() const {
+    return static_cast<int>(pitch_extractions_.size());
+  }
+
+  /**
+   * @return Order of median filter.
+   */
+  int GetNumFilterOrder() const {
+    return num_filter_order_;
+  }
+
+  /**
+   * @return Maximum number of threads.
+   */
+  int GetNumThread() const {
+    return num_thread_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[in] waveform Waveform.
+   * @param[out] f0 Fused pitch in Hz.
+   * @param[out] elapsed_times Elapsed time of each algorithm in seconds
+   *             (optional).
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& waveform, std::vector<double>* f0,
+           std::vector<double>* elapsed_times) const;
+
+ private:
+  const int num_filter_order_;
+  const int num_thread_;
+
+  std::vector<PitchExtraction*> pitch_extractions_;
+
+  bool is_valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(PitchExtractionWithVoting);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_ANALYSIS_PITCH_EXTRACTION_WITH_VOTING_H_
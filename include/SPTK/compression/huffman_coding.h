@@ -41,14 +41,19 @@ namespace sptk {
  * @f]
  * where @f$c(n) \in \{0,1\}^{\ast}@f$.
  *
- * The implementation is based on priority queue.
+ * The implementation is based on priority queue. If the canonical form is
+ * used, only the code lengths are taken from the Huffman tree, and the
+ * codewords are reassigned in ascending order of code length and symbol
+ * index. The canonical codewords keep the average code length, and are
+ * uniquely determined by the code lengths.
  */
 class HuffmanCoding {
  public:
   /**
    * @param[in] num_element Number of elements.
+   * @param[in] canonical If true, canonical codewords are generated.
    */
-  explicit HuffmanCoding(int num_element);
+  HuffmanCoding(int num_element, bool canonical = false);
 
   virtual ~HuffmanCoding() {
   }
@@ -60,6 +65,13 @@ class HuffmanCoding {
     return num_element_;
   }
 
+  /**
+   * @return True if canonical codewords are generated.
+   */
+  bool GetCanonicalFlag() const {
+    return canonical_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -76,6 +88,7 @@ class HuffmanCoding {
 
  private:
   const int num_element_;
+  const bool canonical_;
 
   bool is_valid_;
 
@@ -18,6 +18,7 @@
 #define SPTK_COMPRESSION_HUFFMAN_DECODING_H_
 
 #include <fstream>  // std::ifstream
+#include <vector>   // std::vector
 
 #include "SPTK/utils/sptk_utils.h"
 
@@ -27,6 +28,11 @@ namespace sptk {
  * Decode symbols from binary sequence.
  *
  * The input is a codeword and the output is the corresponding symbol.
+ *
+ * The code tree is stored in a flat node array. In addition to the bitwise
+ * decoding, eight bits packed in a byte can be decoded at once. For each
+ * internal node, a lookup table that maps a byte to the decoded symbols and the
+ * next node is built when the node is reached for the first time.
  */
 class HuffmanDecoding {
  public:
@@ -36,7 +42,6 @@ class HuffmanDecoding {
   explicit HuffmanDecoding(std::ifstream* input_stream);
 
   virtual ~HuffmanDecoding() {
-    Free(root_);
   }
 
   /**
@@ -53,24 +58,43 @@ class HuffmanDecoding {
    */
   bool Get(bool input, int* output, bool* is_leaf);
 
+  /**
+   * @param[in] input Eight bits. The most significant bit is decoded first.
+   * @param[out] outputs Decoded symbols. The last codeword may be continued to
+   *             the next byte.
+   * @return True on success, false on failure.
+   */
+  bool Get(unsigned char input, std::vector<int>* outputs);
+
  private:
   struct Node {
-    Node* left;
-    Node* right;
+    int children[2];
     int symbol;
   };
 
-  void Free(Node* node) {
-    if (NULL == node) return;
-    Free(node->left);
-    Free(node->right);
-    delete node;
+  struct Transition {
+    int next_node;
+    int num_symbol;
+    int offset;
+  };
+
+  bool IsLeaf(int node) const {
+    return (root_ != node && nodes_[node].children[0] < 0 &&
+            nodes_[node].children[1] < 0);
   }
 
+  int BuildTable(int node);
+
   bool is_valid_;
 
-  Node* root_;
-  Node* curr_node_;
+  const int root_;
+
+  int curr_node_;
+
+  std::vector<Node> nodes_;
+  std::vector<int> table_indices_;
+  std::vector<Transition> transitions_;
+  std::vector<int> symbols_;
 
   DISALLOW_COPY_AND_ASSIGN(HuffmanDecoding);
 };
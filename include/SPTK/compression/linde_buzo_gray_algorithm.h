@@ -19,8 +19,6 @@
 
 #include <vector>  // std::vector
 
-#include "SPTK/compression/vector_quantization.h"
-#include "SPTK/math/distance_calculation.h"
 #include "SPTK/math/statistics_accumulation.h"
 #include "SPTK/utils/sptk_utils.h"
 
@@ -78,6 +76,12 @@ namespace sptk {
  * of input vectors.
  * - Step 4: Set @f$I \leftarrow 2I@f$. If @f$I \ge I_E@f$ exit, otherwise go to
  * Step 1.
+ *
+ * The nearest codebook vector search in Step 2 is accelerated by Hamerly's
+ * triangle-inequality bounds, so that the search is skipped for the input
+ * vectors whose assignment can not change. The remaining searches use partial
+ * distance elimination and can be run in multiple threads. The result does
+ * not depend on the number of threads.
  */
 class LindeBuzoGrayAlgorithm {
  public:
@@ -91,12 +95,13 @@ class LindeBuzoGrayAlgorithm {
    * @param[in] convergence_threshold Convergence threshold, @f$\varepsilon@f$.
    * @param[in] splitting_factor Splitting factor, @f$r@f$.
    * @param[in] seed Random seed.
+   * @param[in] num_thread Number of threads.
    */
   LindeBuzoGrayAlgorithm(int num_order, int initial_codebook_size,
                          int target_codebook_size,
                          int min_num_vector_in_cluster, int num_iteration,
                          double convergence_threshold, double splitting_factor,
-                         int seed);
+                         int seed, int num_thread = 1);
 
   virtual ~LindeBuzoGrayAlgorithm() {
   }
@@ -157,6 +162,13 @@ class LindeBuzoGrayAlgorithm {
     return seed_;
   }
 
+  /**
+   * @return Number of threads.
+   */
+  int GetNumThread() const {
+    return num_thread_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -177,6 +189,13 @@ class LindeBuzoGrayAlgorithm {
            std::vector<int>* codebook_indices) const;
 
  private:
+  void AssignInputVectors(
+      const std::vector<std::vector<double> >& input_vectors,
+      const std::vector<std::vector<double> >& codebook_vectors,
+      const std::vector<double>& half_min_distances,
+      std::vector<int>* codebook_indices, std::vector<double>* distances,
+      std::vector<double>* lower_bounds) const;
+
   const int num_order_;
   const int initial_codebook_size_;
   const int target_codebook_size_;
@@ -185,10 +204,9 @@ class LindeBuzoGrayAlgorithm {
   const double convergence_threshold_;
   const double splitting_factor_;
   const int seed_;
+  const int num_thread_;
 
-  const DistanceCalculation distance_calculation_;
   const StatisticsAccumulation statistics_accumulation_;
-  const VectorQuantization vector_quantization_;
 
   bool is_valid_;
 
@@ -19,7 +19,6 @@
 
 #include <vector>  // std::vector
 
-#include "SPTK/math/distance_calculation.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -44,6 +43,8 @@ namespace sptk {
  * @f[
  *   \mathop{\mathrm{argmin}}_i \sum_{i=0}^{I-1} \sum_{m=0}^M (x(m) - c_i(m))^2.
  * @f]
+ * The summation for a codebook vector is terminated as soon as the partial
+ * distance exceeds the current minimum distance.
  */
 class VectorQuantization {
  public:
@@ -82,7 +83,6 @@ class VectorQuantization {
 
  private:
   const int num_order_;
-  const DistanceCalculation distance_calculation_;
 
   bool is_valid_;
 
@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -92,7 +93,20 @@ class LinearPredictiveCoefficientsToCepstrum {
   bool Run(const std::vector<double>& linear_predictive_coefficients,
            std::vector<double>* cepstrum) const;
 
+  /**
+   * Convert a block of frames. Each row of the matrices holds one frame.
+   *
+   * @param[in] linear_predictive_coefficients @f$M_1@f$-th order LPC
+   *            coefficients.
+   * @param[out] cepstrum @f$M_2@f$-th order cepstral coefficients.
+   * @return True on success, false on failure.
+   */
+  bool RunBatch(const Matrix& linear_predictive_coefficients,
+                Matrix* cepstrum) const;
+
  private:
+  void Convert(const double* input, double* output) const;
+
   const int num_input_order_;
   const int num_output_order_;
 
@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -39,6 +40,20 @@ namespace sptk {
  *   \end{array}
  * @f]
  * The LSP coefficients are obtained by an iterative root finding algorithm.
+ * The symmetric and antisymmetric polynomials are expressed as Chebyshev
+ * series in @f$x = \cos \omega@f$, and their roots are found by either
+ * of the two algorithms:
+ *
+ * - Grid search: the interval @f$[-1, 1]@f$ is scanned on a fixed grid and
+ *   each sign change is refined by bisection. Roots closer than the grid
+ *   spacing may be missed.
+ * - Newton method: the roots are found one by one in descending order of
+ *   @f$x@f$ by the Newton method with implicit deflation of the already found
+ *   roots. Since the roots of the two polynomials interlace, the previous root
+ *   of the other polynomial is used as the starting point, from which the
+ *   iteration monotonically converges to the next root. If the iteration does
+ *   not converge, the root is found by the grid search from the starting
+ *   point instead.
  *
  * [1] P. Kabal and R. P. Ramachandran, &quot;The computation of line spectral
  *     frequencies using Chebyshev polynomials,&quot; IEEE Transactions on
@@ -47,6 +62,11 @@ namespace sptk {
  */
 class LinearPredictiveCoefficientsToLineSpectralPairs {
  public:
+  /**
+   * Root finding algorithm.
+   */
+  enum Algorithms { kGridSearch = 0, kNewtonMethod, kNumAlgorithms };
+
   /**
    * Buffer for LinearPredictiveCoefficientsToLineSpectralPairs class.
    */
@@ -61,6 +81,9 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
    private:
     std::vector<double> c1_;
     std::vector<double> c2_;
+    std::vector<double> x1_;
+    std::vector<double> x2_;
+    std::vector<double> frame_;
 
     friend class LinearPredictiveCoefficientsToLineSpectralPairs;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -68,13 +91,15 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
 
   /**
    * @param[in] num_order Order of coefficients, @f$M@f$.
-   * @param[in] num_split Number of splits of unit circle.
-   * @param[in] num_iteration Number of iterations.
+   * @param[in] num_split Number of splits of unit circle. This is used in the
+   *            grid search and the fallback of the Newton method.
+   * @param[in] num_iteration Number of iterations for each root.
    * @param[in] convergence_threshold Convergence threshold.
+   * @param[in] algorithm Root finding algorithm.
    */
-  LinearPredictiveCoefficientsToLineSpectralPairs(int num_order, int num_split,
-                                                  int num_iteration,
-                                                  double convergence_threshold);
+  LinearPredictiveCoefficientsToLineSpectralPairs(
+      int num_order, int num_split, int num_iteration,
+      double convergence_threshold, Algorithms algorithm = kGridSearch);
 
   virtual ~LinearPredictiveCoefficientsToLineSpectralPairs() {
   }
@@ -107,6 +132,13 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
     return convergence_threshold_;
   }
 
+  /**
+   * @return Root finding algorithm.
+   */
+  Algorithms GetAlgorithm() const {
+    return algorithm_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -134,13 +166,35 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
       std::vector<double>* input_and_output,
       LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const;
 
+  /**
+   * Convert a block of frames. Each row of the matrices holds one frame.
+   * The output may be the same object as the input.
+   *
+   * @param[in] linear_predictive_coefficients @f$M@f$-th order LPC.
+   * @param[out] line_spectral_pairs @f$M@f$-th order LSP.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool RunBatch(
+      const Matrix& linear_predictive_coefficients, Matrix* line_spectral_pairs,
+      LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const;
+
  private:
+  bool RunGridSearch(
+      LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer,
+      double* w) const;
+
+  bool RunNewtonMethod(
+      LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer,
+      double* w) const;
+
   const int num_order_;
   const int num_symmetric_polynomial_order_;
   const int num_asymmetric_polynomial_order_;
   const int num_split_;
   const int num_iteration_;
   const double convergence_threshold_;
+  const Algorithms algorithm_;
 
   bool is_valid_;
 
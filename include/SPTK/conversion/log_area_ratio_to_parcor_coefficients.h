@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -82,6 +83,17 @@ class LogAreaRatioToParcorCoefficients {
    */
   bool Run(std::vector<double>* input_and_output) const;
 
+  /**
+   * Convert a block of frames. Each row of the matrices holds one frame.
+   * The output may be the same object as the input.
+   *
+   * @param[in] log_area_ratio @f$M@f$-th order log area ratio.
+   * @param[out] parcor_coefficients @f$M@f$-th order PARCOR coefficients.
+   * @return True on success, false on failure.
+   */
+  bool RunBatch(const Matrix& log_area_ratio,
+                Matrix* parcor_coefficients) const;
+
  private:
   const int num_order_;
 
@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/math/frequency_transform.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -113,6 +114,8 @@ class MelGeneralizedCepstrumToMelGeneralizedCepstrum {
    private:
     FrequencyTransform::Buffer frequency_transform_buffer_;
     std::vector<double> temporary_mel_generalized_cepstrum_;
+    std::vector<double> input_;
+    std::vector<double> output_;
 
     friend class MelGeneralizedCepstrumToMelGeneralizedCepstrum;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -255,6 +258,18 @@ class MelGeneralizedCepstrumToMelGeneralizedCepstrum {
       const std::vector<double>& input, std::vector<double>* output,
       MelGeneralizedCepstrumToMelGeneralizedCepstrum::Buffer* buffer) const;
 
+  /**
+   * Convert a block of frames. Each row of the matrices holds one frame.
+   *
+   * @param[in] input @f$M_1@f$-th order mel-generalized cepstrum.
+   * @param[out] output @f$M_2@f$-th order mel-generalized cepstrum.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool RunBatch(
+      const Matrix& input, Matrix* output,
+      MelGeneralizedCepstrumToMelGeneralizedCepstrum::Buffer* buffer) const;
+
  private:
   const int num_input_order_;
   const double input_alpha_;
@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -116,7 +117,22 @@ class ParcorCoefficientsToLinearPredictiveCoefficients {
       std::vector<double>* input_and_output,
       ParcorCoefficientsToLinearPredictiveCoefficients::Buffer* buffer) const;
 
+  /**
+   * Convert a block of frames. Each row of the matrices holds one frame.
+   *
+   * @param[in] parcor_coefficients @f$M@f$-th order PARCOR coefficients.
+   * @param[out] linear_predictive_coefficients @f$M@f$-th order LPC
+   *             coefficients.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool RunBatch(
+      const Matrix& parcor_coefficients, Matrix* linear_predictive_coefficients,
+      ParcorCoefficientsToLinearPredictiveCoefficients::Buffer* buffer) const;
+
  private:
+  void Convert(const double* k, double* a, double* prev_a) const;
+
   const int num_order_;
 
   bool is_valid_;
@@ -0,0 +1,170 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_CONVERSION_WAVEFORM_TO_MEL_GENERALIZED_CEPSTRUM_H_
+#define SPTK_CONVERSION_WAVEFORM_TO_MEL_GENERALIZED_CEPSTRUM_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/analysis/mel_generalized_cepstral_analysis.h"
+#include "SPTK/conversion/generalized_cepstrum_gain_normalization.h"
+#include "SPTK/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.h"
+#include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/window_interface.h"
+
+namespace sptk {
+
+/**
+ * Convert framed waveform to mel-generalized cepstrum.
+ *
+ * This class fuses the data windowing, the power spectrum calculation, and
+ * the mel-generalized cepstral analysis into one step:
+ * @f[
+ *   x(0), \ldots, x(L-1) \;\rightarrow\;
+ *   w(0)x(0), \ldots, w(L-1)x(L-1), 0, \ldots, 0 \;\rightarrow\;
+ *   |X(0)|^2, \ldots, |X(N/2)|^2 \;\rightarrow\;
+ *   c_{\alpha,\gamma}(0), \ldots, c_{\alpha,\gamma}(M),
+ * @f]
+ * where @f$w(l)@f$ is a window function and @f$N@f$ is the FFT length.
+ * The result is the same as that of the pipeline of DataWindowing,
+ * WaveformToSpectrum, and MelGeneralizedCepstralAnalysis, but no intermediate
+ * data is serialized.
+ */
+class WaveformToMelGeneralizedCepstrum {
+ public:
+  /**
+   * Output format.
+   */
+  enum OutputFormats {
+    kCepstrum = 0,
+    kMlsaFilterCoefficients,
+    kGainNormalizedCepstrum,
+    kGainNormalizedMlsaFilterCoefficients,
+    kNumOutputFormats
+  };
+
+  /**
+   * Buffer for WaveformToMelGeneralizedCepstrum class.
+   */
+  class Buffer {
+   public:
+    Buffer() {
+    }
+
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<double> windowed_waveform_;
+    std::vector<double> power_spectrum_;
+
+    WaveformToSpectrum::Buffer buffer_for_spectral_analysis_;
+    MelGeneralizedCepstralAnalysis::Buffer buffer_for_cepstral_analysis_;
+
+    friend class WaveformToMelGeneralizedCepstrum;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  /**
+   * @param[in] window @f$L@f$-length window to be used.
+   * @param[in] normalization_type Type of window normalization.
+   * @param[in] fft_length Number of FFT bins, @f$N@f$.
+   * @param[in] num_order Order of cepstral coefficients, @f$M@f$.
+   * @param[in] alpha All-pass constant, @f$\alpha@f$.
+   * @param[in] gamma Exponent parameter, @f$\gamma@f$.
+   * @param[in] num_iteration Number of iterations of Newton method, @f$J@f$.
+   * @param[in] convergence_threshold Convergence threshold, @f$\epsilon@f$.
+   * @param[in] epsilon Small value added to power spectrum.
+   * @param[in] relative_floor_in_decibels Relative floor in decibels.
+   * @param[in] output_format Output format.
+   */
+  WaveformToMelGeneralizedCepstrum(
+      WindowInterface* window,
+      DataWindowing::NormalizationType normalization_type, int fft_length,
+      int num_order, double alpha, double gamma, int num_iteration,
+      double convergence_threshold, double epsilon,
+      double relative_floor_in_decibels, OutputFormats output_format);
+
+  virtual ~WaveformToMelGeneralizedCepstrum() {
+  }
+
+  /**
+   * @return Frame length.
+   */
+  int GetFrameLength() const {
+    return data_windowing_.GetInputLength();
+  }
+
+  /**
+   * @return FFT length.
+   */
+  int GetFftLength() const {
+    return mel_generalized_cepstral_analysis_.GetFftLength();
+  }
+
+  /**
+   * @return Order of coefficients.
+   */
+  int GetNumOrder() const {
+    return mel_generalized_cepstral_analysis_.GetNumOrder();
+  }
+
+  /**
+   * @return Output format.
+   */
+  OutputFormats GetOutputFormat() const {
+    return output_format_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[in] waveform @f$L@f$-length framed waveform.
+   * @param[out] mel_generalized_cepstrum @f$M@f$-th order mel-generalized
+   *             cepstral coefficients.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& waveform,
+           std::vector<double>* mel_generalized_cepstrum,
+           WaveformToMelGeneralizedCepstrum::Buffer* buffer) const;
+
+ private:
+  const OutputFormats output_format_;
+
+  const DataWindowing data_windowing_;
+  const WaveformToSpectrum waveform_to_spectrum_;
+  const MelGeneralizedCepstralAnalysis mel_generalized_cepstral_analysis_;
+  const MelCepstrumToMlsaDigitalFilterCoefficients
+      mel_cepstrum_to_mlsa_digital_filter_coefficients_;
+  const GeneralizedCepstrumGainNormalization
+      generalized_cepstrum_gain_normalization_;
+
+  bool is_valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(WaveformToMelGeneralizedCepstrum);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_CONVERSION_WAVEFORM_TO_MEL_GENERALIZED_CEPSTRUM_H_
@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/filter/all_zero_digital_filter.h"
+#include "SPTK/math/fourier_transform.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -54,6 +55,16 @@ namespace sptk {
  * @f]
  * is the shifted impulse response of an ideal lowpass filter. The optimal
  * angular frequency @f$\omega@f$ is calculated based on a simple algorithm.
+ *
+ * The signal can also be reconstructed from the decimated subband signals.
+ * Each input vector is inversely cosine-modulated to the @f$2K@f$-periodic
+ * sequence @f$m(r)@f$, and
+ * @f[
+ *   K (-1)^{\lfloor n/2K \rfloor} h(n) \, m(n \bmod 2K)
+ * @f]
+ * is overlap-added to the output with the shift of @f$K@f$ samples. The
+ * result is the same as that of the zero insertion by the factor of @f$K@f$
+ * followed by the sample-by-sample synthesis.
  */
 class InversePseudoQuadratureMirrorFilterBanks {
  public:
@@ -76,6 +87,11 @@ class InversePseudoQuadratureMirrorFilterBanks {
    private:
     std::vector<AllZeroDigitalFilter::Buffer*> buffer_for_all_zero_filter_;
 
+    std::vector<double> signals_;
+    std::vector<double> real_part_;
+    std::vector<double> imag_part_;
+    FourierTransform::Buffer buffer_for_fourier_transform_;
+
     friend class InversePseudoQuadratureMirrorFilterBanks;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
@@ -135,13 +151,29 @@ class InversePseudoQuadratureMirrorFilterBanks {
   bool Run(const std::vector<double>& input, double* output,
            InversePseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
 
+  /**
+   * @param[in] input Input decimated subband signals.
+   * @param[out] output @f$K@f$ samples of output signal.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& input, std::vector<double>* output,
+           InversePseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
+
  private:
   const int num_subband_;
   const AllZeroDigitalFilter all_zero_filter_;
+  const FourierTransform fourier_transform_;
 
   bool is_valid_;
   bool is_converged_;
   std::vector<std::vector<double> > filter_banks_;
+  std::vector<double> prototype_filter_;
+
+  std::vector<double> pre_twiddle_real_;
+  std::vector<double> pre_twiddle_imag_;
+  std::vector<double> post_twiddle_real_;
+  std::vector<double> post_twiddle_imag_;
 
   DISALLOW_COPY_AND_ASSIGN(InversePseudoQuadratureMirrorFilterBanks);
 };
@@ -17,16 +17,20 @@
 #ifndef SPTK_FILTER_MEDIAN_FILTER_H_
 #define SPTK_FILTER_MEDIAN_FILTER_H_
 
-#include <deque>   // std::deque
 #include <vector>  // std::vector
 
 #include "SPTK/input/input_source_interface.h"
+#include "SPTK/math/median_accumulation.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
 
 /**
  * Apply a median filter to signals.
+ *
+ * The median of the sliding window is incrementally updated when a vector
+ * enters or leaves the window, so that the cost per output is
+ * @f$O(\log K)@f$, where @f$K@f$ is the window size.
  */
 class MedianFilter : public InputSourceInterface {
  public:
@@ -43,6 +47,11 @@ class MedianFilter : public InputSourceInterface {
                bool use_magic_number, double magic_number = 0.0);
 
   virtual ~MedianFilter() {
+    for (std::vector<MedianAccumulation::Buffer*>::iterator itr(
+             buffer_for_median_accumulation_.begin());
+         itr != buffer_for_median_accumulation_.end(); ++itr) {
+      delete (*itr);
+    }
   }
 
   /**
@@ -88,6 +97,8 @@ class MedianFilter : public InputSourceInterface {
 
  private:
   bool Forward();
+  bool Push(const std::vector<double>& input_vector);
+  bool Pop();
 
   const int num_input_order_;
   const int num_filter_order_;
@@ -96,13 +107,19 @@ class MedianFilter : public InputSourceInterface {
   const bool use_magic_number_;
   const double magic_number_;
 
+  const MedianAccumulation median_accumulation_;
+
   bool is_valid_;
 
   std::vector<double> buffer_;
-  std::vector<double> flat_;
-  std::deque<std::vector<double> > queue_;
+  std::vector<std::vector<double> > queue_;
+  int queue_begin_;
+  int queue_size_;
   int count_down_;
 
+  std::vector<int> num_magic_numbers_;
+  std::vector<MedianAccumulation::Buffer*> buffer_for_median_accumulation_;
+
   DISALLOW_COPY_AND_ASSIGN(MedianFilter);
 };
 
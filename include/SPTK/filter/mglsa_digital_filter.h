@@ -79,6 +79,8 @@ class MglsaDigitalFilter {
 
    private:
     std::vector<double> signals_;
+    std::vector<double> coefficients_;
+    std::vector<double> increments_;
     MlsaDigitalFilter::Buffer mlsa_digital_filter_buffer_;
 
     friend class MglsaDigitalFilter;
@@ -160,7 +162,38 @@ class MglsaDigitalFilter {
   bool Run(const std::vector<double>& filter_coefficients,
            double* input_and_output, MglsaDigitalFilter::Buffer* buffer) const;
 
+  /**
+   * Filter a block of signals in one call.
+   *
+   * The filter coefficients are linearly interpolated from
+   * @p filter_coefficients to @p next_filter_coefficients in the same way as
+   * InputSourceInterpolation. See MlsaDigitalFilter for details.
+   *
+   * @param[in] filter_coefficients @f$M@f$-th order MGLSA filter coefficients
+   *            at the beginning of the frame.
+   * @param[in] next_filter_coefficients @f$M@f$-th order MGLSA filter
+   *            coefficients at the beginning of the next frame.
+   * @param[in] frame_period Frame period, @f$P@f$.
+   * @param[in] interpolation_period Interpolation period, @f$I@f$.
+   * @param[in] filter_input Input signals. The length must be less than or
+   *            equal to @f$P@f$.
+   * @param[out] filter_output Output signals.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& filter_coefficients,
+           const std::vector<double>& next_filter_coefficients,
+           int frame_period, int interpolation_period,
+           const std::vector<double>& filter_input,
+           std::vector<double>* filter_output,
+           MglsaDigitalFilter::Buffer* buffer) const;
+
  private:
+  void PrepareBuffer(MglsaDigitalFilter::Buffer* buffer) const;
+
+  double Filter(const double* b, double gained_input,
+                MglsaDigitalFilter::Buffer* buffer) const;
+
   const int num_filter_order_;
   const int num_stage_;
   const double alpha_;
@@ -91,6 +91,8 @@ class MlsaDigitalFilter {
     std::vector<double> signals_for_basic_filter2_;
     std::vector<double> signals_for_exp_filter1_;
     std::vector<double> signals_for_exp_filter2_;
+    std::vector<double> coefficients_;
+    std::vector<double> increments_;
 
     friend class MlsaDigitalFilter;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -162,7 +164,40 @@ class MlsaDigitalFilter {
   bool Run(const std::vector<double>& filter_coefficients,
            double* input_and_output, MlsaDigitalFilter::Buffer* buffer) const;
 
+  /**
+   * Filter a block of signals in one call.
+   *
+   * The filter coefficients are linearly interpolated from
+   * @p filter_coefficients to @p next_filter_coefficients in the same way as
+   * InputSourceInterpolation, i.e., they are updated every
+   * @p interpolation_period samples. If @p interpolation_period is zero,
+   * @p next_filter_coefficients are used from the middle of the frame.
+   *
+   * @param[in] filter_coefficients @f$M@f$-th order MLSA filter coefficients
+   *            at the beginning of the frame.
+   * @param[in] next_filter_coefficients @f$M@f$-th order MLSA filter
+   *            coefficients at the beginning of the next frame.
+   * @param[in] frame_period Frame period, @f$P@f$.
+   * @param[in] interpolation_period Interpolation period, @f$I@f$.
+   * @param[in] filter_input Input signals. The length must be less than or
+   *            equal to @f$P@f$.
+   * @param[out] filter_output Output signals.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& filter_coefficients,
+           const std::vector<double>& next_filter_coefficients,
+           int frame_period, int interpolation_period,
+           const std::vector<double>& filter_input,
+           std::vector<double>* filter_output,
+           MlsaDigitalFilter::Buffer* buffer) const;
+
  private:
+  void PrepareBuffer(MlsaDigitalFilter::Buffer* buffer) const;
+
+  double Filter(const double* b, double gained_input,
+                MlsaDigitalFilter::Buffer* buffer) const;
+
   const int num_filter_order_;
   const int num_pade_order_;
   const double alpha_;
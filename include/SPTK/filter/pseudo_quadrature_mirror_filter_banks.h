@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/filter/all_zero_digital_filter.h"
+#include "SPTK/math/fourier_transform.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -54,6 +55,15 @@ namespace sptk {
  * @f]
  * is the shifted impulse response of an ideal lowpass filter. The optimal
  * angular frequency @f$\omega@f$ is calculated based on a simple algorithm.
+ *
+ * The subband signals can also be computed in a decimated form. Given @f$K@f$
+ * new samples, the polyphase components of the filtered signal
+ * @f[
+ *   u(r) = \sum_{l} (-1)^l h(r+2Kl) x(t-r-2Kl), \quad r = 0, \ldots, 2K-1
+ * @f]
+ * are cosine-modulated to yield @f$x_0(t), \ldots, x_{K-1}(t)@f$ at once.
+ * The modulation is computed by @f$2K@f$-point FFT. This is much faster than
+ * the sample-by-sample filtering followed by decimation.
  */
 class PseudoQuadratureMirrorFilterBanks {
  public:
@@ -76,6 +86,11 @@ class PseudoQuadratureMirrorFilterBanks {
    private:
     std::vector<AllZeroDigitalFilter::Buffer*> buffer_for_all_zero_filter_;
 
+    std::vector<double> signals_;
+    std::vector<double> real_part_;
+    std::vector<double> imag_part_;
+    FourierTransform::Buffer buffer_for_fourier_transform_;
+
     friend class PseudoQuadratureMirrorFilterBanks;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
@@ -133,13 +148,30 @@ class PseudoQuadratureMirrorFilterBanks {
   bool Run(double input, std::vector<double>* output,
            PseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
 
+  /**
+   * @param[in] input @f$K@f$ samples of input signal.
+   * @param[out] output Output subband signals at the time of the last input
+   *             sample.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& input, std::vector<double>* output,
+           PseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
+
  private:
   const int num_subband_;
   const AllZeroDigitalFilter all_zero_filter_;
+  const FourierTransform fourier_transform_;
 
   bool is_valid_;
   bool is_converged_;
   std::vector<std::vector<double> > filter_banks_;
+  std::vector<double> prototype_filter_;
+
+  std::vector<double> pre_twiddle_real_;
+  std::vector<double> pre_twiddle_imag_;
+  std::vector<double> post_twiddle_real_;
+  std::vector<double> post_twiddle_imag_;
 
   DISALLOW_COPY_AND_ASSIGN(PseudoQuadratureMirrorFilterBanks);
 };
@@ -55,9 +55,40 @@ namespace sptk {
  *     \boldsymbol{c}_T.
  *   \end{array}
  * @f]
+ *
+ * If all the covariance matrices are diagonal, the static feature components
+ * are independent of each other. In this case, the band matrix
+ * @f$\boldsymbol{W}^{\mathsf{T}}\boldsymbol{U}^{-1}\boldsymbol{W}@f$ of each
+ * component is stored in one flat array, with the components innermost, so
+ * that the @f$LDL^{\mathsf{T}}@f$ decomposition and the substitutions of all
+ * the components are done in one sweep along time. Otherwise, the components
+ * are solved jointly.
  */
 class NonrecursiveMaximumLikelihoodParameterGeneration {
  public:
+  /**
+   * Buffer for NonrecursiveMaximumLikelihoodParameterGeneration class.
+   */
+  class Buffer {
+   public:
+    Buffer() {
+    }
+
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<bool> is_continuous_;
+    std::vector<double> mseq_;
+    std::vector<double> vseq_;
+    std::vector<double> wum_;
+    std::vector<double> wuw_;
+    std::vector<double> z_;
+
+    friend class NonrecursiveMaximumLikelihoodParameterGeneration;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
   /**
    * @param[in] num_order Order of coefficients, @f$M@f$.
    * @param[in] window_coefficients Window coefficients.
@@ -116,7 +147,70 @@ class NonrecursiveMaximumLikelihoodParameterGeneration {
            const std::vector<SymmetricMatrix>& covariance_matrices,
            std::vector<std::vector<double> >* smoothed_static_parameters) const;
 
+  /**
+   * @param[in] mean_vectors Mean vector sequence. The shape is @f$[T, DM]@f$.
+   * @param[in] variance_vectors Variance vector sequence.
+   *            The shape is @f$[T, DM]@f$.
+   * @param[out] smoothed_static_parameters Smoothed static parameters.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<std::vector<double> >& mean_vectors,
+           const std::vector<std::vector<double> >& variance_vectors,
+           std::vector<std::vector<double> >* smoothed_static_parameters,
+           Buffer* buffer) const;
+
+  /**
+   * @param[in] mean_vectors Mean vector sequence. The shape is @f$[T, DM]@f$.
+   * @param[in] covariance_matrices Covariance matrix sequence.
+   *            The shape is @f$[T, DM, DM]@f$.
+   * @param[out] smoothed_static_parameters Smoothed static parameters.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<std::vector<double> >& mean_vectors,
+           const std::vector<SymmetricMatrix>& covariance_matrices,
+           std::vector<std::vector<double> >* smoothed_static_parameters,
+           Buffer* buffer) const;
+
  private:
+  // Nonzero term of W'U^{-1}M.
+  struct MeanTerm {
+    int window_index;
+    int time_offset;
+    double coefficient;
+  };
+
+  // Nonzero term of W'U^{-1}W for diagonal U.
+  struct PrecisionTerm {
+    int window_index;
+    int time_offset;
+    int band_index;
+    double left_coefficient;
+    double right_coefficient;
+  };
+
+  int MarkContinuousFrames(
+      const std::vector<std::vector<double> >& mean_vectors,
+      std::vector<bool>* is_continuous) const;
+
+  bool IsBoundary(int t, int absolute_t, int window_index,
+                  int continuous_length,
+                  const std::vector<bool>& is_continuous) const;
+
+  void SolveWithDiagonalPrecisions(
+      const std::vector<std::vector<double> >& mean_vectors,
+      int continuous_length, Buffer* buffer) const;
+
+  bool SolveWithFullPrecisions(
+      const std::vector<std::vector<double> >& mean_vectors,
+      const std::vector<SymmetricMatrix>& covariance_matrices,
+      int continuous_length, Buffer* buffer) const;
+
+  void StoreParameters(
+      const std::vector<bool>& is_continuous, const std::vector<double>& cc,
+      std::vector<std::vector<double> >* smoothed_static_parameters) const;
+
   const int num_order_;
   std::vector<std::vector<double> > window_coefficients_;
   const bool use_magic_number_;
@@ -125,6 +219,9 @@ class NonrecursiveMaximumLikelihoodParameterGeneration {
   bool is_valid_;
   int max_half_window_width_;
 
+  std::vector<MeanTerm> mean_terms_;
+  std::vector<PrecisionTerm> precision_terms_;
+
   DISALLOW_COPY_AND_ASSIGN(NonrecursiveMaximumLikelihoodParameterGeneration);
 };
 
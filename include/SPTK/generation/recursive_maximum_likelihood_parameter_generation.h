@@ -60,6 +60,13 @@ namespace sptk {
  * filter. The algorithm does not require entire mean and varaiance parameter
  * sequence, but intorduces approximation error. The amount of approximation
  * error is controlled by a parameter, @f$S@f$.
+ *
+ * The parameters can be given in two ways. One is to read them from an input
+ * source via Get. The other is to push them frame by frame via Push and to
+ * flush the remaining frames via Flush after the last frame. In both cases,
+ * the output is delayed by @f$S+L@f$ frames, where @f$L@f$ is the maximum
+ * half width of the windows. The state is held in ring buffers allocated in
+ * the constructor, so that no memory is allocated per frame.
  */
 class RecursiveMaximumLikelihoodParameterGeneration
     : public InputSourceInterface {
@@ -76,6 +83,16 @@ class RecursiveMaximumLikelihoodParameterGeneration
       const std::vector<std::vector<double> >& window_coefficients,
       InputSourceInterface* input_source);
 
+  /**
+   * @param[in] num_order Order of coefficients, @f$M@f$.
+   * @param[in] num_past_frame Number of past frames, @f$S@f$.
+   * @param[in] window_coefficients Window coefficients.
+   *            e.g.) { {-0.5, 0.0, 0.5}, {1.0, -2.0, 1.0} }
+   */
+  RecursiveMaximumLikelihoodParameterGeneration(
+      int num_order, int num_past_frame,
+      const std::vector<std::vector<double> >& window_coefficients);
+
   virtual ~RecursiveMaximumLikelihoodParameterGeneration() {
   }
 
@@ -93,6 +110,13 @@ class RecursiveMaximumLikelihoodParameterGeneration
     return num_past_frame_;
   }
 
+  /**
+   * @return Number of frames between input and output.
+   */
+  int GetDelay() const {
+    return calculation_field_ - 1;
+  }
+
   /**
    * @return Output size.
    */
@@ -113,20 +137,54 @@ class RecursiveMaximumLikelihoodParameterGeneration
    */
   virtual bool Get(std::vector<double>* smoothed_static_parameters);
 
+  /**
+   * Push the parameters of the next frame. This can be used only if no input
+   * source is given.
+   *
+   * @param[in] static_and_dynamic_parameters Mean and variance of static and
+   *            dynamic components.
+   * @param[out] smoothed_static_parameters Smoothed static parameters of the
+   *             frame which is GetDelay() frames before.
+   * @param[out] is_output True if smoothed_static_parameters is given. This is
+   *             false while the first GetDelay() frames are pushed.
+   * @return True on success, false on failure.
+   */
+  bool Push(const std::vector<double>& static_and_dynamic_parameters,
+            std::vector<double>* smoothed_static_parameters, bool* is_output);
+
+  /**
+   * Get the next remaining frame after the last frame is pushed. This can be
+   * used only if no input source is given.
+   *
+   * @param[out] smoothed_static_parameters Smoothed static parameters.
+   * @return True on success, false on failure or if no frame remains.
+   */
+  bool Flush(std::vector<double>* smoothed_static_parameters);
+
  private:
   struct Buffer {
     std::vector<double> static_and_dynamic_parameters;
-    std::vector<std::vector<double> > stored_dynamic_mean_vectors;
-    std::vector<std::vector<double> >
-        stored_dynamic_diagonal_covariance_matrices;
-    std::vector<std::vector<double> > pi;
-    std::vector<std::vector<double> > k;
-    std::vector<std::vector<std::vector<double> > > p;
-    std::vector<std::vector<double> > c;
+    std::vector<double> stored_dynamic_mean_vectors;
+    std::vector<double> stored_dynamic_diagonal_covariance_matrices;
+    std::vector<double> pi;
+    std::vector<double> k;
+    std::vector<double> p;
+    std::vector<double> c;
+    std::vector<int> positions;
   };
 
+  bool Initialize();
+
+  void SetUnobservedParameters();
+
   bool Forward();
 
+  void Output(std::vector<double>* smoothed_static_parameters);
+
+  int GetNumForwardedFrame() const {
+    return current_frame_ - num_past_frame_;
+  }
+
   const int num_order_;
   const int num_past_frame_;
   std::vector<std::vector<double> > window_coefficients_;
@@ -134,9 +192,11 @@ class RecursiveMaximumLikelihoodParameterGeneration
 
   bool is_valid_;
 
+  int input_size_;
   int calculation_field_;
-  int num_remaining_frame_;
   int current_frame_;
+  int num_input_frame_;
+  int num_output_frame_;
 
   Buffer buffer_;
 
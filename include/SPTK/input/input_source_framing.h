@@ -0,0 +1,111 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_INPUT_INPUT_SOURCE_FRAMING_H_
+#define SPTK_INPUT_INPUT_SOURCE_FRAMING_H_
+
+#include <istream>  // std::istream
+#include <vector>   // std::vector
+
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Extract frames from stream.
+ *
+ * The frames are the same as those extracted by frame command. When the end
+ * of the stream is reached, the last frames are padded with zeros until the
+ * center of the frame passes the last data.
+ */
+class InputSourceFraming : public InputSourceInterface {
+ public:
+  /**
+   * Type of framing.
+   */
+  enum FramingTypes {
+    kBeginningOfDataIsCenterOfFirstFrame = 0,
+    kBeginningOfDataIsStartOfFirstFrame,
+    kNumFramingTypes
+  };
+
+  /**
+   * @param[in] frame_length Frame length, @f$L@f$.
+   * @param[in] frame_period Frame period, @f$P@f$.
+   * @param[in] framing_type Type of framing.
+   * @param[in] zero_mean If true, subtract the mean from each frame.
+   * @param[in] input_stream Input stream.
+   */
+  InputSourceFraming(int frame_length, int frame_period,
+                     FramingTypes framing_type, bool zero_mean,
+                     std::istream* input_stream);
+
+  virtual ~InputSourceFraming() {
+  }
+
+  /**
+   * @return Frame length.
+   */
+  virtual int GetSize() const {
+    return frame_length_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  virtual bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @return True if reading the stream failed, not reached its end.
+   */
+  bool IsFailed() const {
+    return is_failed_;
+  }
+
+  /**
+   * @param[out] frame @f$L@f$-length frame.
+   * @return True on success, false on failure or at the end of the stream.
+   */
+  virtual bool Get(std::vector<double>* frame);
+
+ private:
+  bool Read();
+
+  const int frame_length_;
+  const int frame_period_;
+  const FramingTypes framing_type_;
+  const bool zero_mean_;
+  const int center_;
+  std::istream* input_stream_;
+
+  bool is_valid_;
+  bool is_first_frame_;
+  bool is_end_;
+  bool is_eof_;
+  bool is_failed_;
+  int last_data_position_in_frame_;
+
+  std::vector<double> data_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputSourceFraming);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_INPUT_INPUT_SOURCE_FRAMING_H_
@@ -70,6 +70,7 @@ class DiscreteCosineTransform {
    private:
     std::vector<double> fourier_transform_real_part_;
     std::vector<double> fourier_transform_imag_part_;
+    FourierTransform::Buffer buffer_for_fourier_transform_;
 
     friend class DiscreteCosineTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
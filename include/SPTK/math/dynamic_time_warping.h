@@ -56,6 +56,11 @@ namespace sptk {
  * and @f$\phi_x(\cdot)@f$ and @f$\phi_y(\cdot)@f$ are the function which maps
  * the Viterbi time index into the corresponding time index of query/reference
  * data sequence, respectively.
+ *
+ * The search space can be restricted by a global path constraint, i.e.,
+ * Sakoe-Chiba band or Itakura parallelogram. Only the cells inside the band
+ * are evaluated and only their back pointers are stored. If the Viterbi path
+ * is not required, the score is computed with @f$O(T_y)@f$ memory.
  */
 class DynamicTimeWarping {
  public:
@@ -91,13 +96,41 @@ class DynamicTimeWarping {
     kNumTypes
   };
 
+  /**
+   * Global path constraints.
+   */
+  enum GlobalPathConstraints {
+    /** No constraint. */
+    kUnconstrained = 0,
+
+    /**
+     * Sakoe-Chiba band:
+     * @f$|j - i (T_y - 1) / (T_x - 1)| \le W@f$.
+     */
+    kSakoeChibaBand,
+
+    /**
+     * Itakura parallelogram whose slopes are in the range of @f$1/S@f$ to
+     * @f$S@f$.
+     */
+    kItakuraParallelogram,
+
+    kNumGlobalPathConstraints
+  };
+
   /**
    * @param[in] num_order Order of vector, @f$M@f$.
    * @param[in] local_path_constraint Type of local path constraint.
    * @param[in] distance_metric Distance metric.
+   * @param[in] global_path_constraint Type of global path constraint.
+   * @param[in] window_width Width of Sakoe-Chiba band, @f$W@f$.
+   * @param[in] maximum_slope Maximum slope of Itakura parallelogram, @f$S@f$.
    */
-  DynamicTimeWarping(int num_order, LocalPathConstraints local_path_constraint,
-                     DistanceCalculation::DistanceMetrics distance_metric);
+  DynamicTimeWarping(
+      int num_order, LocalPathConstraints local_path_constraint,
+      DistanceCalculation::DistanceMetrics distance_metric,
+      GlobalPathConstraints global_path_constraint = kUnconstrained,
+      int window_width = 0, double maximum_slope = 2.0);
 
   virtual ~DynamicTimeWarping() {
   }
@@ -123,6 +156,27 @@ class DynamicTimeWarping {
     return distance_calculation_.GetDistanceMetric();
   }
 
+  /**
+   * @return Type of global path constraint.
+   */
+  GlobalPathConstraints GetGlobalPathConstraint() const {
+    return global_path_constraint_;
+  }
+
+  /**
+   * @return Width of Sakoe-Chiba band.
+   */
+  int GetWindowWidth() const {
+    return window_width_;
+  }
+
+  /**
+   * @return Maximum slope of Itakura parallelogram.
+   */
+  double GetMaximumSlope() const {
+    return maximum_slope_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -135,7 +189,8 @@ class DynamicTimeWarping {
    *            The shape is @f$[T_x, M+1]@f$.
    * @param[in] reference_vector_sequence @f$M@f$-th order reference vectors.
    *            The shape is @f$[T_y, M+1]@f$.
-   * @param[out] viterbi_path Best sequence of the pairs of index.
+   * @param[out] viterbi_path Best sequence of the pairs of index. If NULL,
+   *             only the score is computed.
    * @param[out] total_score Score of dynamic time warping.
    * @return True on success, false on failure.
    */
@@ -144,10 +199,45 @@ class DynamicTimeWarping {
            std::vector<std::pair<int, int> >* viterbi_path,
            double* total_score) const;
 
+  /**
+   * Perform dynamic time warping inside a given search window.
+   *
+   * The window is intersected with the global path constraint.
+   *
+   * @param[in] query_vector_sequence @f$M@f$-th order query vectors.
+   *            The shape is @f$[T_x, M+1]@f$.
+   * @param[in] reference_vector_sequence @f$M@f$-th order reference vectors.
+   *            The shape is @f$[T_y, M+1]@f$.
+   * @param[in] begins @f$T_x@f$ first reference indices of the window.
+   * @param[in] ends @f$T_x@f$ last reference indices of the window plus one.
+   * @param[out] viterbi_path Best sequence of the pairs of index. If NULL,
+   *             only the score is computed.
+   * @param[out] total_score Score of dynamic time warping.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<std::vector<double> >& query_vector_sequence,
+           const std::vector<std::vector<double> >& reference_vector_sequence,
+           const std::vector<int>& begins, const std::vector<int>& ends,
+           std::vector<std::pair<int, int> >* viterbi_path,
+           double* total_score) const;
+
  private:
+  bool RunInBand(
+      const std::vector<std::vector<double> >& query_vector_sequence,
+      const std::vector<std::vector<double> >& reference_vector_sequence,
+      const std::vector<int>& begins, const std::vector<int>& ends,
+      std::vector<std::pair<int, int> >* viterbi_path,
+      double* total_score) const;
+
+  void CalculateBand(int num_query_vector, int num_reference_vector,
+                     std::vector<int>* begins, std::vector<int>* ends) const;
+
   const int num_order_;
   const LocalPathConstraints local_path_constraint_;
   const DistanceCalculation distance_calculation_;
+  const GlobalPathConstraints global_path_constraint_;
+  const int window_width_;
+  const double maximum_slope_;
   const bool includes_skip_transition_;
 
   bool is_valid_;
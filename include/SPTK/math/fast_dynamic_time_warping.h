@@ -0,0 +1,122 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_MATH_FAST_DYNAMIC_TIME_WARPING_H_
+#define SPTK_MATH_FAST_DYNAMIC_TIME_WARPING_H_
+
+#include <utility>  // std::pair
+#include <vector>   // std::vector
+
+#include "SPTK/math/distance_calculation.h"
+#include "SPTK/math/dynamic_time_warping.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Perform approximate dynamic time warping in a coarse-to-fine manner.
+ *
+ * The input and output are the same as those of DynamicTimeWarping.
+ * The query and reference vector sequences are recursively downsampled by
+ * averaging adjacent vectors until their lengths are less than or equal to
+ * @f$r+2@f$, where @f$r@f$ is the radius. The Viterbi path found at the
+ * coarser resolution is projected onto the finer resolution, expanded by
+ * @f$r@f$ cells, and used as the search window of DTW. The computational
+ * cost is therefore linear in the length of the sequences.
+ *
+ * [1] S. Salvador and P. Chan, &quot;FastDTW: Toward accurate dynamic time
+ *     warping in linear time and space,&quot; Intelligent Data Analysis,
+ *     vol. 11, no. 5, pp. 561-580, 2007.
+ */
+class FastDynamicTimeWarping {
+ public:
+  /**
+   * @param[in] num_order Order of vector, @f$M@f$.
+   * @param[in] local_path_constraint Type of local path constraint.
+   * @param[in] distance_metric Distance metric.
+   * @param[in] radius Radius of search window, @f$r@f$.
+   */
+  FastDynamicTimeWarping(
+      int num_order,
+      DynamicTimeWarping::LocalPathConstraints local_path_constraint,
+      DistanceCalculation::DistanceMetrics distance_metric, int radius);
+
+  virtual ~FastDynamicTimeWarping() {
+  }
+
+  /**
+   * @return Order of vector.
+   */
+  int GetNumOrder() const {
+    return num_order_;
+  }
+
+  /**
+   * @return Type of local path constraint.
+   */
+  DynamicTimeWarping::LocalPathConstraints GetLocalPathConstraint() const {
+    return dynamic_time_warping_.GetLocalPathConstraint();
+  }
+
+  /**
+   * @return Distance metric.
+   */
+  DistanceCalculation::DistanceMetrics GetDistanceMetric() const {
+    return dynamic_time_warping_.GetDistanceMetric();
+  }
+
+  /**
+   * @return Radius of search window.
+   */
+  int GetRadius() const {
+    return radius_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[in] query_vector_sequence @f$M@f$-th order query vectors.
+   *            The shape is @f$[T_x, M+1]@f$.
+   * @param[in] reference_vector_sequence @f$M@f$-th order reference vectors.
+   *            The shape is @f$[T_y, M+1]@f$.
+   * @param[out] viterbi_path Best sequence of the pairs of index. If NULL,
+   *             only the score is computed.
+   * @param[out] total_score Score of dynamic time warping.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<std::vector<double> >& query_vector_sequence,
+           const std::vector<std::vector<double> >& reference_vector_sequence,
+           std::vector<std::pair<int, int> >* viterbi_path,
+           double* total_score) const;
+
+ private:
+  const int num_order_;
+  const int radius_;
+  const DynamicTimeWarping dynamic_time_warping_;
+
+  bool is_valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(FastDynamicTimeWarping);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_MATH_FAST_DYNAMIC_TIME_WARPING_H_
@@ -41,6 +41,11 @@ namespace sptk {
  *   \end{array}
  * @f]
  * where @f$L@f$ is the FFT length and must be a power of two.
+ *
+ * The transform is computed by the radix-4 decimation-in-frequency algorithm
+ * with a final radix-2 stage if required. The twiddle factors and the
+ * bit-reversal permutation are precomputed in the constructor, so that the
+ * object can be used as a reusable plan for a fixed FFT length.
  */
 class FastFourierTransform {
  public:
@@ -106,7 +111,8 @@ class FastFourierTransform {
 
   bool is_valid_;
 
-  std::vector<double> sine_table_;
+  std::vector<double> twiddle_factor_table_;
+  std::vector<int> bit_reversal_table_;
 
   DISALLOW_COPY_AND_ASSIGN(FastFourierTransform);
 };
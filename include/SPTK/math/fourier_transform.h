@@ -33,6 +33,15 @@ class FourierTransform {
    */
   class FourierTransformInterface {
    public:
+    /**
+     * Buffer for Fourier transform.
+     */
+    class Buffer {
+     public:
+      virtual ~Buffer() {
+      }
+    };
+
     virtual ~FourierTransformInterface() {
     }
 
@@ -46,25 +55,52 @@ class FourierTransform {
      */
     virtual bool IsValid() const = 0;
 
+    /**
+     * @return Buffer for this object.
+     */
+    virtual Buffer* CreateBuffer() const = 0;
+
     /**
      * @param[in] real_part_input @f$L@f$-length real part of input.
      * @param[in] imag_part_input @f$L@f$-length imaginary part of input.
      * @param[out] real_part_output @f$L@f$-length real part of output.
      * @param[out] imag_part_output @f$L@f$-length imaginary part of output.
+     * @param[out] buffer Buffer.
      * @return True on success, false on failure.
      */
     virtual bool Run(const std::vector<double>& real_part_input,
                      const std::vector<double>& imag_part_input,
                      std::vector<double>* real_part_output,
-                     std::vector<double>* imag_part_output) const = 0;
+                     std::vector<double>* imag_part_output,
+                     Buffer* buffer) const = 0;
 
     /**
      * @param[in,out] real_part Real part.
      * @param[in,out] imag_part Imaginary part.
+     * @param[out] buffer Buffer.
      * @return True on success, false on failure.
      */
     virtual bool Run(std::vector<double>* real_part,
-                     std::vector<double>* imag_part) const = 0;
+                     std::vector<double>* imag_part, Buffer* buffer) const = 0;
+  };
+
+  /**
+   * Buffer for FourierTransform class.
+   */
+  class Buffer {
+   public:
+    Buffer() : buffer_(NULL) {
+    }
+
+    virtual ~Buffer() {
+      delete buffer_;
+    }
+
+   private:
+    FourierTransformInterface::Buffer* buffer_;
+
+    friend class FourierTransform;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
 
   /**
@@ -95,27 +131,47 @@ class FourierTransform {
    * @param[in] imag_part_input @f$L@f$-length imaginary part of input.
    * @param[out] real_part_output @f$L@f$-length real part of output.
    * @param[out] imag_part_output @f$L@f$-length imaginary part of output.
+   * @param[out] buffer Buffer.
    * @return True on success, false on failure.
    */
   bool Run(const std::vector<double>& real_part_input,
            const std::vector<double>& imag_part_input,
            std::vector<double>* real_part_output,
-           std::vector<double>* imag_part_output) const {
+           std::vector<double>* imag_part_output,
+           FourierTransform::Buffer* buffer) const {
+    if (!PrepareBuffer(buffer)) {
+      return false;
+    }
     return fourier_transform_->Run(real_part_input, imag_part_input,
-                                   real_part_output, imag_part_output);
+                                   real_part_output, imag_part_output,
+                                   buffer->buffer_);
   }
 
   /**
    * @param[in,out] real_part Real part.
    * @param[in,out] imag_part Imaginary part.
+   * @param[out] buffer Buffer.
    * @return True on success, false on failure.
    */
-  bool Run(std::vector<double>* real_part,
-           std::vector<double>* imag_part) const {
-    return fourier_transform_->Run(real_part, imag_part);
+  bool Run(std::vector<double>* real_part, std::vector<double>* imag_part,
+           FourierTransform::Buffer* buffer) const {
+    if (!PrepareBuffer(buffer)) {
+      return false;
+    }
+    return fourier_transform_->Run(real_part, imag_part, buffer->buffer_);
   }
 
  private:
+  bool PrepareBuffer(FourierTransform::Buffer* buffer) const {
+    if (NULL == buffer) {
+      return false;
+    }
+    if (NULL == buffer->buffer_) {
+      buffer->buffer_ = fourier_transform_->CreateBuffer();
+    }
+    return NULL != buffer->buffer_;
+  }
+
   FourierTransformInterface* fourier_transform_;
 
   DISALLOW_COPY_AND_ASSIGN(FourierTransform);
@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -60,6 +61,14 @@ namespace sptk {
  * detail, see [1]. Note that the above recursion can be represented as a linear
  * transformation, i.e., matrix multiplication.
  *
+ * Since @f$\alpha@f$ and the orders are fixed for an instance, the
+ * @f$(M_2+1) \times (M_1+1)@f$ conversion matrix is precomputed in the
+ * constructor unless it is too large. The @f$m_1@f$-th column of the matrix is
+ * obtained by applying the recursion with zero input to the unit vector
+ * @f$m_1@f$ times, so that the cost of the precomputation is the same as that
+ * of one transformation. A block of sequences can be transformed at once to
+ * reuse the matrix in cache.
+ *
  * [1] A. Oppenheim and D. Johnson, &quot;Discrete representation of
  *     signals,&quot; Proc. of the IEEE, vol. 60, no. 6, pp. 681-691, 1972.
  *
@@ -82,6 +91,8 @@ class FrequencyTransform {
 
    private:
     std::vector<double> d_;
+    std::vector<double> input_;
+    std::vector<double> output_;
 
     friend class FrequencyTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -118,6 +129,13 @@ class FrequencyTransform {
     return alpha_;
   }
 
+  /**
+   * @return True if the conversion matrix is precomputed.
+   */
+  bool IsMatrixPrecomputed() const {
+    return !conversion_matrix_.empty();
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -135,6 +153,19 @@ class FrequencyTransform {
            std::vector<double>* warped_sequence,
            FrequencyTransform::Buffer* buffer) const;
 
+  /**
+   * Transform a block of sequences. Each row of the matrices holds one
+   * sequence.
+   *
+   * @param[in] minimum_phase_sequences @f$M_1@f$-th order input sequences.
+   * @param[out] warped_sequences @f$M_2@f$-th order output sequences.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool RunBatch(const Matrix& minimum_phase_sequences,
+                Matrix* warped_sequences,
+                FrequencyTransform::Buffer* buffer) const;
+
  private:
   const int num_input_order_;
   const int num_output_order_;
@@ -142,6 +173,9 @@ class FrequencyTransform {
 
   bool is_valid_;
 
+  // The m1-th row holds the m1-th column of the conversion matrix.
+  std::vector<std::vector<double> > conversion_matrix_;
+
   DISALLOW_COPY_AND_ASSIGN(FrequencyTransform);
 };
 
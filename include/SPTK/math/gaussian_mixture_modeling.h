@@ -103,6 +103,12 @@ namespace sptk {
  *   \xi_k = \alpha w'_k.
  * @f]
  * and @f$\alpha@f$ controlls the importance of the UBM.
+ *
+ * The E-step can be run by multiple threads. The input vectors are split into
+ * contiguous chunks, and each thread accumulates the statistics of its own
+ * chunk. The statistics are summed in the order of the chunks at the end of
+ * each iteration, so that the result is deterministic for a given number of
+ * threads.
  */
 class GaussianMixtureModeling {
  public:
@@ -135,9 +141,12 @@ class GaussianMixtureModeling {
     }
 
    private:
-    std::vector<double> d_;
     std::vector<double> gconsts_;
-    std::vector<SymmetricMatrix> precisions_;
+    std::vector<std::vector<double> > cholesky_factors_;
+    std::vector<std::vector<double> > transformed_mean_vectors_;
+    std::vector<double> transposed_input_vectors_;
+    std::vector<double> transformed_input_vector_;
+    std::vector<double> components_;
     bool precomputed_;
 
     friend class GaussianMixtureModeling;
@@ -159,6 +168,7 @@ class GaussianMixtureModeling {
    * @param[in] ubm_weights Weights of UBM-GMM (optional).
    * @param[in] ubm_mean_vectors Means of UBM-GMM (optional).
    * @param[in] ubm_covariance_matrices Covariances of UBM-GMM (optional).
+   * @param[in] num_thread Number of threads used in E-step (optional).
    */
   GaussianMixtureModeling(
       int num_order, int num_mixture, int num_iteration,
@@ -168,7 +178,8 @@ class GaussianMixtureModeling {
       double smoothing_parameter = 0.0,
       const std::vector<double>& ubm_weights = {},
       const std::vector<std::vector<double> >& ubm_mean_vectors = {},
-      const std::vector<SymmetricMatrix>& ubm_covariance_matrices = {});
+      const std::vector<SymmetricMatrix>& ubm_covariance_matrices = {},
+      int num_thread = 1);
 
   virtual ~GaussianMixtureModeling() {
   }
@@ -236,6 +247,13 @@ class GaussianMixtureModeling {
     return smoothing_parameter_;
   }
 
+  /**
+   * @return Number of threads.
+   */
+  int GetNumThread() const {
+    return num_thread_;
+  }
+
   /**
    * @return True if covariance is pure diagonal.
    */
@@ -290,7 +308,46 @@ class GaussianMixtureModeling {
       std::vector<double>* components_of_log_probability,
       double* log_probability, GaussianMixtureModeling::Buffer* buffer);
 
+  /**
+   * Calculate log-probablity of data in batch.
+   *
+   * The input vectors are processed block by block. The Mahalanobis distances
+   * are computed from the precomputed Cholesky factors of the precision
+   * matrices for all the vectors in a block at once.
+   *
+   * @param[in] num_order Order of input vector.
+   * @param[in] num_mixture Number of mixture components.
+   * @param[in] is_diagonal If true, diagonal covariance is assumed.
+   * @param[in] check_size If true, check sanity of input GMM parameters.
+   * @param[in] input_vectors @f$M@f$-th order input vectors.
+   *            The shape is @f$[T, M+1]@f$.
+   * @param[in] weights @f$K@f$ mixture weights.
+   * @param[in] mean_vectors @f$K@f$ mean vectors.
+   * @param[in] covariance_matrices @f$K@f$ covariance matrices.
+   * @param[out] components_of_log_probability Components of log-probability.
+   *             The shape is @f$[T, K]@f$.
+   * @param[out] log_probability @f$T@f$ log-probabilities of input vectors.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  static bool CalculateLogProbability(
+      int num_order, int num_mixture, bool is_diagonal, bool check_size,
+      const std::vector<std::vector<double> >& input_vectors,
+      const std::vector<double>& weights,
+      const std::vector<std::vector<double> >& mean_vectors,
+      const std::vector<SymmetricMatrix>& covariance_matrices,
+      std::vector<std::vector<double> >* components_of_log_probability,
+      std::vector<double>* log_probability,
+      GaussianMixtureModeling::Buffer* buffer);
+
  private:
+  static bool Precompute(
+      int num_order, int num_mixture, bool is_diagonal,
+      const std::vector<double>& weights,
+      const std::vector<std::vector<double> >& mean_vectors,
+      const std::vector<SymmetricMatrix>& covariance_matrices,
+      GaussianMixtureModeling::Buffer* buffer);
+
   void FloorWeight(std::vector<double>* weights) const;
 
   void FloorVariance(std::vector<SymmetricMatrix>* covariance_matrices) const;
@@ -300,6 +357,15 @@ class GaussianMixtureModeling {
                   std::vector<std::vector<double> >* mean_vectors,
                   std::vector<SymmetricMatrix>* covariance_matrices) const;
 
+  bool AccumulateStatistics(
+      const std::vector<std::vector<double> >& input_vectors, int begin,
+      int end, const std::vector<double>& weights,
+      const std::vector<std::vector<double> >& mean_vectors,
+      const std::vector<SymmetricMatrix>& covariance_matrices,
+      std::vector<double>* buffer0, std::vector<std::vector<double> >* buffer1,
+      std::vector<SymmetricMatrix>* buffer2, double* log_likelihood,
+      GaussianMixtureModeling::Buffer* buffer) const;
+
   const int num_order_;
   const int num_mixture_;
   const int num_iteration_;
@@ -315,6 +381,7 @@ class GaussianMixtureModeling {
   const std::vector<double> ubm_weights_;
   const std::vector<std::vector<double> > ubm_mean_vectors_;
   const std::vector<SymmetricMatrix> ubm_covariance_matrices_;
+  const int num_thread_;
 
   const bool is_diagonal_;
   bool is_valid_;
@@ -70,6 +70,7 @@ class InverseDiscreteCosineTransform {
    private:
     std::vector<double> fourier_transform_real_part_;
     std::vector<double> fourier_transform_imag_part_;
+    FourierTransform::Buffer buffer_for_fourier_transform_;
 
     friend class InverseDiscreteCosineTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
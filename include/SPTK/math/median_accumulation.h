@@ -0,0 +1,118 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_MATH_MEDIAN_ACCUMULATION_H_
+#define SPTK_MATH_MEDIAN_ACCUMULATION_H_
+
+#include <set>  // std::multiset
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Compute median of given data sequence.
+ *
+ * The data are kept in two balanced multisets: the lower half and the upper
+ * half. Both addition and removal of a data take @f$O(\log N)@f$ time, where
+ * @f$N@f$ is the number of accumulated data. Hence the median of a sliding
+ * window can be updated without sorting the whole window.
+ */
+class MedianAccumulation {
+ public:
+  /**
+   * Buffer for MedianAccumulation.
+   */
+  class Buffer {
+   public:
+    Buffer() {
+    }
+
+    virtual ~Buffer() {
+    }
+
+   private:
+    void Clear() {
+      lower_half_.clear();
+      upper_half_.clear();
+    }
+
+    std::multiset<double> lower_half_;
+    std::multiset<double> upper_half_;
+
+    friend class MedianAccumulation;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  MedianAccumulation() {
+  }
+
+  virtual ~MedianAccumulation() {
+  }
+
+  /**
+   * @param[in] buffer Buffer.
+   * @param[out] num_data Number of accumulated data.
+   * @return True on success, false on failure.
+   */
+  bool GetNumData(const MedianAccumulation::Buffer& buffer,
+                  int* num_data) const;
+
+  /**
+   * Get median. If the number of data is even, the mean of the two middle
+   * values is returned.
+   *
+   * @param[in] buffer Buffer.
+   * @param[out] median Median.
+   * @return True on success, false on failure.
+   */
+  bool GetMedian(const MedianAccumulation::Buffer& buffer,
+                 double* median) const;
+
+  /**
+   * Clear buffer.
+   *
+   * @param[in,out] buffer Buffer.
+   */
+  void Clear(MedianAccumulation::Buffer* buffer) const;
+
+  /**
+   * Add data. NaN is rejected since it cannot be ordered.
+   *
+   * @param[in] data Input data.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(double data, MedianAccumulation::Buffer* buffer) const;
+
+  /**
+   * Remove one of accumulated data.
+   *
+   * @param[in] data Data to be removed.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Remove(double data, MedianAccumulation::Buffer* buffer) const;
+
+ private:
+  void Rebalance(MedianAccumulation::Buffer* buffer) const;
+
+  DISALLOW_COPY_AND_ASSIGN(MedianAccumulation);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_MATH_MEDIAN_ACCUMULATION_H_
@@ -0,0 +1,159 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_MATH_MIXED_RADIX_FAST_FOURIER_TRANSFORM_H_
+#define SPTK_MATH_MIXED_RADIX_FAST_FOURIER_TRANSFORM_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/math/fast_fourier_transform.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Calculate DFT of complex-valued input data of arbitrary length.
+ *
+ * The inputs are @f$L@f$-length complex-valued data:
+ * @f[
+ *   \begin{array}{cccc}
+ *   \mathrm{Re}(x(0)), & \mathrm{Re}(x(1)), & \ldots, & \mathrm{Re}(x(L-1)), \\
+ *   \mathrm{Im}(x(0)), & \mathrm{Im}(x(1)), & \ldots, & \mathrm{Im}(x(L-1)).
+ *   \end{array}
+ * @f]
+ * The outputs are
+ * @f[
+ *   \begin{array}{cccc}
+ *   \mathrm{Re}(X(0)), & \mathrm{Re}(X(1)), & \ldots, & \mathrm{Re}(X(L-1)), \\
+ *   \mathrm{Im}(X(0)), & \mathrm{Im}(X(1)), & \ldots, & \mathrm{Im}(X(L-1)).
+ *   \end{array}
+ * @f]
+ *
+ * If @f$L@f$ can be factorized into 2, 3, 5, and 7, the DFT is computed by
+ * the mixed-radix Stockham algorithm. Otherwise, the DFT is rewritten as the
+ * linear convolution by Bluestein's chirp z-transform:
+ * @f[
+ *   X(k) = b^*(k) \sum_{n=0}^{L-1} \left( x(n) b^*(n) \right) b(k-n),
+ * @f]
+ * where @f$b(n) = e^{j\pi n^2 / L}@f$, and the convolution is computed by
+ * the power-of-two FFT. In both cases, the computational cost is
+ * @f$O(L \log L)@f$.
+ */
+class MixedRadixFastFourierTransform {
+ public:
+  /**
+   * Buffer for MixedRadixFastFourierTransform class.
+   */
+  class Buffer {
+   public:
+    Buffer() {
+    }
+
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<double> work_real_part_;
+    std::vector<double> work_imag_part_;
+
+    friend class MixedRadixFastFourierTransform;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  /**
+   * @param[in] fft_length FFT length, @f$L@f$.
+   */
+  explicit MixedRadixFastFourierTransform(int fft_length);
+
+  virtual ~MixedRadixFastFourierTransform() {
+    delete fast_fourier_transform_;
+  }
+
+  /**
+   * @return FFT length.
+   */
+  int GetFftLength() const {
+    return fft_length_;
+  }
+
+  /**
+   * @return True if Bluestein's algorithm is used.
+   */
+  bool IsBluestein() const {
+    return radices_.empty() && 1 < fft_length_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[in] real_part_input @f$L@f$-length real part of input.
+   * @param[in] imag_part_input @f$L@f$-length imaginary part of input.
+   * @param[out] real_part_output @f$L@f$-length real part of output.
+   * @param[out] imag_part_output @f$L@f$-length imaginary part of output.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& real_part_input,
+           const std::vector<double>& imag_part_input,
+           std::vector<double>* real_part_output,
+           std::vector<double>* imag_part_output,
+           MixedRadixFastFourierTransform::Buffer* buffer) const;
+
+  /**
+   * @param[in,out] real_part @f$L@f$-length real part.
+   * @param[in,out] imag_part @f$L@f$-length imaginary part.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<double>* real_part, std::vector<double>* imag_part,
+           MixedRadixFastFourierTransform::Buffer* buffer) const;
+
+ private:
+  bool RunStockham(double* real_part, double* imag_part,
+                   MixedRadixFastFourierTransform::Buffer* buffer) const;
+
+  bool RunBluestein(double* real_part, double* imag_part,
+                    MixedRadixFastFourierTransform::Buffer* buffer) const;
+
+  const int fft_length_;
+
+  bool is_valid_;
+
+  // Radices used in the Stockham algorithm.
+  std::vector<int> radices_;
+
+  // Twiddle factors for the Stockham algorithm, or chirp for Bluestein's one.
+  std::vector<double> cosine_table_;
+  std::vector<double> sine_table_;
+
+  // Spectrum of the chirp for Bluestein's algorithm.
+  std::vector<double> chirp_real_part_spectrum_;
+  std::vector<double> chirp_imag_part_spectrum_;
+
+  // Power-of-two FFT for Bluestein's algorithm.
+  FastFourierTransform* fast_fourier_transform_;
+
+  DISALLOW_COPY_AND_ASSIGN(MixedRadixFastFourierTransform);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_MATH_MIXED_RADIX_FAST_FOURIER_TRANSFORM_H_
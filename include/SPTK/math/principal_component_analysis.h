@@ -51,7 +51,15 @@ namespace sptk {
  *     \lambda(0), & \lambda(1), & \ldots, & \lambda(M).
  *   \end{array}
  * @f]
- * The eigenvalue problem is solved by the Jacobi iterative method.
+ * The eigenvalue problem is solved by one of the following algorithms:
+ *
+ * - The Jacobi iterative method, which gives the same signs of eigenvectors
+ *   as SPTK3.
+ * - The Householder tridiagonalization followed by the implicit QL method.
+ * - The Lanczos method, which computes only the first @f$N@f$ eigenpairs.
+ *
+ * The statistics of the input vectors can be accumulated one by one, so that
+ * the whole input need not be held in memory.
  */
 class PrincipalComponentAnalysis {
  public:
@@ -65,12 +73,22 @@ class PrincipalComponentAnalysis {
     kNumCovarianceTypes,
   };
 
+  /**
+   * Algorithm for solving eigenvalue problem.
+   */
+  enum Algorithms {
+    kJacobi = 0,
+    kHouseholderQl,
+    kLanczos,
+    kNumAlgorithms,
+  };
+
   /**
    * Buffer for PrincipalComponentAnalysis class.
    */
   class Buffer {
    public:
-    Buffer() {
+    Buffer() : total_variance_(0.0) {
     }
 
     virtual ~Buffer() {
@@ -80,6 +98,7 @@ class PrincipalComponentAnalysis {
     StatisticsAccumulation::Buffer buffer_for_accumulation;
     SymmetricMatrix a_;
     std::vector<int> order_of_eigenvalue_;
+    double total_variance_;
 
     friend class PrincipalComponentAnalysis;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -87,13 +106,19 @@ class PrincipalComponentAnalysis {
 
   /**
    * @param[in] num_order Order of vector, @f$M@f$.
-   * @param[in] num_iteration Number of iterations.
-   * @param[in] convergence_threshold Convergence threshold.
+   * @param[in] num_iteration Number of iterations of the Jacobi method.
+   * @param[in] convergence_threshold Convergence threshold of the Jacobi and
+   *            Lanczos methods.
    * @param[in] covariance_type Type of covariance.
+   * @param[in] algorithm Algorithm for solving eigenvalue problem.
+   * @param[in] num_principal_component Number of principal components
+   *            computed by the Lanczos method, @f$N@f$. If zero, @f$M+1@f$.
    */
   PrincipalComponentAnalysis(int num_order, int num_iteration,
                              double convergence_threshold,
-                             CovarianceType covariance_type);
+                             CovarianceType covariance_type,
+                             Algorithms algorithm = kJacobi,
+                             int num_principal_component = 0);
 
   virtual ~PrincipalComponentAnalysis() {
   }
@@ -126,6 +151,20 @@ class PrincipalComponentAnalysis {
     return covariance_type_;
   }
 
+  /**
+   * @return Algorithm for solving eigenvalue problem.
+   */
+  Algorithms GetAlgorithm() const {
+    return algorithm_;
+  }
+
+  /**
+   * @return Number of principal components.
+   */
+  int GetNumPrincipalComponent() const {
+    return num_principal_component_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -137,9 +176,11 @@ class PrincipalComponentAnalysis {
    * @param[in] input_vectors @f$M@f$-th order input vectors.
    *            The shape is @f$[T, M+1]@f$.
    * @param[out] mean_vector @f$M@f$-th order mean vector.
-   * @param[out] eigenvalues @f$M+1@f$ eigenvalues.
+   * @param[out] eigenvalues @f$M+1@f$ eigenvalues, or @f$N@f$ eigenvalues
+   *             for the Lanczos method.
    * @param[out] eigenvectors @f$M@f$-th order eigenvectors.
-   *             The shape is @f$[M+1, M+1]@f$.
+   *             The shape is @f$[M+1, M+1]@f$, or @f$[N, M+1]@f$ for the
+   *             Lanczos method.
    * @param[out] buffer Buffer.
    * @return True on success, false on failure.
    */
@@ -148,11 +189,59 @@ class PrincipalComponentAnalysis {
            Matrix* eigenvectors,
            PrincipalComponentAnalysis::Buffer* buffer) const;
 
+  /**
+   * Clear accumulated statistics.
+   *
+   * @param[out] buffer Buffer.
+   */
+  void Clear(PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  /**
+   * Accumulate statistics of an input vector.
+   *
+   * @param[in] input_vector @f$M@f$-th order input vector.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Accumulate(const std::vector<double>& input_vector,
+                  PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  /**
+   * Perform principal component analysis on accumulated statistics.
+   *
+   * @param[out] mean_vector @f$M@f$-th order mean vector.
+   * @param[out] eigenvalues @f$M+1@f$ eigenvalues, or @f$N@f$ eigenvalues
+   *             for the Lanczos method.
+   * @param[out] eigenvectors @f$M@f$-th order eigenvectors.
+   *             The shape is @f$[M+1, M+1]@f$, or @f$[N, M+1]@f$ for the
+   *             Lanczos method.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<double>* mean_vector, std::vector<double>* eigenvalues,
+           Matrix* eigenvectors,
+           PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  /**
+   * Get total variance, i.e., the sum of all the eigenvalues.
+   *
+   * @param[in] buffer Buffer given to Run.
+   * @param[out] total_variance Total variance.
+   * @return True on success, false on failure.
+   */
+  bool GetTotalVariance(const PrincipalComponentAnalysis::Buffer& buffer,
+                        double* total_variance) const;
+
  private:
+  bool RunJacobiMethod(std::vector<double>* eigenvalues, Matrix* eigenvectors,
+                       PrincipalComponentAnalysis::Buffer* buffer) const;
+
   const int num_order_;
   const int num_iteration_;
   const double convergence_threshold_;
   const CovarianceType covariance_type_;
+  const Algorithms algorithm_;
+  const int num_principal_component_;
 
   const StatisticsAccumulation accumulation_;
 
@@ -25,6 +25,10 @@ namespace sptk {
 
 /**
  * Perform a sequence of scalar operations.
+ *
+ * The operations can be applied to a block of numbers at once. Adjacent
+ * addition, subtraction, multiplication, and division are fused into one
+ * module when they are added, which processes the block in a single pass.
  */
 class ScalarOperation {
  public:
@@ -41,18 +45,21 @@ class ScalarOperation {
      * @param[in,out] is_magic_number True if output is magic number.
      */
     virtual bool Run(double* number, bool* is_magic_number) const = 0;
+
+    /**
+     * @param[in] length Number of numbers.
+     * @param[in,out] numbers Input/output numbers.
+     * @param[in,out] is_magic_numbers True if output is magic number.
+     */
+    virtual bool Run(int length, double* numbers,
+                     bool* is_magic_numbers) const = 0;
   };
 
-  ScalarOperation() : use_magic_number_(false) {
+  ScalarOperation()
+      : use_magic_number_(false), last_affine_transformation_(NULL) {
   }
 
-  virtual ~ScalarOperation() {
-    for (std::vector<ScalarOperation::ModuleInterface*>::iterator itr(
-             modules_.begin());
-         itr != modules_.end(); ++itr) {
-      delete (*itr);
-    }
-  }
+  virtual ~ScalarOperation();
 
   /**
    * @f$x + a@f$
@@ -290,9 +297,23 @@ class ScalarOperation {
    */
   bool Run(double* number, bool* is_magic_number) const;
 
+  /**
+   * @param[in] length Number of numbers.
+   * @param[in,out] numbers Input/output numbers.
+   * @param[out] is_magic_numbers True if output is magic number.
+   * @return True on success, false on failure.
+   */
+  bool Run(int length, double* numbers, bool* is_magic_numbers) const;
+
  private:
+  class AffineTransformation;
+
+  AffineTransformation* GetAffineTransformation();
+
   bool use_magic_number_;
 
+  AffineTransformation* last_affine_transformation_;
+
   std::vector<ScalarOperation::ModuleInterface*> modules_;
 
   DISALLOW_COPY_AND_ASSIGN(ScalarOperation);
@@ -19,6 +19,8 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
+
 namespace sptk {
 
 /**
@@ -167,6 +169,43 @@ class SymmetricMatrix {
    */
   bool Invert(SymmetricMatrix* inverse_matrix) const;
 
+  /**
+   * Perform eigenvalue decomposition.
+   *
+   * The matrix is reduced to a tridiagonal matrix by Householder
+   * transformations, and then the eigenvalues and eigenvectors of the
+   * tridiagonal matrix are computed by the implicit QL method. The sign of
+   * each eigenvector is chosen so that its largest element is positive.
+   *
+   * @param[out] eigenvalues Eigenvalues in descending order.
+   * @param[out] eigenvectors Eigenvectors. The i-th row is the eigenvector
+   *             corresponding to the i-th eigenvalue.
+   * @return True on success, false on failure.
+   */
+  bool EigenvalueDecomposition(std::vector<double>* eigenvalues,
+                               Matrix* eigenvectors) const;
+
+  /**
+   * Compute the largest eigenvalues and the corresponding eigenvectors.
+   *
+   * The Lanczos method with full reorthogonalization is used. The iteration
+   * stops when the residual norms of all the required Ritz pairs are below
+   * the convergence threshold, or when the Krylov subspace spans the whole
+   * space. The sign of each eigenvector is chosen so that its largest element
+   * is positive.
+   *
+   * @param[in] num_eigenvalue Number of eigenvalues, @f$K@f$.
+   * @param[in] convergence_threshold Convergence threshold.
+   * @param[out] eigenvalues @f$K@f$ eigenvalues in descending order.
+   * @param[out] eigenvectors Eigenvectors. The shape is @f$[K, N]@f$, where
+   *             @f$N@f$ is the number of dimensions.
+   * @return True on success, false on failure.
+   */
+  bool PartialEigenvalueDecomposition(int num_eigenvalue,
+                                      double convergence_threshold,
+                                      std::vector<double>* eigenvalues,
+                                      Matrix* eigenvectors) const;
+
  private:
   int num_dimension_;
 
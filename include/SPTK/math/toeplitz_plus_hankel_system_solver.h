@@ -19,7 +19,6 @@
 
 #include <vector>  // std::vector
 
-#include "SPTK/math/matrix2d.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -87,27 +86,17 @@ class ToeplitzPlusHankelSystemSolver {
    */
   class Buffer {
    public:
-    Buffer() : ep_(2), g_(2), bar_(2), tmp_vector_(2) {
+    Buffer() {
     }
 
     virtual ~Buffer() {
     }
 
    private:
-    std::vector<Matrix2D> r_;
-    std::vector<Matrix2D> x_;
-    std::vector<Matrix2D> prev_x_;
-    std::vector<std::vector<double>> p_;
-    std::vector<double> ep_;
-    std::vector<double> g_;
-    std::vector<double> bar_;
-    std::vector<double> tmp_vector_;
-    Matrix2D vx_;
-    Matrix2D ex_;
-    Matrix2D bx_;
-    Matrix2D inv_;
-    Matrix2D tau_;
-    Matrix2D tmp_matrix_;
+    // 2x2 matrices are stored in row-major order and concatenated.
+    std::vector<double> r_;
+    std::vector<double> x_;
+    std::vector<double> p_;
 
     friend class ToeplitzPlusHankelSystemSolver;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_UTILS_BUFFERED_INPUT_STREAM_H_
+#define SPTK_UTILS_BUFFERED_INPUT_STREAM_H_
+
+#include <cstddef>   // std::size_t
+#include <cstring>   // std::memcpy
+#include <iostream>  // std::istream
+#include <vector>    // std::vector
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Read binary data from stream through a large internal buffer.
+ *
+ * This class is a drop-in replacement of sptk::ReadStream for reading data
+ * one by one. The underlying stream is read in large chunks, so that the
+ * per-call overhead of std::istream::read is paid once per chunk instead of
+ * once per scalar. The stream must not be read by others while this object is
+ * in use.
+ */
+class BufferedInputStream {
+ public:
+  /**
+   * @param[in] input_stream Stream to be read.
+   */
+  explicit BufferedInputStream(std::istream* input_stream);
+
+  /**
+   * @param[in] input_stream Stream to be read.
+   * @param[in] buffer_size Size of internal buffer in bytes.
+   */
+  BufferedInputStream(std::istream* input_stream, int buffer_size);
+
+  virtual ~BufferedInputStream() {
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[out] data_to_read Scalar.
+   * @return True on success, false on failure.
+   */
+  template <typename T>
+  bool Read(T* data_to_read) {
+    if (NULL == data_to_read) {
+      return false;
+    }
+    if (end_ - position_ < sizeof(*data_to_read) &&
+        !Fill(sizeof(*data_to_read))) {
+      return false;
+    }
+    std::memcpy(reinterpret_cast<char*>(data_to_read), &(buffer_[position_]),
+                sizeof(*data_to_read));
+    position_ += sizeof(*data_to_read);
+    return true;
+  }
+
+  /**
+   * @param[in] read_size Number of data to be read.
+   * @param[out] data_to_read Array.
+   * @return Number of data actually read. It may be less than read_size when
+   *         the rest is not buffered yet, and is zero at the end of stream.
+   */
+  template <typename T>
+  int Read(int read_size, T* data_to_read) {
+    if (read_size <= 0 || NULL == data_to_read) {
+      return 0;
+    }
+    const int num_read_bytes(ReadBytes(read_size * sizeof(*data_to_read),
+                                       sizeof(*data_to_read),
+                                       reinterpret_cast<char*>(data_to_read)));
+    return num_read_bytes / static_cast<int>(sizeof(*data_to_read));
+  }
+
+ private:
+  bool Fill(std::size_t num_required_bytes);
+
+  int ReadBytes(std::size_t num_bytes, std::size_t unit_size,
+                char* data_to_read);
+
+  std::istream* input_stream_;
+
+  bool is_valid_;
+
+  std::vector<char> buffer_;
+  std::size_t position_;
+  std::size_t end_;
+
+  DISALLOW_COPY_AND_ASSIGN(BufferedInputStream);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_BUFFERED_INPUT_STREAM_H_
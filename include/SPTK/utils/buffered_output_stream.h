@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_UTILS_BUFFERED_OUTPUT_STREAM_H_
+#define SPTK_UTILS_BUFFERED_OUTPUT_STREAM_H_
+
+#include <cstddef>   // std::size_t
+#include <cstring>   // std::memcpy
+#include <iostream>  // std::ostream
+#include <vector>    // std::vector
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Write binary data to stream through a large internal buffer.
+ *
+ * This class is a drop-in replacement of sptk::WriteStream for writing data
+ * one by one. The data is written to the underlying stream when the internal
+ * buffer is full, when Flush() is called, or when this object is destructed.
+ * Call Flush() explicitly at the end to check the last write.
+ */
+class BufferedOutputStream {
+ public:
+  /**
+   * @param[out] output_stream Stream to be written.
+   */
+  explicit BufferedOutputStream(std::ostream* output_stream);
+
+  /**
+   * @param[out] output_stream Stream to be written.
+   * @param[in] buffer_size Size of internal buffer in bytes.
+   */
+  BufferedOutputStream(std::ostream* output_stream, int buffer_size);
+
+  virtual ~BufferedOutputStream() {
+    Flush();
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[in] data_to_write Scalar.
+   * @return True on success, false on failure.
+   */
+  template <typename T>
+  bool Write(T data_to_write) {
+    if (buffer_.size() - position_ < sizeof(data_to_write) &&
+        (!Flush() || buffer_.size() < sizeof(data_to_write))) {
+      return false;
+    }
+    std::memcpy(&(buffer_[position_]), &data_to_write, sizeof(data_to_write));
+    position_ += sizeof(data_to_write);
+    return true;
+  }
+
+  /**
+   * @param[in] write_size Number of data to be written.
+   * @param[in] data_to_write Array.
+   * @return True on success, false on failure.
+   */
+  template <typename T>
+  bool Write(int write_size, const T* data_to_write) {
+    if (write_size < 0 || NULL == data_to_write) {
+      return false;
+    }
+    return WriteBytes(write_size * sizeof(*data_to_write),
+                      reinterpret_cast<const char*>(data_to_write));
+  }
+
+  /**
+   * Write buffered data to stream.
+   *
+   * @return True on success, false on failure.
+   */
+  bool Flush();
+
+ private:
+  bool WriteBytes(std::size_t num_bytes, const char* data_to_write);
+
+  std::ostream* output_stream_;
+
+  bool is_valid_;
+
+  std::vector<char> buffer_;
+  std::size_t position_;
+
+  DISALLOW_COPY_AND_ASSIGN(BufferedOutputStream);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_BUFFERED_OUTPUT_STREAM_H_
@@ -17,7 +17,8 @@
 #ifndef SPTK_UTILS_MISC_UTILS_H_
 #define SPTK_UTILS_MISC_UTILS_H_
 
-#include <vector>  // std::vector
+#include <cstddef>  // NULL
+#include <vector>   // std::vector
 
 namespace sptk {
 
@@ -89,12 +90,14 @@ bool ComputePercentagePointOfTDistribution(double probability,
  * @param[in] initial_step_size Initial step size.
  * @param[out] filter_banks Filter banks.
  * @param[out] is_converged True if convergence is reached (optional).
+ * @param[out] prototype_filter Prototype filter (optional).
  * @return True on success, false on failure.
  */
 bool MakePseudoQuadratureMirrorFilterBanks(
     bool inverse, int num_subband, int num_order, double attenuation,
     int num_iteration, double convergence_threshold, double initial_step_size,
-    std::vector<std::vector<double> >* filter_banks, bool* is_converged);
+    std::vector<std::vector<double> >* filter_banks, bool* is_converged,
+    std::vector<double>* prototype_filter = NULL);
 
 /**
  * Perform 1D convolution.
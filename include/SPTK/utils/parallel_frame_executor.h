@@ -0,0 +1,144 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_UTILS_PARALLEL_FRAME_EXECUTOR_H_
+#define SPTK_UTILS_PARALLEL_FRAME_EXECUTOR_H_
+
+#include <functional>  // std::function
+#include <ostream>     // std::ostream
+#include <vector>      // std::vector
+
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Process independent frames by multiple threads while keeping their order.
+ *
+ * The engine classes of SPTK follow the concurrency contract below:
+ *
+ * - The configuration of an engine is fixed in its constructor and the Run
+ *   methods are @c const, so that one engine can be shared by any number of
+ *   threads.
+ * - Any memory modified during Run is held in a Buffer given by the caller.
+ *   A Buffer must not be used by two threads at the same time.
+ *
+ * This class relies on the contract. The frame processors given to the
+ * constructor typically refer to shared engines and own their Buffers, and
+ * each of them is used by one worker thread. The workers read consecutive
+ * frames from an input source by turns and process them as a job. Since the
+ * jobs finish in arbitrary order, the results are held in a reorder buffer
+ * and written in the order of input. The number of jobs in flight is
+ * bounded, so that the memory usage does not depend on the input length.
+ *
+ * The messages of the frame processors are held with the results and written
+ * to the standard error in the order of input. If a frame fails to be
+ * processed, the results and the messages of the preceding frames are written
+ * and the succeeding frames are discarded, as in the case of processing them
+ * one by one.
+ *
+ * In addition, RunInChunks processes an in-memory range split into contiguous
+ * chunks, which suits accumulating statistics over a whole data set.
+ */
+class ParallelFrameExecutor {
+ public:
+  /**
+   * Interface of frame processing.
+   */
+  class FrameProcessorInterface {
+   public:
+    virtual ~FrameProcessorInterface() {
+    }
+
+    /**
+     * @param[in] frame_index Index of input frame.
+     * @param[in] input Input frame.
+     * @param[out] output Output frame.
+     * @param[out] log Stream to which the messages on the frame are written
+     *             instead of the standard error.
+     * @return True on success, false on failure.
+     */
+    virtual bool Run(int frame_index, const std::vector<double>& input,
+                     std::vector<double>* output, std::ostream* log) = 0;
+  };
+
+  /**
+   * @param[in] frame_processors Frame processors. The number of processors
+   *            gives the number of threads.
+   */
+  explicit ParallelFrameExecutor(
+      const std::vector<FrameProcessorInterface*>& frame_processors);
+
+  virtual ~ParallelFrameExecutor() {
+  }
+
+  /**
+   * @return Number of threads.
+   */
+  int GetNumThread() const {
+    return static_cast<int>(frame_processors_.size());
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[in,out] input_source Input source. It is read until its end.
+   * @param[out] output_stream Stream to which the output frames are written.
+   * @param[out] is_processed True if all the read frames are processed
+   *             successfully (optional). This tells whether a failure is due
+   *             to processing or writing.
+   * @return True on success, false on failure.
+   */
+  bool Run(InputSourceInterface* input_source, std::ostream* output_stream,
+           bool* is_processed);
+
+  /**
+   * Process the items in [0, num_item) by multiple threads.
+   *
+   * The range is split into @p num_chunk contiguous chunks of almost the same
+   * size, and each chunk is processed by one thread. The boundaries of the
+   * chunks depend only on @p num_item and @p num_chunk, so that a reduction
+   * over the chunks in the order of their indices is reproducible.
+   *
+   * @param[in] num_item Number of items.
+   * @param[in] num_chunk Number of chunks, i.e., number of threads.
+   * @param[in] job Function called as job(chunk_index, begin, end). It returns
+   *            true on success, false on failure.
+   * @return True if all the chunks are processed successfully.
+   */
+  static bool RunInChunks(int num_item, int num_chunk,
+                          const std::function<bool(int, int, int)>& job);
+
+ private:
+  bool RunSequentially(InputSourceInterface* input_source,
+                       std::ostream* output_stream, bool* is_processed);
+
+  const std::vector<FrameProcessorInterface*> frame_processors_;
+
+  bool is_valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelFrameExecutor);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_PARALLEL_FRAME_EXECUTOR_H_
@@ -64,6 +64,20 @@ bool ReadStream(T* data_to_read, std::istream* input_stream);
  */
 bool ReadStream(sptk::Matrix* matrix_to_read, std::istream* input_stream);
 
+/**
+ * Read a block of rows. Unlike the above function, the read succeeds even if
+ * the stream ends before all @f$N@f$ rows are filled. In that case, the matrix
+ * is shrunk to the @f$N'@f$ rows actually read, and the last incomplete row is
+ * discarded.
+ *
+ * @param[in,out] matrix_to_read Matrix with @f$N@f$ rows.
+ * @param[out] input_stream Stream to be read.
+ * @param[out] actual_num_row Actual number of read rows, @f$N'@f$ (optional).
+ * @return True if at least one row is read, false otherwise.
+ */
+bool ReadStream(sptk::Matrix* matrix_to_read, std::istream* input_stream,
+                int* actual_num_row);
+
 /**
  * @param[out] matrix_to_read Symmetric matrix.
  * @param[out] input_stream Stream to be read.
@@ -274,6 +288,17 @@ void PrintDataType(const std::string& symbol, std::ostream* stream);
 void PrintErrorMessage(const std::string& program_name,
                        const std::ostringstream& message);
 
+/**
+ * Print error message to stream.
+ *
+ * @param[in] program_name Name of SPTK command.
+ * @param[in] message Error message.
+ * @param[out] stream Stream to which the message is written.
+ */
+void PrintErrorMessage(const std::string& program_name,
+                       const std::ostringstream& message,
+                       std::ostream* stream);
+
 }  // namespace sptk
 
 #endif  // SPTK_UTILS_SPTK_UTILS_H_
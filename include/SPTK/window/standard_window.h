@@ -45,6 +45,21 @@ class StandardWindow : public WindowInterface {
     kTrapezoidal,
   };
 
+  /**
+   * Number of window types selectable by index in the commands.
+   */
+  static const int kNumIndexedWindowTypes = 6;
+
+  /**
+   * Get window type from the index used in the commands: 0 Blackman,
+   * 1 Hamming, 2 Hanning, 3 Bartlett, 4 trapezoidal, and 5 rectangular.
+   *
+   * @param[in] index Index of window type.
+   * @param[out] window_type Window type.
+   * @return True on success, false on failure.
+   */
+  static bool GetWindowTypeFromIndex(int index, WindowType* window_type);
+
   /**
    * @param[in] window_length Window length.
    * @param[in] window_type Window type.
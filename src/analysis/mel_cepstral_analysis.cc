@@ -18,12 +18,16 @@
 
 #include <algorithm>   // std::copy, std::fill, std::transform, etc.
 #include <cfloat>      // DBL_MAX
-#include <cmath>       // std::exp, std::fabs, std::log
+#include <cmath>       // std::exp, std::fabs, std::isfinite, std::log
 #include <cstddef>     // std::size_t
 #include <functional>  // std::minus, std::plus
 
 namespace {
 
+// Weight of the correction given by the previous frame. The full correction
+// often makes the Newton-Raphson method unstable.
+const double kWarmStartWeight(0.5);
+
 void CoefficientsFrequencyTransform(const std::vector<double>& input,
                                     int input_length, int output_length,
                                     double alpha, std::vector<double>* output,
@@ -68,12 +72,14 @@ namespace sptk {
 
 MelCepstralAnalysis::MelCepstralAnalysis(int fft_length, int num_order,
                                          double alpha, int num_iteration,
-                                         double convergence_threshold)
+                                         double convergence_threshold,
+                                         bool warm_start)
     : fft_length_(fft_length),
       num_order_(num_order),
       alpha_(alpha),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
+      warm_start_(warm_start),
       fourier_transform_(fft_length_),
       inverse_fourier_transform_(fft_length_),
       frequency_transform_(fft_length_ / 2, num_order_, alpha_),
@@ -161,7 +167,54 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
     }
   }
 
+  // Correct the initial guess using the previous frame.
+  const bool is_warm_started(
+      warm_start_ &&
+      buffer->correction_.size() == static_cast<std::size_t>(length));
+  if (warm_start_) {
+    buffer->initial_guess_ = *mel_cepstrum;
+  }
+  if (is_warm_started) {
+    std::transform(mel_cepstrum->begin(), mel_cepstrum->end(),
+                   buffer->correction_.begin(), mel_cepstrum->begin(),
+                   [](double c, double d) { return c + kWarmStartWeight * d; });
+  }
+
   // Perform Newton-Raphson method.
+  bool is_diverged(false);
+  if (!NewtonRaphsonMethod(is_warm_started, mel_cepstrum, buffer,
+                           &is_diverged)) {
+    return false;
+  }
+  if (is_diverged) {
+    *mel_cepstrum = buffer->initial_guess_;
+    if (!NewtonRaphsonMethod(false, mel_cepstrum, buffer, &is_diverged)) {
+      return false;
+    }
+  }
+
+  // Save the correction for the next frame.
+  if (warm_start_) {
+    buffer->correction_.resize(length);
+    for (int m(0); m < length; ++m) {
+      const double correction((*mel_cepstrum)[m] - buffer->initial_guess_[m]);
+      if (!std::isfinite(correction)) {
+        buffer->correction_.clear();
+        break;
+      }
+      buffer->correction_[m] = correction;
+    }
+  }
+
+  return true;
+}
+
+bool MelCepstralAnalysis::NewtonRaphsonMethod(
+    bool is_warm_started, std::vector<double>* mel_cepstrum,
+    MelCepstralAnalysis::Buffer* buffer, bool* is_diverged) const {
+  const int half_fft_length(fft_length_ / 2);
+  const int length(num_order_ + 1);
+
   double prev_epsilon(DBL_MAX);
   for (int n(0); n < num_iteration_; ++n) {
     // \tilde{c} -> c
@@ -206,6 +259,12 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
     // retain the compatibility with SPTK3, this block is written here)
     {
       const double epsilon(buffer->rt_[0]);
+      if (is_warm_started &&
+          (!std::isfinite(epsilon) ||
+           std::fabs(prev_epsilon - 1.0) < std::fabs(epsilon - 1.0))) {
+        *is_diverged = true;
+        return true;
+      }
       const double relative_change((epsilon - prev_epsilon) / epsilon);
       if (std::fabs(relative_change) < convergence_threshold_) {
         break;
@@ -228,6 +287,10 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
     if (!toeplitz_plus_hankel_system_solver_.Run(
             buffer->rr_, buffer->rt_, buffer->ra_, &buffer->gradient_,
             &buffer->buffer_for_system_solver_)) {
+      if (is_warm_started) {
+        *is_diverged = true;
+        return true;
+      }
       return false;
     }
 
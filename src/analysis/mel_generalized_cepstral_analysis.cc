@@ -17,12 +17,16 @@
 #include "SPTK/analysis/mel_generalized_cepstral_analysis.h"
 
 #include <algorithm>   // std::copy, std::fill, std::transform, etc.
-#include <cmath>       // std::exp, std::fabs, std::pow, std::sqrt
+#include <cmath>       // std::exp, std::fabs, std::isfinite, std::pow, etc.
 #include <cstddef>     // std::size_t
 #include <functional>  // std::plus
 
 namespace {
 
+// Weight of the correction given by the previous frame. The full correction
+// often makes the Newton-Raphson method unstable.
+const double kWarmStartWeight(0.5);
+
 void CoefficientsFrequencyTransform(const std::vector<double>& input,
                                     int input_length, int output_length,
                                     double alpha, std::vector<double>* output,
@@ -104,13 +108,14 @@ namespace sptk {
 
 MelGeneralizedCepstralAnalysis::MelGeneralizedCepstralAnalysis(
     int fft_length, int num_order, double alpha, double gamma,
-    int num_iteration, double convergence_threshold)
+    int num_iteration, double convergence_threshold, bool warm_start)
     : fft_length_(fft_length),
       num_order_(num_order),
       alpha_(alpha),
       gamma_(gamma),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
+      warm_start_(warm_start),
       fourier_transform_(fft_length_),
       inverse_fourier_transform_(fft_length_),
       complex_valued_inverse_fourier_transform_(fft_length_),
@@ -142,7 +147,8 @@ MelGeneralizedCepstralAnalysis::MelGeneralizedCepstralAnalysis(
 
   if (0.0 == gamma_) {
     mel_cepstral_analysis_ = new MelCepstralAnalysis(
-        fft_length_, num_order_, alpha_, num_iteration_, convergence_threshold);
+        fft_length_, num_order_, alpha_, num_iteration_, convergence_threshold,
+        warm_start_);
   }
 }
 
@@ -248,18 +254,43 @@ bool MelGeneralizedCepstralAnalysis::Run(
 
   // Update coefficients using gradient method.
   if (-1.0 != gamma_) {
-    for (int n(1); n <= num_iteration_; ++n) {
-      double epsilon;
-      if (!NewtonRaphsonMethod(gamma_, &epsilon, buffer)) {
+    // Correct the initial guess using the previous frame.
+    const bool is_warm_started(
+        warm_start_ &&
+        buffer->correction_.size() == static_cast<std::size_t>(length));
+    if (warm_start_) {
+      buffer->initial_guess_ = buffer->b_;
+    }
+    if (is_warm_started) {
+      std::transform(
+          buffer->b_.begin(), buffer->b_.end(), buffer->correction_.begin(),
+          buffer->b_.begin(),
+          [](double b, double d) { return b + kWarmStartWeight * d; });
+    }
+
+    bool is_diverged(false);
+    if (!UpdateCoefficients(is_warm_started, prev_epsilon, buffer,
+                            &is_diverged)) {
+      return false;
+    }
+    if (is_diverged) {
+      buffer->b_ = buffer->initial_guess_;
+      if (!UpdateCoefficients(false, prev_epsilon, buffer, &is_diverged)) {
         return false;
       }
+    }
 
-      // Check convergence.
-      const double relative_change((epsilon - prev_epsilon) / epsilon);
-      if (std::fabs(relative_change) < convergence_threshold_) {
-        break;
+    // Save the correction for the next frame.
+    if (warm_start_) {
+      buffer->correction_.resize(length);
+      for (int m(0); m < length; ++m) {
+        const double correction(buffer->b_[m] - buffer->initial_guess_[m]);
+        if (!std::isfinite(correction)) {
+          buffer->correction_.clear();
+          break;
+        }
+        buffer->correction_[m] = correction;
       }
-      prev_epsilon = epsilon;
     }
   }
 
@@ -276,6 +307,38 @@ bool MelGeneralizedCepstralAnalysis::Run(
   return true;
 }
 
+bool MelGeneralizedCepstralAnalysis::UpdateCoefficients(
+    bool is_warm_started, double initial_epsilon,
+    MelGeneralizedCepstralAnalysis::Buffer* buffer, bool* is_diverged) const {
+  double prev_epsilon(initial_epsilon);
+  for (int n(1); n <= num_iteration_; ++n) {
+    double epsilon;
+    if (!NewtonRaphsonMethod(gamma_, &epsilon, buffer)) {
+      if (is_warm_started) {
+        *is_diverged = true;
+        return true;
+      }
+      return false;
+    }
+
+    // The criterion should decrease monotonically after the first update.
+    if (is_warm_started &&
+        (!std::isfinite(epsilon) || (1 < n && prev_epsilon < epsilon))) {
+      *is_diverged = true;
+      return true;
+    }
+
+    // Check convergence.
+    const double relative_change((epsilon - prev_epsilon) / epsilon);
+    if (std::fabs(relative_change) < convergence_threshold_) {
+      break;
+    }
+    prev_epsilon = epsilon;
+  }
+
+  return true;
+}
+
 bool MelGeneralizedCepstralAnalysis::NewtonRaphsonMethod(
     double gamma, double* epsilon,
     MelGeneralizedCepstralAnalysis::Buffer* buffer) const {
@@ -16,13 +16,18 @@
 
 #include "SPTK/analysis/pitch_extraction_by_rapt.h"
 
-#include <algorithm>  // std::copy, std::fill
+#include <algorithm>  // std::copy, std::fill, std::min
 #include <cmath>      // std::ceil
+#include <cstddef>    // std::size_t
 
 #include "Snack/jkGetF0.h"
 
 namespace sptk {
 
+PitchExtractionByRapt::Buffer::~Buffer() {
+  snack::cGet_f0_close(stream_);
+}
+
 PitchExtractionByRapt::PitchExtractionByRapt(int frame_shift,
                                              double sampling_rate,
                                              double lower_f0, double upper_f0,
@@ -80,4 +85,65 @@ bool PitchExtractionByRapt::Get(
   return true;
 }
 
+bool PitchExtractionByRapt::GetIncrementally(
+    const std::vector<double>& waveform, bool is_last_chunk,
+    std::vector<double>* f0, PitchExtractionInterface::Buffer* buffer) const {
+  // Check inputs.
+  PitchExtractionByRapt::Buffer* rapt_buffer(
+      dynamic_cast<PitchExtractionByRapt::Buffer*>(buffer));
+  if (!is_valid_ || NULL == f0 || NULL == rapt_buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (NULL == rapt_buffer->stream_) {
+    rapt_buffer->stream_ =
+        snack::cGet_f0_open(frame_shift_, sampling_rate_, lower_f0_, upper_f0_,
+                            voicing_threshold_);
+    if (NULL == rapt_buffer->stream_) {
+      return false;
+    }
+  }
+
+  std::vector<float> tmp_f0;
+  if (0 != snack::cGet_f0_write(rapt_buffer->stream_, waveform,
+                                is_last_chunk ? 1 : 0, &tmp_f0)) {
+    return false;
+  }
+  rapt_buffer->num_sample_ += waveform.size();
+  rapt_buffer->f0_.insert(rapt_buffer->f0_.end(), tmp_f0.begin(),
+                          tmp_f0.end());
+  if (is_last_chunk && 0 == rapt_buffer->num_sample_) {
+    return false;
+  }
+
+  // Output frames within the length of the given waveform.
+  const std::int64_t target_length(
+      (rapt_buffer->num_sample_ + frame_shift_ - 1) / frame_shift_);
+  const int num_output(static_cast<int>(
+      std::min(target_length - rapt_buffer->num_frame_,
+               static_cast<std::int64_t>(rapt_buffer->f0_.size()))));
+  f0->assign(rapt_buffer->f0_.begin(), rapt_buffer->f0_.begin() + num_output);
+  rapt_buffer->f0_.erase(rapt_buffer->f0_.begin(),
+                         rapt_buffer->f0_.begin() + num_output);
+  rapt_buffer->num_frame_ += num_output;
+  if (0 < num_output) {
+    rapt_buffer->last_f0_ = f0->back();
+  }
+
+  // Pad the last frame as the batch mode does. The last frame may have been
+  // output with the previous chunk.
+  if (is_last_chunk && rapt_buffer->num_frame_ < target_length) {
+    if (0 == rapt_buffer->num_frame_) {
+      return false;
+    }
+    f0->resize(static_cast<std::size_t>(f0->size() + target_length -
+                                        rapt_buffer->num_frame_),
+               rapt_buffer->last_f0_);
+    rapt_buffer->num_frame_ = target_length;
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -0,0 +1,142 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/analysis/pitch_extraction_with_voting.h"
+
+#include <algorithm>  // std::find, std::max, std::min
+#include <chrono>     // std::chrono
+#include <cmath>      // std::exp, std::log
+#include <cstddef>    // std::size_t
+
+#include "SPTK/filter/median_filter.h"
+#include "SPTK/input/input_source_from_vector.h"
+#include "SPTK/utils/parallel_frame_executor.h"
+
+namespace sptk {
+
+PitchExtractionWithVoting::PitchExtractionWithVoting(
+    int frame_shift, double sampling_rate, double lower_f0, double upper_f0,
+    const std::vector<double>& voicing_thresholds,
+    const std::vector<PitchExtraction::Algorithms>& algorithms,
+    int num_filter_order, int num_thread)
+    : num_filter_order_(num_filter_order),
+      num_thread_(num_thread),
+      is_valid_(true) {
+  if (algorithms.empty() || voicing_thresholds.size() != algorithms.size() ||
+      num_filter_order_ < 0 || num_thread_ <= 0) {
+    is_valid_ = false;
+    return;
+  }
+
+  // The same algorithm cannot be run concurrently because some third-party
+  // implementations have static work areas.
+  for (std::size_t i(0); i < algorithms.size(); ++i) {
+    if (algorithms.end() !=
+        std::find(algorithms.begin() + i + 1, algorithms.end(),
+                  algorithms[i])) {
+      is_valid_ = false;
+      return;
+    }
+  }
+
+  const int num_algorithm(static_cast<int>(algorithms.size()));
+  pitch_extractions_.reserve(num_algorithm);
+  for (int i(0); i < num_algorithm; ++i) {
+    pitch_extractions_.push_back(new PitchExtraction(
+        frame_shift, sampling_rate, lower_f0, upper_f0, voicing_thresholds[i],
+        algorithms[i]));
+    if (!pitch_extractions_.back()->IsValid()) {
+      is_valid_ = false;
+      return;
+    }
+  }
+}
+
+PitchExtractionWithVoting::~PitchExtractionWithVoting() {
+  for (PitchExtraction* pitch_extraction : pitch_extractions_) {
+    delete pitch_extraction;
+  }
+}
+
+bool PitchExtractionWithVoting::Run(const std::vector<double>& waveform,
+                                    std::vector<double>* f0,
+                                    std::vector<double>* elapsed_times) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == f0) {
+    return false;
+  }
+
+  // Run algorithms. Each thread takes a contiguous range of algorithms.
+  const int num_algorithm(GetNumAlgorithm());
+  std::vector<std::vector<double> > f0s(num_algorithm);
+  std::vector<double> times(num_algorithm);
+  const auto job([&](int, int begin, int end) {
+    for (int i(begin); i < end; ++i) {
+      const auto start(std::chrono::steady_clock::now());
+      const bool is_success(
+          pitch_extractions_[i]->Run(waveform, &f0s[i], NULL, NULL));
+      const std::chrono::duration<double> elapsed_time(
+          std::chrono::steady_clock::now() - start);
+      times[i] = elapsed_time.count();
+      if (!is_success) return false;
+    }
+    return true;
+  });
+  if (!ParallelFrameExecutor::RunInChunks(
+          num_algorithm, std::min(num_thread_, num_algorithm), job)) {
+    return false;
+  }
+
+  // Arrange log F0s as a sequence of K-dimensional vectors. Missing frames
+  // are regarded as unvoiced.
+  std::size_t f0_length(0);
+  for (int i(0); i < num_algorithm; ++i) {
+    f0_length = std::max(f0_length, f0s[i].size());
+  }
+  std::vector<double> log_f0s(f0_length * num_algorithm, kLogZero);
+  for (int i(0); i < num_algorithm; ++i) {
+    for (std::size_t t(0); t < f0s[i].size(); ++t) {
+      if (0.0 < f0s[i][t]) {
+        log_f0s[t * num_algorithm + i] = std::log(f0s[i][t]);
+      }
+    }
+  }
+
+  // Vote by median filter across algorithms.
+  InputSourceFromVector input_source(false, num_algorithm, &log_f0s);
+  MedianFilter median_filter(num_algorithm - 1, num_filter_order_,
+                             &input_source, false, true, kLogZero);
+  if (!median_filter.IsValid()) {
+    return false;
+  }
+
+  f0->resize(f0_length);
+  std::vector<double> fused_log_f0(1);
+  for (std::size_t t(0); t < f0_length; ++t) {
+    if (!median_filter.Get(&fused_log_f0)) {
+      return false;
+    }
+    (*f0)[t] = (kLogZero == fused_log_f0[0]) ? 0.0 : std::exp(fused_log_f0[0]);
+  }
+
+  if (NULL != elapsed_times) {
+    elapsed_times->swap(times);
+  }
+
+  return true;
+}
+
+}  // namespace sptk
@@ -16,8 +16,9 @@
 
 #include "SPTK/compression/huffman_coding.h"
 
-#include <cstddef>  // std::size_t
-#include <queue>    // std::priority_queue
+#include <algorithm>  // std::sort
+#include <cstddef>    // std::size_t
+#include <queue>      // std::priority_queue
 
 namespace {
 
@@ -89,6 +90,38 @@ void Encode(const Node* node, std::string code,
   }
 }
 
+void MakeCanonical(std::vector<std::string>* codewords) {
+  const int num_element(static_cast<int>(codewords->size()));
+
+  // Sort symbols by code length. Ties are broken by symbol index.
+  std::vector<int> order(num_element);
+  for (int i(0); i < num_element; ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [codewords](int a, int b) {
+    const std::size_t length_a((*codewords)[a].length());
+    const std::size_t length_b((*codewords)[b].length());
+    return length_a < length_b || (length_a == length_b && a < b);
+  });
+
+  // Assign consecutive codewords. Long codes are handled as bit strings.
+  std::string code((*codewords)[order[0]].length(), '0');
+  (*codewords)[order[0]] = code;
+  for (int i(1); i < num_element; ++i) {
+    // Increment code.
+    for (int j(static_cast<int>(code.length()) - 1); 0 <= j; --j) {
+      if ('0' == code[j]) {
+        code[j] = '1';
+        break;
+      }
+      code[j] = '0';
+    }
+    // Extend code to the next length.
+    code.resize((*codewords)[order[i]].length(), '0');
+    (*codewords)[order[i]] = code;
+  }
+}
+
 void Free(const Node* node) {
   if (NULL == node) return;
   Free(node->GetLeft());
@@ -100,8 +133,8 @@ void Free(const Node* node) {
 
 namespace sptk {
 
-HuffmanCoding::HuffmanCoding(int num_element)
-    : num_element_(num_element), is_valid_(true) {
+HuffmanCoding::HuffmanCoding(int num_element, bool canonical)
+    : num_element_(num_element), canonical_(canonical), is_valid_(true) {
   if (num_element_ <= 0) {
     is_valid_ = false;
     return;
@@ -149,6 +182,9 @@ bool HuffmanCoding::Run(const std::vector<double>& probabilities,
     }
     Encode(tree.top(), "", codewords);
     Free(tree.top());
+    if (canonical_) {
+      MakeCanonical(codewords);
+    }
   } catch (...) {
     while (!tree.empty()) {
       Free(tree.top());
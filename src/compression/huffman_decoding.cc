@@ -16,71 +16,119 @@
 
 #include "SPTK/compression/huffman_decoding.h"
 
-#include <string>  // std::string
+#include <climits>  // CHAR_BIT, UCHAR_MAX
+#include <string>   // std::string
 
 namespace sptk {
 
 HuffmanDecoding::HuffmanDecoding(std::ifstream* input_stream)
-    : is_valid_(true), root_(NULL), curr_node_(NULL) {
+    : is_valid_(true), root_(0), curr_node_(0) {
   if (NULL == input_stream) {
     is_valid_ = false;
     return;
   }
 
   try {
-    root_ = new Node;
-    root_->left = NULL;
-    root_->right = NULL;
+    const Node empty_node = {{-1, -1}, 0};
+    nodes_.push_back(empty_node);
 
     int symbol;
     std::string bits;
     while (*input_stream >> symbol >> bits) {
-      Node* node(root_);
+      int node(root_);
       for (char& bit : bits) {
-        const bool right('1' == bit ? true : false);
-        Node* next_node(right ? node->right : node->left);
-        if (NULL == next_node) {
-          next_node = new Node;
-          next_node->left = NULL;
-          next_node->right = NULL;
-          if (right) {
-            node->right = next_node;
-          } else {
-            node->left = next_node;
-          }
+        const int right('1' == bit ? 1 : 0);
+        int next_node(nodes_[node].children[right]);
+        if (next_node < 0) {
+          next_node = static_cast<int>(nodes_.size());
+          nodes_.push_back(empty_node);
+          nodes_[node].children[right] = next_node;
         }
         node = next_node;
       }
-      node->symbol = symbol;
+      nodes_[node].symbol = symbol;
     }
+
+    table_indices_.resize(nodes_.size(), -1);
   } catch (...) {
-    Free(root_);
     is_valid_ = false;
     return;
   }
-
-  curr_node_ = root_;
 }
 
 bool HuffmanDecoding::Get(bool input, int* output, bool* is_leaf) {
   // Check inputs.
-  if (!is_valid_ || NULL == output || NULL == is_leaf || NULL == curr_node_) {
+  if (!is_valid_ || NULL == output || NULL == is_leaf || curr_node_ < 0) {
     return false;
   }
 
-  curr_node_ = input ? curr_node_->right : curr_node_->left;
-  if (NULL == curr_node_) {
+  curr_node_ = nodes_[curr_node_].children[input ? 1 : 0];
+  if (curr_node_ < 0) {
     return false;
   }
 
-  *is_leaf =
-      (NULL == curr_node_->left && NULL == curr_node_->right) ? true : false;
+  *is_leaf = IsLeaf(curr_node_);
   if (*is_leaf) {
-    *output = curr_node_->symbol;
+    *output = nodes_[curr_node_].symbol;
     curr_node_ = root_;
   }
 
   return true;
 }
 
+bool HuffmanDecoding::Get(unsigned char input, std::vector<int>* outputs) {
+  // Check inputs.
+  if (!is_valid_ || NULL == outputs || curr_node_ < 0) {
+    return false;
+  }
+
+  int table_index(table_indices_[curr_node_]);
+  if (table_index < 0) {
+    try {
+      table_index = BuildTable(curr_node_);
+    } catch (...) {
+      return false;
+    }
+  }
+
+  const Transition& transition(transitions_[table_index + input]);
+  if (transition.next_node < 0) {
+    curr_node_ = -1;
+    return false;
+  }
+
+  outputs->assign(symbols_.begin() + transition.offset,
+                  symbols_.begin() + transition.offset + transition.num_symbol);
+  curr_node_ = transition.next_node;
+
+  return true;
+}
+
+int HuffmanDecoding::BuildTable(int node) {
+  const int table_size(UCHAR_MAX + 1);
+  const int table_index(static_cast<int>(transitions_.size()));
+  transitions_.resize(table_index + table_size);
+
+  for (int input(0); input < table_size; ++input) {
+    Transition& transition(transitions_[table_index + input]);
+    transition.offset = static_cast<int>(symbols_.size());
+    transition.num_symbol = 0;
+
+    int next_node(node);
+    for (int i(CHAR_BIT - 1); 0 <= i; --i) {
+      next_node = nodes_[next_node].children[(input >> i) & 1];
+      if (next_node < 0) break;
+      if (IsLeaf(next_node)) {
+        symbols_.push_back(nodes_[next_node].symbol);
+        ++transition.num_symbol;
+        next_node = root_;
+      }
+    }
+    transition.next_node = next_node;
+  }
+
+  table_indices_[node] = table_index;
+  return table_index;
+}
+
 }  // namespace sptk
@@ -16,18 +16,73 @@
 
 #include "SPTK/compression/linde_buzo_gray_algorithm.h"
 
-#include <cfloat>   // DBL_MAX
-#include <cmath>    // std::fabs
-#include <cstddef>  // std::size_t
+#include <algorithm>  // std::fill, std::max, std::min
+#include <cfloat>     // DBL_MAX
+#include <cmath>      // std::fabs, std::sqrt
+#include <cstddef>    // std::size_t
 
 #include "SPTK/generation/normal_distributed_random_value_generation.h"
+#include "SPTK/utils/parallel_frame_executor.h"
+
+namespace {
+
+// Relative margin to absorb rounding errors of the bounds.
+const double kMargin(1e-9);
+
+double CalculateSquaredDistance(const std::vector<double>& x,
+                                const std::vector<double>& y) {
+  const int length(static_cast<int>(x.size()));
+  double sum(0.0);
+  for (int m(0); m < length; ++m) {
+    const double diff(x[m] - y[m]);
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+// Find the nearest and the second nearest codebook vectors. The summation is
+// terminated if the partial distance exceeds the second minimum distance.
+void FindNearestCodebookVectors(
+    const std::vector<double>& input_vector,
+    const std::vector<std::vector<double> >& codebook_vectors, int* index,
+    double* min_distance, double* second_min_distance) {
+  const int codebook_size(static_cast<int>(codebook_vectors.size()));
+  const int length(static_cast<int>(input_vector.size()));
+  const double* x(&(input_vector[0]));
+
+  *index = 0;
+  *min_distance = DBL_MAX;
+  *second_min_distance = DBL_MAX;
+  for (int i(0); i < codebook_size; ++i) {
+    const double* c(&(codebook_vectors[i][0]));
+    double distance(0.0);
+    int m(0);
+    for (; m < length; ++m) {
+      const double diff(x[m] - c[m]);
+      distance += diff * diff;
+      if (*second_min_distance <= distance) break;
+    }
+    if (m < length) continue;
+
+    if (distance < *min_distance) {
+      *second_min_distance = *min_distance;
+      *min_distance = distance;
+      *index = i;
+    } else if (distance < *second_min_distance) {
+      *second_min_distance = distance;
+    }
+  }
+}
+
+}  // namespace
 
 namespace sptk {
 
 LindeBuzoGrayAlgorithm::LindeBuzoGrayAlgorithm(
     int num_order, int initial_codebook_size, int target_codebook_size,
     int min_num_vector_in_cluster, int num_iteration,
-    double convergence_threshold, double splitting_factor, int seed)
+    double convergence_threshold, double splitting_factor, int seed,
+    int num_thread)
     : num_order_(num_order),
       initial_codebook_size_(initial_codebook_size),
       target_codebook_size_(target_codebook_size),
@@ -36,17 +91,14 @@ LindeBuzoGrayAlgorithm::LindeBuzoGrayAlgorithm(
       convergence_threshold_(convergence_threshold),
       splitting_factor_(splitting_factor),
       seed_(seed),
-      distance_calculation_(
-          num_order_, DistanceCalculation::DistanceMetrics::kSquaredEuclidean),
+      num_thread_(num_thread),
       statistics_accumulation_(num_order_, 1),
-      vector_quantization_(num_order_),
       is_valid_(true) {
   if (num_order_ < 0 || initial_codebook_size_ <= 0 ||
       target_codebook_size_ <= initial_codebook_size_ ||
       min_num_vector_in_cluster_ <= 0 || num_iteration_ <= 0 ||
       convergence_threshold_ < 0.0 || splitting_factor_ <= 0.0 ||
-      !distance_calculation_.IsValid() || !statistics_accumulation_.IsValid() ||
-      !vector_quantization_.IsValid()) {
+      num_thread_ <= 0 || !statistics_accumulation_.IsValid()) {
     is_valid_ = false;
     return;
   }
@@ -65,12 +117,25 @@ bool LindeBuzoGrayAlgorithm::Run(
           static_cast<std::size_t>(initial_codebook_size_)) {
     return false;
   }
+  for (int t(0); t < num_input_vector; ++t) {
+    if (input_vectors[t].size() != static_cast<std::size_t>(num_order_ + 1)) {
+      return false;
+    }
+  }
+  for (int i(0); i < initial_codebook_size_; ++i) {
+    if ((*codebook_vectors)[i].size() !=
+        static_cast<std::size_t>(num_order_ + 1)) {
+      return false;
+    }
+  }
 
   // Prepare memories.
-  if (codebook_indices->size() != static_cast<std::size_t>(num_input_vector)) {
-    codebook_indices->resize(num_input_vector);
-  }
+  codebook_indices->assign(num_input_vector, 0);
   std::vector<StatisticsAccumulation::Buffer> buffers(target_codebook_size_);
+  std::vector<double> distances(num_input_vector);
+  std::vector<double> lower_bounds(num_input_vector);
+  std::vector<double> half_min_distances;
+  std::vector<std::vector<double> > prev_codebook_vectors;
 
   // Prepare random value generator.
   NormalDistributedRandomValueGeneration random_value_generation(seed_);
@@ -103,6 +168,9 @@ bool LindeBuzoGrayAlgorithm::Run(
 
     current_codebook_size = next_codebook_size;
 
+    // The lower bounds are no longer valid after splitting.
+    std::fill(lower_bounds.begin(), lower_bounds.end(), 0.0);
+
     double prev_total_distance(DBL_MAX);
     for (int n(0); n < num_iteration_; ++n) {
       // Initialize.
@@ -111,26 +179,32 @@ bool LindeBuzoGrayAlgorithm::Run(
         statistics_accumulation_.Clear(&(buffers[i]));
       }
 
-      // Accumulate statistics (E-step).
-      for (int t(0); t < num_input_vector; ++t) {
-        int index;
-        if (!vector_quantization_.Run(input_vectors[t], *codebook_vectors,
-                                      &index)) {
-          return false;
+      // Compute the half of distance to the nearest other codebook vector.
+      half_min_distances.resize(current_codebook_size);
+      std::fill(half_min_distances.begin(), half_min_distances.end(), DBL_MAX);
+      for (int i(0); i < current_codebook_size; ++i) {
+        for (int j(i + 1); j < current_codebook_size; ++j) {
+          const double squared_distance(CalculateSquaredDistance(
+              (*codebook_vectors)[i], (*codebook_vectors)[j]));
+          const double half_distance(0.5 * std::sqrt(squared_distance));
+          half_min_distances[i] =
+              std::min(half_min_distances[i], half_distance);
+          half_min_distances[j] =
+              std::min(half_min_distances[j], half_distance);
         }
-        (*codebook_indices)[t] = index;
+      }
 
-        if (!statistics_accumulation_.Run(input_vectors[t],
-                                          &(buffers[index]))) {
-          return false;
-        }
+      // Find the nearest codebook vectors.
+      AssignInputVectors(input_vectors, *codebook_vectors, half_min_distances,
+                         codebook_indices, &distances, &lower_bounds);
 
-        double distance;
-        if (!distance_calculation_.Run(input_vectors[t],
-                                       (*codebook_vectors)[index], &distance)) {
+      // Accumulate statistics (E-step).
+      for (int t(0); t < num_input_vector; ++t) {
+        if (!statistics_accumulation_.Run(
+                input_vectors[t], &(buffers[(*codebook_indices)[t]]))) {
           return false;
         }
-        total_distance += distance;
+        total_distance += distances[t];
       }
       total_distance /= num_input_vector;
 
@@ -141,6 +215,7 @@ bool LindeBuzoGrayAlgorithm::Run(
         break;
       }
       prev_total_distance = total_distance;
+      prev_codebook_vectors = *codebook_vectors;
 
       // Update codebook (M-step) and find a maximum cluster.
       int majority_index(-1);
@@ -187,18 +262,64 @@ bool LindeBuzoGrayAlgorithm::Run(
           }
         }
       }
+
+      // Loosen the lower bounds by the maximum movement of codebook vectors.
+      double max_movement(0.0);
+      for (int i(0); i < current_codebook_size; ++i) {
+        const double movement(std::sqrt(CalculateSquaredDistance(
+            (*codebook_vectors)[i], prev_codebook_vectors[i])));
+        max_movement = std::max(max_movement, movement);
+      }
+      for (int t(0); t < num_input_vector; ++t) {
+        lower_bounds[t] = std::max(0.0, lower_bounds[t] - max_movement);
+      }
     }
   }
 
   // Save final results.
-  for (int t(0); t < num_input_vector; ++t) {
-    if (!vector_quantization_.Run(input_vectors[t], *codebook_vectors,
-                                  &((*codebook_indices)[t]))) {
-      return false;
-    }
-  }
+  std::fill(lower_bounds.begin(), lower_bounds.end(), 0.0);
+  half_min_distances.assign(codebook_vectors->size(), 0.0);
+  AssignInputVectors(input_vectors, *codebook_vectors, half_min_distances,
+                     codebook_indices, &distances, &lower_bounds);
 
   return true;
 }
 
+void LindeBuzoGrayAlgorithm::AssignInputVectors(
+    const std::vector<std::vector<double> >& input_vectors,
+    const std::vector<std::vector<double> >& codebook_vectors,
+    const std::vector<double>& half_min_distances,
+    std::vector<int>* codebook_indices, std::vector<double>* distances,
+    std::vector<double>* lower_bounds) const {
+  const int num_input_vector(static_cast<int>(input_vectors.size()));
+  const int num_thread(std::min(num_thread_, num_input_vector));
+
+  const auto job([&](int, int begin, int end) {
+    for (int t(begin); t < end; ++t) {
+      // Keep the current assignment if no other codebook vector can be closer
+      // than the assigned one.
+      const int index((*codebook_indices)[t]);
+      const double distance(
+          CalculateSquaredDistance(input_vectors[t], codebook_vectors[index]));
+      const double bound(
+          std::max((*lower_bounds)[t], half_min_distances[index]));
+      if (std::sqrt(distance) * (1.0 + kMargin) < bound) {
+        (*distances)[t] = distance;
+        continue;
+      }
+
+      double second_min_distance;
+      FindNearestCodebookVectors(input_vectors[t], codebook_vectors,
+                                 &((*codebook_indices)[t]), &((*distances)[t]),
+                                 &second_min_distance);
+      (*lower_bounds)[t] = std::sqrt(second_min_distance);
+    }
+    return true;
+  });
+
+  if (0 < num_thread) {
+    ParallelFrameExecutor::RunInChunks(num_input_vector, num_thread, job);
+  }
+}
+
 }  // namespace sptk
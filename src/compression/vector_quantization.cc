@@ -22,11 +22,8 @@
 namespace sptk {
 
 VectorQuantization::VectorQuantization(int num_order)
-    : num_order_(num_order),
-      distance_calculation_(
-          num_order_, DistanceCalculation::DistanceMetrics::kSquaredEuclidean),
-      is_valid_(true) {
-  if (num_order_ < 0 || !distance_calculation_.IsValid()) {
+    : num_order_(num_order), is_valid_(true) {
+  if (num_order_ < 0) {
     is_valid_ = false;
     return;
   }
@@ -47,13 +44,23 @@ bool VectorQuantization::Run(
   int index(0);
   double min_distance(DBL_MAX);
 
+  const std::size_t length(num_order_ + 1);
+  const double* x(&(input_vector[0]));
   for (int i(0); i < codebook_size; ++i) {
-    double distance;
-    if (!distance_calculation_.Run(input_vector, codebook_vectors[i],
-                                   &distance)) {
+    if (codebook_vectors[i].size() != length) {
       return false;
     }
-    if (distance < min_distance) {
+    const double* c(&(codebook_vectors[i][0]));
+
+    // Skip the rest of summation if the partial distance is large enough.
+    double distance(0.0);
+    int m(0);
+    for (; m <= num_order_; ++m) {
+      const double diff(x[m] - c[m]);
+      distance += diff * diff;
+      if (min_distance <= distance) break;
+    }
+    if (num_order_ < m) {
       index = i;
       min_distance = distance;
     }
@@ -49,11 +49,39 @@ bool LinearPredictiveCoefficientsToCepstrum::Run(
     cepstrum->resize(output_length);
   }
 
-  const double* input(&(linear_predictive_coefficients[0]));
-  double* output(&((*cepstrum)[0]));
+  Convert(&(linear_predictive_coefficients[0]), &((*cepstrum)[0]));
 
+  return true;
+}
+
+bool LinearPredictiveCoefficientsToCepstrum::RunBatch(
+    const Matrix& linear_predictive_coefficients, Matrix* cepstrum) const {
+  // Check inputs.
+  if (!is_valid_ ||
+      linear_predictive_coefficients.GetNumColumn() != num_input_order_ + 1 ||
+      NULL == cepstrum || &linear_predictive_coefficients == cepstrum) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_frame(linear_predictive_coefficients.GetNumRow());
+  const int output_length(num_output_order_ + 1);
+  if (cepstrum->GetNumRow() != num_frame ||
+      cepstrum->GetNumColumn() != output_length) {
+    cepstrum->Resize(num_frame, output_length);
+  }
+
+  for (int t(0); t < num_frame; ++t) {
+    Convert(linear_predictive_coefficients[t], (*cepstrum)[t]);
+  }
+
+  return true;
+}
+
+void LinearPredictiveCoefficientsToCepstrum::Convert(const double* input,
+                                                     double* output) const {
   output[0] = std::log(input[0]);
-  if (0 == num_output_order_) return true;
+  if (0 == num_output_order_) return;
 
   output[1] = -input[1];
 
@@ -69,8 +97,6 @@ bool LinearPredictiveCoefficientsToCepstrum::Run(
       output[m] -= input[m];
     }
   }
-
-  return true;
 }
 
 }  // namespace sptk
@@ -16,8 +16,9 @@
 
 #include "SPTK/conversion/linear_predictive_coefficients_to_line_spectral_pairs.h"
 
-#include <cmath>    // std::acos, std::ceil, std::fabs, std::floor
-#include <cstddef>  // std::size_t
+#include <algorithm>  // std::copy, std::max, std::min
+#include <cmath>      // std::acos, std::ceil, std::fabs, std::floor, std::isnan
+#include <cstddef>    // std::size_t
 
 namespace {
 
@@ -34,6 +35,72 @@ double CalculateChebyshevPolynomial(const std::vector<double>& coefficients,
   return x * b1 - b2 + c[0];
 }
 
+void CalculateChebyshevPolynomialAndDerivative(
+    const std::vector<double>& coefficients, double x, double* y, double* dy) {
+  const double* c(&coefficients[0]);
+  double b2(0.0);
+  double b1(0.0);
+  double d2(0.0);
+  double d1(0.0);
+  for (int i(static_cast<int>(coefficients.size()) - 1); 0 < i; --i) {
+    const double b0(2.0 * x * b1 - b2 + c[i]);
+    const double d0(2.0 * (b1 + x * d1) - d2);
+    b2 = b1;
+    b1 = b0;
+    d2 = d1;
+    d1 = d0;
+  }
+  *y = x * b1 - b2 + c[0];
+  *dy = b1 + x * d1 - d2;
+}
+
+// Find the largest root below x_start by scanning the grid and refining the
+// first sign change by bisection.
+bool SearchRootOnGrid(const std::vector<double>& coefficients, double x_start,
+                      int num_split, int num_iteration,
+                      double convergence_threshold, double* root) {
+  const double delta(1.0 / num_split);
+  const double x_min(-1.0 - delta);
+  double x_prev(x_start);
+  double y_prev(CalculateChebyshevPolynomial(coefficients, x_prev));
+  for (double x(x_start - delta); x_min < x; x -= delta) {
+    const double y(CalculateChebyshevPolynomial(coefficients, x));
+    if (y * y_prev <= 0.0) {
+      double x_lower(x);
+      double x_upper(x_prev);
+      double y_lower(y);
+      double y_upper(y_prev);
+
+      for (int n(0); n < num_iteration; ++n) {
+        const double x_mid((x_lower + x_upper) * 0.5);
+        const double y_mid(CalculateChebyshevPolynomial(coefficients, x_mid));
+
+        if (y_mid * y_upper <= 0.0) {
+          x_lower = x_mid;
+          y_lower = y_mid;
+        } else {
+          x_upper = x_mid;
+          y_upper = y_mid;
+        }
+
+        if (std::fabs(y_mid) <= convergence_threshold) {
+          break;
+        }
+      }
+
+      *root = (y_lower == y_upper) ? x_lower
+                                   : (y_lower * x_upper - y_upper * x_lower) /
+                                         (y_lower - y_upper);
+      return true;
+    }
+
+    x_prev = x;
+    y_prev = y;
+  }
+
+  return false;
+}
+
 }  // namespace
 
 namespace sptk {
@@ -41,7 +108,7 @@ namespace sptk {
 LinearPredictiveCoefficientsToLineSpectralPairs::
     LinearPredictiveCoefficientsToLineSpectralPairs(
         int num_order, int num_split, int num_iteration,
-        double convergence_threshold)
+        double convergence_threshold, Algorithms algorithm)
     : num_order_(num_order),
       num_symmetric_polynomial_order_(
           static_cast<int>(std::ceil(num_order_ * 0.5))),
@@ -50,9 +117,11 @@ LinearPredictiveCoefficientsToLineSpectralPairs::
       num_split_(num_split),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
+      algorithm_(algorithm),
       is_valid_(true) {
   if (num_order_ < 0 || num_split_ <= 0 || num_iteration_ <= 0 ||
-      convergence_threshold_ < 0.0) {
+      convergence_threshold_ < 0.0 || algorithm_ < 0 ||
+      kNumAlgorithms <= algorithm_) {
     is_valid_ = false;
     return;
   }
@@ -115,13 +184,63 @@ bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
     c2[0] *= 0.5;
   }
 
+  // Search roots of polynomials.
+  double* w(&((*line_spectral_pairs)[0]));
+  return (kGridSearch == algorithm_) ? RunGridSearch(buffer, w)
+                                     : RunNewtonMethod(buffer, w);
+}
+
+bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
+    std::vector<double>* input_and_output,
+    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const {
+  if (NULL == input_and_output) return false;
+  return Run(*input_and_output, input_and_output, buffer);
+}
+
+bool LinearPredictiveCoefficientsToLineSpectralPairs::RunBatch(
+    const Matrix& linear_predictive_coefficients, Matrix* line_spectral_pairs,
+    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const {
+  // Check inputs.
+  const int length(num_order_ + 1);
+  if (!is_valid_ || linear_predictive_coefficients.GetNumColumn() != length ||
+      NULL == line_spectral_pairs || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_frame(linear_predictive_coefficients.GetNumRow());
+  if (line_spectral_pairs->GetNumRow() != num_frame ||
+      line_spectral_pairs->GetNumColumn() != length) {
+    line_spectral_pairs->Resize(num_frame, length);
+  }
+  if (buffer->frame_.size() != static_cast<std::size_t>(length)) {
+    buffer->frame_.resize(length);
+  }
+
+  // The root search works on vectors, so each frame is passed through the
+  // buffer. This also allows in-place conversion.
+  for (int t(0); t < num_frame; ++t) {
+    std::copy(linear_predictive_coefficients[t],
+              linear_predictive_coefficients[t] + length,
+              buffer->frame_.begin());
+    if (!Run(&buffer->frame_, buffer)) {
+      return false;
+    }
+    std::copy(buffer->frame_.begin(), buffer->frame_.end(),
+              (*line_spectral_pairs)[t]);
+  }
+
+  return true;
+}
+
+bool LinearPredictiveCoefficientsToLineSpectralPairs::RunGridSearch(
+    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer,
+    double* w) const {
   std::vector<double>* c(&buffer->c1_);
   int order(0);
   double x_prev(1.0);
   double y_prev(CalculateChebyshevPolynomial(*c, x_prev));
-  double* w(&((*line_spectral_pairs)[0]));
 
-  // Search roots of polynomials.
   const double delta(1.0 / num_split_);
   const double x_max(1.0 - delta);
   const double x_min(-1.0 - delta);
@@ -169,11 +288,80 @@ bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
   return false;
 }
 
-bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
-    std::vector<double>* input_and_output,
-    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const {
-  if (NULL == input_and_output) return false;
-  return Run(*input_and_output, input_and_output, buffer);
+bool LinearPredictiveCoefficientsToLineSpectralPairs::RunNewtonMethod(
+    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer,
+    double* w) const {
+  // Prepare memories.
+  if (buffer->x1_.size() !=
+      static_cast<std::size_t>(num_symmetric_polynomial_order_)) {
+    buffer->x1_.resize(num_symmetric_polynomial_order_);
+  }
+  if (buffer->x2_.size() !=
+      static_cast<std::size_t>(num_asymmetric_polynomial_order_)) {
+    buffer->x2_.resize(num_asymmetric_polynomial_order_);
+  }
+
+  // The roots of the two polynomials appear alternately from x = 1, so the
+  // last root of one polynomial lies between the last and the next roots of
+  // the other one. Starting from there, the Newton method applied to the
+  // deflated polynomial monotonically converges to the next root. The step
+  // is doubled until the root is passed, which cannot go beyond the next but
+  // one root because all the roots are real.
+  double x_start(1.0);
+  for (int order(1); order <= num_order_; ++order) {
+    const bool is_symmetric(1 == order % 2);
+    const std::vector<double>& c(is_symmetric ? buffer->c1_ : buffer->c2_);
+    double* roots(is_symmetric ? &(buffer->x1_[0]) : &(buffer->x2_[0]));
+    const int num_root((order - 1) / 2);
+
+    double x(x_start);
+    double y_start(0.0);
+    bool is_double_step(true);
+    bool is_converged(false);
+    for (int n(0); n < num_iteration_; ++n) {
+      double y;
+      double dy;
+      CalculateChebyshevPolynomialAndDerivative(c, x, &y, &dy);
+      if (0 == n) {
+        y_start = y;
+      } else if (y * y_start < 0.0) {
+        is_double_step = false;
+      }
+
+      // Implicitly deflate the already found roots.
+      double sum(0.0);
+      for (int i(0); i < num_root; ++i) {
+        sum += 1.0 / (x - roots[i]);
+      }
+      const double denominator(dy - y * sum);
+      if (0.0 == denominator) {
+        break;
+      }
+
+      x -= (is_double_step ? 2.0 : 1.0) * y / denominator;
+      if (std::fabs(y) <= convergence_threshold_) {
+        is_converged = true;
+        break;
+      }
+    }
+
+    // Fall back to the grid search if the root is not found.
+    if (!is_converged || std::isnan(x)) {
+      if (!SearchRootOnGrid(c, x_start, num_split_, num_iteration_,
+                            convergence_threshold_, &x)) {
+        return false;
+      }
+    }
+
+    // Avoid the round-off error.
+    x = std::max(-1.0, std::min(x, x_start));
+
+    roots[num_root] = x;
+    w[order] = std::acos(x) / sptk::kTwoPi;
+    x_start = x;
+  }
+
+  return true;
 }
 
 }  // namespace sptk
@@ -65,4 +65,32 @@ bool LogAreaRatioToParcorCoefficients::Run(
   return Run(*input_and_output, input_and_output);
 }
 
+bool LogAreaRatioToParcorCoefficients::RunBatch(
+    const Matrix& log_area_ratio, Matrix* parcor_coefficients) const {
+  // Check inputs.
+  const int length(num_order_ + 1);
+  if (!is_valid_ || log_area_ratio.GetNumColumn() != length ||
+      NULL == parcor_coefficients) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_frame(log_area_ratio.GetNumRow());
+  if (parcor_coefficients->GetNumRow() != num_frame ||
+      parcor_coefficients->GetNumColumn() != length) {
+    parcor_coefficients->Resize(num_frame, length);
+  }
+
+  for (int t(0); t < num_frame; ++t) {
+    const double* g(log_area_ratio[t]);
+    double* k((*parcor_coefficients)[t]);
+    k[0] = g[0];
+    for (int m(1); m < length; ++m) {
+      k[m] = std::tanh(0.5 * g[m]);
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
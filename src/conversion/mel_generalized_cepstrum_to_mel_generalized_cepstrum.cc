@@ -435,4 +435,37 @@ bool MelGeneralizedCepstrumToMelGeneralizedCepstrum::Run(
   return true;
 }
 
+bool MelGeneralizedCepstrumToMelGeneralizedCepstrum::RunBatch(
+    const Matrix& input, Matrix* output,
+    MelGeneralizedCepstrumToMelGeneralizedCepstrum::Buffer* buffer) const {
+  // Check inputs.
+  const int input_length(num_input_order_ + 1);
+  if (!is_valid_ || input.GetNumColumn() != input_length || NULL == output ||
+      &input == output || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_frame(input.GetNumRow());
+  const int output_length(num_output_order_ + 1);
+  if (output->GetNumRow() != num_frame ||
+      output->GetNumColumn() != output_length) {
+    output->Resize(num_frame, output_length);
+  }
+  if (buffer->input_.size() != static_cast<std::size_t>(input_length)) {
+    buffer->input_.resize(input_length);
+  }
+
+  // The modules work on vectors, so each frame is passed through the buffer.
+  for (int t(0); t < num_frame; ++t) {
+    std::copy(input[t], input[t] + input_length, buffer->input_.begin());
+    if (!Run(buffer->input_, &buffer->output_, buffer)) {
+      return false;
+    }
+    std::copy(buffer->output_.begin(), buffer->output_.end(), (*output)[t]);
+  }
+
+  return true;
+}
+
 }  // namespace sptk
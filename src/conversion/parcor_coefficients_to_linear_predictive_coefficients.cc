@@ -57,14 +57,59 @@ bool ParcorCoefficientsToLinearPredictiveCoefficients::Run(
     return true;
   }
 
+  Convert(&(parcor_coefficients[0]), &((*linear_predictive_coefficients)[0]),
+          &buffer->a_[0]);
+
+  return true;
+}
+
+bool ParcorCoefficientsToLinearPredictiveCoefficients::Run(
+    std::vector<double>* input_and_output,
+    ParcorCoefficientsToLinearPredictiveCoefficients::Buffer* buffer) const {
+  if (NULL == input_and_output) return false;
+  return Run(*input_and_output, input_and_output, buffer);
+}
+
+bool ParcorCoefficientsToLinearPredictiveCoefficients::RunBatch(
+    const Matrix& parcor_coefficients, Matrix* linear_predictive_coefficients,
+    ParcorCoefficientsToLinearPredictiveCoefficients::Buffer* buffer) const {
+  // Check inputs.
+  const int length(num_order_ + 1);
+  if (!is_valid_ || parcor_coefficients.GetNumColumn() != length ||
+      NULL == linear_predictive_coefficients ||
+      &parcor_coefficients == linear_predictive_coefficients ||
+      NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_frame(parcor_coefficients.GetNumRow());
+  if (linear_predictive_coefficients->GetNumRow() != num_frame ||
+      linear_predictive_coefficients->GetNumColumn() != length) {
+    linear_predictive_coefficients->Resize(num_frame, length);
+  }
+  if (buffer->a_.size() != static_cast<std::size_t>(num_order_)) {
+    buffer->a_.resize(num_order_);
+  }
+
+  for (int t(0); t < num_frame; ++t) {
+    const double* k(parcor_coefficients[t]);
+    double* a((*linear_predictive_coefficients)[t]);
+    a[0] = k[0];
+    if (0 < num_order_) {
+      Convert(k, a, &buffer->a_[0]);
+    }
+  }
+
+  return true;
+}
+
+void ParcorCoefficientsToLinearPredictiveCoefficients::Convert(
+    const double* k, double* a, double* prev_a) const {
   // Set initial condition.
-  std::copy(parcor_coefficients.begin(), parcor_coefficients.end() - 1,
-            buffer->a_.begin());
+  std::copy(k, k + num_order_, prev_a);
 
   // Apply recursive formula.
-  const double* k(&(parcor_coefficients[0]));
-  double* prev_a(&buffer->a_[0]);
-  double* a(&((*linear_predictive_coefficients)[0]));
   for (int i(2); i <= num_order_; ++i) {
     for (int m(1); m < i; ++m) {
       a[m] = prev_a[m] + k[i] * prev_a[i - m];
@@ -74,15 +119,6 @@ bool ParcorCoefficientsToLinearPredictiveCoefficients::Run(
     }
   }
   a[num_order_] = k[num_order_];
-
-  return true;
-}
-
-bool ParcorCoefficientsToLinearPredictiveCoefficients::Run(
-    std::vector<double>* input_and_output,
-    ParcorCoefficientsToLinearPredictiveCoefficients::Buffer* buffer) const {
-  if (NULL == input_and_output) return false;
-  return Run(*input_and_output, input_and_output, buffer);
 }
 
 }  // namespace sptk
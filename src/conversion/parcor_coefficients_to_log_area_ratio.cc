@@ -66,4 +66,32 @@ bool ParcorCoefficientsToLogAreaRatio::Run(
   return Run(*input_and_output, input_and_output);
 }
 
+bool ParcorCoefficientsToLogAreaRatio::RunBatch(
+    const Matrix& parcor_coefficients, Matrix* log_area_ratio) const {
+  // Check inputs.
+  const int length(num_order_ + 1);
+  if (!is_valid_ || parcor_coefficients.GetNumColumn() != length ||
+      NULL == log_area_ratio) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_frame(parcor_coefficients.GetNumRow());
+  if (log_area_ratio->GetNumRow() != num_frame ||
+      log_area_ratio->GetNumColumn() != length) {
+    log_area_ratio->Resize(num_frame, length);
+  }
+
+  for (int t(0); t < num_frame; ++t) {
+    const double* k(parcor_coefficients[t]);
+    double* g((*log_area_ratio)[t]);
+    g[0] = k[0];
+    for (int m(1); m < length; ++m) {
+      g[m] = 2.0 * std::atanh(k[m]);
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -0,0 +1,99 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/conversion/waveform_to_mel_generalized_cepstrum.h"
+
+#include <cstddef>  // std::size_t
+
+namespace sptk {
+
+WaveformToMelGeneralizedCepstrum::WaveformToMelGeneralizedCepstrum(
+    WindowInterface* window,
+    DataWindowing::NormalizationType normalization_type, int fft_length,
+    int num_order, double alpha, double gamma, int num_iteration,
+    double convergence_threshold, double epsilon,
+    double relative_floor_in_decibels, OutputFormats output_format)
+    : output_format_(output_format),
+      data_windowing_(window, fft_length, normalization_type),
+      waveform_to_spectrum_(fft_length, fft_length,
+                            SpectrumToSpectrum::kPowerSpectrum, epsilon,
+                            relative_floor_in_decibels),
+      mel_generalized_cepstral_analysis_(fft_length, num_order, alpha, gamma,
+                                         num_iteration, convergence_threshold),
+      mel_cepstrum_to_mlsa_digital_filter_coefficients_(num_order, alpha),
+      generalized_cepstrum_gain_normalization_(num_order, gamma),
+      is_valid_(true) {
+  if (output_format_ < 0 || kNumOutputFormats <= output_format_ ||
+      !data_windowing_.IsValid() || !waveform_to_spectrum_.IsValid() ||
+      !mel_generalized_cepstral_analysis_.IsValid() ||
+      !mel_cepstrum_to_mlsa_digital_filter_coefficients_.IsValid() ||
+      !generalized_cepstrum_gain_normalization_.IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool WaveformToMelGeneralizedCepstrum::Run(
+    const std::vector<double>& waveform,
+    std::vector<double>* mel_generalized_cepstrum,
+    WaveformToMelGeneralizedCepstrum::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ ||
+      waveform.size() != static_cast<std::size_t>(GetFrameLength()) ||
+      NULL == mel_generalized_cepstrum || NULL == buffer) {
+    return false;
+  }
+
+  // Apply window.
+  if (!data_windowing_.Run(waveform, &buffer->windowed_waveform_)) {
+    return false;
+  }
+
+  // Calculate power spectrum.
+  if (!waveform_to_spectrum_.Run(buffer->windowed_waveform_,
+                                 &buffer->power_spectrum_,
+                                 &buffer->buffer_for_spectral_analysis_)) {
+    return false;
+  }
+
+  // Estimate mel-generalized cepstrum.
+  if (!mel_generalized_cepstral_analysis_.Run(
+          buffer->power_spectrum_, mel_generalized_cepstrum,
+          &buffer->buffer_for_cepstral_analysis_)) {
+    return false;
+  }
+
+  // Format output.
+  if (0.0 != mel_generalized_cepstral_analysis_.GetAlpha() &&
+      (kMlsaFilterCoefficients == output_format_ ||
+       kGainNormalizedMlsaFilterCoefficients == output_format_)) {
+    if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_.Run(
+            mel_generalized_cepstrum)) {
+      return false;
+    }
+  }
+  if (kGainNormalizedCepstrum == output_format_ ||
+      kGainNormalizedMlsaFilterCoefficients == output_format_) {
+    if (!generalized_cepstrum_gain_normalization_.Run(
+            mel_generalized_cepstrum)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace sptk
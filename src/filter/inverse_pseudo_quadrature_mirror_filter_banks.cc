@@ -16,7 +16,9 @@
 
 #include "SPTK/filter/inverse_pseudo_quadrature_mirror_filter_banks.h"
 
-#include <cstddef>  // std::size_t
+#include <algorithm>  // std::copy, std::fill, std::max, std::min
+#include <cmath>      // std::cos, std::sin, std::sqrt
+#include <cstddef>    // std::size_t
 
 #include "SPTK/utils/misc_utils.h"
 
@@ -31,8 +33,9 @@ InversePseudoQuadratureMirrorFilterBanks::
                                              double initial_step_size)
     : num_subband_(num_subband),
       all_zero_filter_(num_filter_order, false),
+      fourier_transform_(2 * num_subband),
       is_valid_(true) {
-  if (!all_zero_filter_.IsValid()) {
+  if (!all_zero_filter_.IsValid() || !fourier_transform_.IsValid()) {
     is_valid_ = false;
     return;
   }
@@ -40,10 +43,30 @@ InversePseudoQuadratureMirrorFilterBanks::
   if (!MakePseudoQuadratureMirrorFilterBanks(
           true, num_subband_, num_filter_order, attenuation, num_iteration,
           convergence_threshold, initial_step_size, &filter_banks_,
-          &is_converged_)) {
+          &is_converged_, &prototype_filter_)) {
     is_valid_ = false;
     return;
   }
+
+  // Prepare inverse cosine modulation including the gain of interpolation.
+  const int fft_length(2 * num_subband_);
+  const double half_order(0.5 * num_filter_order);
+  pre_twiddle_real_.resize(num_subband_);
+  pre_twiddle_imag_.resize(num_subband_);
+  for (int k(0); k < num_subband_; ++k) {
+    const double a(sptk::kPi * k * num_filter_order / fft_length);
+    const double sign(IsEven(k) ? -1.0 : 1.0);
+    pre_twiddle_real_[k] = std::cos(a) + sign * std::sin(a);
+    pre_twiddle_imag_[k] = std::sin(a) - sign * std::cos(a);
+  }
+  post_twiddle_real_.resize(fft_length);
+  post_twiddle_imag_.resize(fft_length);
+  const double gain(std::sqrt(2.0) * num_subband_);
+  for (int r(0); r < fft_length; ++r) {
+    const double a(sptk::kPi * (r - half_order) / fft_length);
+    post_twiddle_real_[r] = gain * std::cos(a);
+    post_twiddle_imag_[r] = gain * std::sin(a);
+  }
 }
 
 bool InversePseudoQuadratureMirrorFilterBanks::Run(
@@ -86,4 +109,75 @@ bool InversePseudoQuadratureMirrorFilterBanks::Run(
   return true;
 }
 
+bool InversePseudoQuadratureMirrorFilterBanks::Run(
+    const std::vector<double>& input, std::vector<double>* output,
+    InversePseudoQuadratureMirrorFilterBanks::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || input.size() != static_cast<std::size_t>(num_subband_) ||
+      NULL == output || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int filter_size(GetNumFilterOrder() + 1);
+  const int fft_length(2 * num_subband_);
+  const int buffer_size(std::max(filter_size, num_subband_));
+  if (output->size() != static_cast<std::size_t>(num_subband_)) {
+    output->resize(num_subband_);
+  }
+  if (buffer->signals_.size() != static_cast<std::size_t>(buffer_size)) {
+    buffer->signals_.resize(buffer_size);
+    std::fill(buffer->signals_.begin(), buffer->signals_.end(), 0.0);
+  }
+  if (buffer->real_part_.size() != static_cast<std::size_t>(fft_length)) {
+    buffer->real_part_.resize(fft_length);
+  }
+  if (buffer->imag_part_.size() != static_cast<std::size_t>(fft_length)) {
+    buffer->imag_part_.resize(fft_length);
+  }
+
+  // Apply inverse cosine modulation.
+  double* m(&buffer->real_part_[0]);
+  double* v(&buffer->imag_part_[0]);
+  for (int k(0); k < num_subband_; ++k) {
+    m[k] = input[k] * pre_twiddle_real_[k];
+    v[k] = input[k] * pre_twiddle_imag_[k];
+  }
+  std::fill(buffer->real_part_.begin() + num_subband_,
+            buffer->real_part_.end(), 0.0);
+  std::fill(buffer->imag_part_.begin() + num_subband_,
+            buffer->imag_part_.end(), 0.0);
+  if (!fourier_transform_.Run(&buffer->real_part_, &buffer->imag_part_,
+                              &buffer->buffer_for_fourier_transform_)) {
+    return false;
+  }
+  for (int r(0); r < fft_length; ++r) {
+    m[r] = post_twiddle_real_[r] * m[r] + post_twiddle_imag_[r] * v[r];
+  }
+
+  // Overlap-add filtered signal.
+  double* y(&buffer->signals_[0]);
+  {
+    const double* h(&prototype_filter_[0]);
+    double sign(1.0);
+    for (int l(0); l < filter_size; l += fft_length) {
+      const int end(std::min(l + fft_length, filter_size));
+      for (int n(l); n < end; ++n) {
+        y[n] += sign * h[n] * m[n - l];
+      }
+      sign = -sign;
+    }
+  }
+
+  // Output completed samples and shift buffer.
+  std::copy(buffer->signals_.begin(), buffer->signals_.begin() + num_subband_,
+            output->begin());
+  std::copy(buffer->signals_.begin() + num_subband_, buffer->signals_.end(),
+            buffer->signals_.begin());
+  std::fill(buffer->signals_.end() - num_subband_, buffer->signals_.end(),
+            0.0);
+
+  return true;
+}
+
 }  // namespace sptk
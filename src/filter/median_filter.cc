@@ -16,8 +16,7 @@
 
 #include "SPTK/filter/median_filter.h"
 
-#include <algorithm>  // std::sort
-#include <cstddef>    // std::size_t
+#include <cstddef>  // std::size_t
 
 namespace sptk {
 
@@ -31,7 +30,9 @@ MedianFilter::MedianFilter(int num_input_order, int num_filter_order,
       apply_each_dimension_(apply_each_dimension),
       use_magic_number_(use_magic_number),
       magic_number_(magic_number),
-      is_valid_(true) {
+      is_valid_(true),
+      queue_begin_(0),
+      queue_size_(0) {
   if (num_input_order_ < 0 || num_filter_order_ < 0 || NULL == input_source_ ||
       !input_source->IsValid() ||
       input_source->GetSize() != num_input_order_ + 1) {
@@ -41,9 +42,19 @@ MedianFilter::MedianFilter(int num_input_order, int num_filter_order,
 
   // Prepare memories.
   buffer_.resize(num_input_order_ + 1);
-  flat_.resize(apply_each_dimension_
-                   ? (num_filter_order_ + 1)
-                   : (num_filter_order_ + 1) * buffer_.size());
+  queue_.resize(num_filter_order_ + 1);
+  for (std::vector<std::vector<double> >::iterator itr(queue_.begin());
+       itr != queue_.end(); ++itr) {
+    itr->resize(num_input_order_ + 1);
+  }
+  const int output_size(GetSize());
+  num_magic_numbers_.resize(output_size, 0);
+  buffer_for_median_accumulation_.resize(output_size);
+  for (std::vector<MedianAccumulation::Buffer*>::iterator itr(
+           buffer_for_median_accumulation_.begin());
+       itr != buffer_for_median_accumulation_.end(); ++itr) {
+    *itr = new MedianAccumulation::Buffer();
+  }
 
   // Look ahead.
   const int future(num_filter_order_ / 2);
@@ -71,36 +82,28 @@ bool MedianFilter::Get(std::vector<double>* output) {
   }
 
   for (int m(0); m < output_size; ++m) {
-    int num_magic_numbers(0);
-    int num_valid_numbers(0);
-    for (const std::vector<double>& input_vector : queue_) {
-      for (int n(apply_each_dimension_ ? m : 0);
-           n <= (apply_each_dimension_ ? m : num_input_order_); ++n) {
-        if (use_magic_number_ && magic_number_ == input_vector[n]) {
-          ++num_magic_numbers;
-        } else {
-          flat_[num_valid_numbers++] = input_vector[n];
-        }
-      }
+    int num_valid_numbers;
+    if (!median_accumulation_.GetNumData(
+            *(buffer_for_median_accumulation_[m]), &num_valid_numbers)) {
+      return false;
     }
 
-    if (num_valid_numbers < num_magic_numbers) {
+    if (num_valid_numbers < num_magic_numbers_[m]) {
       (*output)[m] = magic_number_;
       continue;
     }
 
-    std::sort(flat_.begin(), flat_.begin() + num_valid_numbers);
-    const int half_size(num_valid_numbers / 2);
-    if (IsEven(num_valid_numbers)) {
-      (*output)[m] = 0.5 * (flat_[half_size - 1] + flat_[half_size]);
-    } else {
-      (*output)[m] = flat_[half_size];
+    if (!median_accumulation_.GetMedian(*(buffer_for_median_accumulation_[m]),
+                                        &((*output)[m]))) {
+      return false;
     }
   }
 
   if (count_down_ < num_filter_order_ / 2 ||
-      num_filter_order_ + 1 <= static_cast<int>(queue_.size())) {
-    queue_.pop_front();
+      num_filter_order_ + 1 <= queue_size_) {
+    if (!Pop()) {
+      return false;
+    }
   }
 
   return true;
@@ -108,7 +111,9 @@ bool MedianFilter::Get(std::vector<double>* output) {
 
 bool MedianFilter::Forward() {
   if (input_source_->Get(&buffer_)) {
-    queue_.push_back(buffer_);
+    if (!Push(buffer_)) {
+      return false;
+    }
   } else if (1 <= count_down_) {
     --count_down_;
   } else {
@@ -117,4 +122,40 @@ bool MedianFilter::Forward() {
   return true;
 }
 
+bool MedianFilter::Push(const std::vector<double>& input_vector) {
+  const int queue_end((queue_begin_ + queue_size_) % (num_filter_order_ + 1));
+  queue_[queue_end] = input_vector;
+  ++queue_size_;
+
+  for (int n(0); n <= num_input_order_; ++n) {
+    const int m(apply_each_dimension_ ? n : 0);
+    if (use_magic_number_ && magic_number_ == input_vector[n]) {
+      ++num_magic_numbers_[m];
+    } else if (!median_accumulation_.Run(input_vector[n],
+                                         buffer_for_median_accumulation_[m])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool MedianFilter::Pop() {
+  const std::vector<double>& input_vector(queue_[queue_begin_]);
+  for (int n(0); n <= num_input_order_; ++n) {
+    const int m(apply_each_dimension_ ? n : 0);
+    if (use_magic_number_ && magic_number_ == input_vector[n]) {
+      --num_magic_numbers_[m];
+    } else if (!median_accumulation_.Remove(
+                   input_vector[n], buffer_for_median_accumulation_[m])) {
+      return false;
+    }
+  }
+
+  queue_begin_ = (queue_begin_ + 1) % (num_filter_order_ + 1);
+  --queue_size_;
+
+  return true;
+}
+
 }  // namespace sptk
@@ -16,7 +16,7 @@
 
 #include "SPTK/filter/mlsa_digital_filter.h"
 
-#include <algorithm>  // std::fill
+#include <algorithm>  // std::copy, std::fill
 #include <cmath>      // std::exp
 #include <cstddef>    // std::size_t
 
@@ -90,6 +90,86 @@ bool MlsaDigitalFilter::Run(const std::vector<double>& filter_coefficients,
   }
 
   // Prepare memories.
+  PrepareBuffer(buffer);
+
+  const double gained_input(filter_input * std::exp(filter_coefficients[0]));
+  if (0 == num_filter_order_) {
+    *filter_output = gained_input;
+    return true;
+  }
+
+  *filter_output = Filter(&(filter_coefficients[0]), gained_input, buffer);
+
+  return true;
+}
+
+bool MlsaDigitalFilter::Run(
+    const std::vector<double>& filter_coefficients,
+    const std::vector<double>& next_filter_coefficients, int frame_period,
+    int interpolation_period, const std::vector<double>& filter_input,
+    std::vector<double>* filter_output,
+    MlsaDigitalFilter::Buffer* buffer) const {
+  // Check inputs.
+  const int length(static_cast<int>(filter_input.size()));
+  if (!is_valid_ ||
+      filter_coefficients.size() !=
+          static_cast<std::size_t>(num_filter_order_ + 1) ||
+      next_filter_coefficients.size() !=
+          static_cast<std::size_t>(num_filter_order_ + 1) ||
+      frame_period <= 0 || interpolation_period < 0 ||
+      frame_period / 2 < interpolation_period || frame_period < length ||
+      NULL == filter_output || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  PrepareBuffer(buffer);
+  if (filter_output->size() != static_cast<std::size_t>(length)) {
+    filter_output->resize(length);
+  }
+  buffer->coefficients_ = filter_coefficients;
+  if (0 < interpolation_period) {
+    buffer->increments_.resize(num_filter_order_ + 1);
+    const double rate(static_cast<double>(interpolation_period) /
+                      frame_period);
+    for (int m(0); m <= num_filter_order_; ++m) {
+      buffer->increments_[m] =
+          rate * (next_filter_coefficients[m] - filter_coefficients[m]);
+    }
+  }
+
+  const double* input(length ? &(filter_input[0]) : NULL);
+  double* output(length ? &((*filter_output)[0]) : NULL);
+  double* b(&(buffer->coefficients_[0]));
+  double gain(std::exp(b[0]));
+  const int first_interpolation_period(interpolation_period / 2);
+
+  for (int t(0); t < length; ++t) {
+    // Update filter coefficients in the same way as InputSourceInterpolation.
+    if (0 < t) {
+      if (0 < interpolation_period &&
+          0 == (t + first_interpolation_period) % interpolation_period) {
+        const double* increments(&(buffer->increments_[0]));
+        for (int m(0); m <= num_filter_order_; ++m) {
+          b[m] += increments[m];
+        }
+        gain = std::exp(b[0]);
+      } else if (0 == interpolation_period && frame_period / 2 == t) {
+        std::copy(next_filter_coefficients.begin(),
+                  next_filter_coefficients.end(), b);
+        gain = std::exp(b[0]);
+      }
+    }
+
+    const double gained_input(input[t] * gain);
+    output[t] = (0 == num_filter_order_) ? gained_input
+                                         : Filter(b, gained_input, buffer);
+  }
+
+  return true;
+}
+
+void MlsaDigitalFilter::PrepareBuffer(MlsaDigitalFilter::Buffer* buffer) const {
   if (buffer->signals_for_basic_filter1_.size() !=
       static_cast<std::size_t>(num_pade_order_ + 1)) {
     buffer->signals_for_basic_filter1_.resize(num_pade_order_ + 1);
@@ -115,14 +195,10 @@ bool MlsaDigitalFilter::Run(const std::vector<double>& filter_coefficients,
     std::fill(buffer->signals_for_exp_filter2_.begin(),
               buffer->signals_for_exp_filter2_.end(), 0.0);
   }
+}
 
-  const double gained_input(filter_input * std::exp(filter_coefficients[0]));
-  if (0 == num_filter_order_) {
-    *filter_output = gained_input;
-    return true;
-  }
-
-  const double* b(&(filter_coefficients[0]));
+double MlsaDigitalFilter::Filter(const double* b, double gained_input,
+                                 MlsaDigitalFilter::Buffer* buffer) const {
   const double beta(1.0 - alpha_ * alpha_);
 
   // First stage:
@@ -185,9 +261,7 @@ bool MlsaDigitalFilter::Run(const std::vector<double>& filter_coefficients,
     second_output += x;
   }
 
-  *filter_output = second_output;
-
-  return true;
+  return second_output;
 }
 
 bool MlsaDigitalFilter::Run(const std::vector<double>& filter_coefficients,
@@ -16,7 +16,9 @@
 
 #include "SPTK/filter/pseudo_quadrature_mirror_filter_banks.h"
 
-#include <cstddef>  // std::size_t
+#include <algorithm>  // std::fill, std::min
+#include <cmath>      // std::cos, std::sin, std::sqrt
+#include <cstddef>    // std::size_t
 
 #include "SPTK/utils/misc_utils.h"
 
@@ -27,8 +29,9 @@ PseudoQuadratureMirrorFilterBanks::PseudoQuadratureMirrorFilterBanks(
     int num_iteration, double convergence_threshold, double initial_step_size)
     : num_subband_(num_subband),
       all_zero_filter_(num_filter_order, false),
+      fourier_transform_(2 * num_subband),
       is_valid_(true) {
-  if (!all_zero_filter_.IsValid()) {
+  if (!all_zero_filter_.IsValid() || !fourier_transform_.IsValid()) {
     is_valid_ = false;
     return;
   }
@@ -36,10 +39,29 @@ PseudoQuadratureMirrorFilterBanks::PseudoQuadratureMirrorFilterBanks(
   if (!MakePseudoQuadratureMirrorFilterBanks(
           false, num_subband_, num_filter_order, attenuation, num_iteration,
           convergence_threshold, initial_step_size, &filter_banks_,
-          &is_converged_)) {
+          &is_converged_, &prototype_filter_)) {
     is_valid_ = false;
     return;
   }
+
+  // Prepare cosine modulation of polyphase components.
+  const int fft_length(2 * num_subband_);
+  const double half_order(0.5 * num_filter_order);
+  pre_twiddle_real_.resize(fft_length);
+  pre_twiddle_imag_.resize(fft_length);
+  for (int r(0); r < fft_length; ++r) {
+    const double a(sptk::kPi * (r - half_order) / fft_length);
+    pre_twiddle_real_[r] = std::cos(a);
+    pre_twiddle_imag_[r] = -std::sin(a);
+  }
+  post_twiddle_real_.resize(num_subband_);
+  post_twiddle_imag_.resize(num_subband_);
+  for (int k(0); k < num_subband_; ++k) {
+    const double a(sptk::kPi * k * num_filter_order / fft_length);
+    const double sign(IsEven(k) ? 1.0 : -1.0);
+    post_twiddle_real_[k] = std::sqrt(2.0) * (std::cos(a) + sign * std::sin(a));
+    post_twiddle_imag_[k] = std::sqrt(2.0) * (sign * std::cos(a) - std::sin(a));
+  }
 }
 
 bool PseudoQuadratureMirrorFilterBanks::Run(
@@ -79,4 +101,72 @@ bool PseudoQuadratureMirrorFilterBanks::Run(
   return true;
 }
 
+bool PseudoQuadratureMirrorFilterBanks::Run(
+    const std::vector<double>& input, std::vector<double>* output,
+    PseudoQuadratureMirrorFilterBanks::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || input.size() != static_cast<std::size_t>(num_subband_) ||
+      NULL == output || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int filter_size(GetNumFilterOrder() + 1);
+  const int fft_length(2 * num_subband_);
+  if (output->size() != static_cast<std::size_t>(num_subband_)) {
+    output->resize(num_subband_);
+  }
+  if (buffer->signals_.size() != static_cast<std::size_t>(filter_size)) {
+    buffer->signals_.resize(filter_size);
+    std::fill(buffer->signals_.begin(), buffer->signals_.end(), 0.0);
+  }
+  if (buffer->real_part_.size() != static_cast<std::size_t>(fft_length)) {
+    buffer->real_part_.resize(fft_length);
+  }
+  if (buffer->imag_part_.size() != static_cast<std::size_t>(fft_length)) {
+    buffer->imag_part_.resize(fft_length);
+  }
+
+  // Update delay line so that d[n] holds the n-th past sample.
+  double* d(&buffer->signals_[0]);
+  for (int n(filter_size - 1); num_subband_ <= n; --n) {
+    d[n] = d[n - num_subband_];
+  }
+  for (int n(std::min(num_subband_, filter_size) - 1); 0 <= n; --n) {
+    d[n] = input[num_subband_ - 1 - n];
+  }
+
+  // Compute polyphase components.
+  double* u(&buffer->real_part_[0]);
+  std::fill(buffer->real_part_.begin(), buffer->real_part_.end(), 0.0);
+  {
+    const double* h(&prototype_filter_[0]);
+    double sign(1.0);
+    for (int l(0); l < filter_size; l += fft_length) {
+      const int end(std::min(l + fft_length, filter_size));
+      for (int n(l); n < end; ++n) {
+        u[n - l] += sign * h[n] * d[n];
+      }
+      sign = -sign;
+    }
+  }
+
+  // Apply cosine modulation.
+  double* y(&((*output)[0]));
+  double* v(&buffer->imag_part_[0]);
+  for (int r(0); r < fft_length; ++r) {
+    v[r] = u[r] * pre_twiddle_imag_[r];
+    u[r] *= pre_twiddle_real_[r];
+  }
+  if (!fourier_transform_.Run(&buffer->real_part_, &buffer->imag_part_,
+                              &buffer->buffer_for_fourier_transform_)) {
+    return false;
+  }
+  for (int k(0); k < num_subband_; ++k) {
+    y[k] = post_twiddle_real_[k] * u[k] + post_twiddle_imag_[k] * v[k];
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -16,11 +16,15 @@
 
 #include "SPTK/generation/nonrecursive_maximum_likelihood_parameter_generation.h"
 
-#include <algorithm>  // std::count
+#include <algorithm>  // std::count, std::fill
+#include <cmath>      // std::fabs
 #include <cstddef>    // std::size_t
 
 namespace {
 
+// This must be the same as the threshold used in SymmetricMatrix::Invert.
+const double kMinimumValueOfDiagonalElement(1e-12);
+
 bool CheckSize(const std::vector<std::vector<double> >& vectors, int size) {
   const int outer_size(static_cast<int>(vectors.size()));
   for (int i(0); i < outer_size; ++i) {
@@ -51,6 +55,35 @@ bool CheckRange(int index, int max, const double* array, bool reverse) {
              : false;
 }
 
+bool IsDiagonal(const sptk::SymmetricMatrix& matrix) {
+  const int num_dimension(matrix.GetNumDimension());
+  for (int k(1); k < num_dimension; ++k) {
+    for (int l(0); l < k; ++l) {
+      if (0.0 != matrix[k][l]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Invert the k-th diagonal element of a diagonal covariance matrix. The result
+// is identical to that of SymmetricMatrix::Invert.
+bool InvertVariance(int k, double variance, double* precision) {
+  if ((0 == k && 0.0 == variance) ||
+      (0 < k && std::fabs(variance) <= kMinimumValueOfDiagonalElement)) {
+    return false;
+  }
+  *precision = 1.0 / variance;
+  return true;
+}
+
+// Get index of packed lower triangular part of symmetric matrix.
+int GetPackedIndex(int row, int column) {
+  return (row < column) ? column * (column + 1) / 2 + row
+                        : row * (row + 1) / 2 + column;
+}
+
 }  // namespace
 
 namespace sptk {
@@ -86,36 +119,102 @@ NonrecursiveMaximumLikelihoodParameterGeneration::
       max_half_window_width_ = half_window_width;
     }
   }
+
+  // Find nonzero terms of W'U^{-1}M and W'U^{-1}W in advance since they
+  // depend only on the windows.
+  const int num_window(static_cast<int>(window_coefficients_.size()));
+  const int max_window_width(2 * max_half_window_width_ + 1);
+  for (int d(0); d < num_window; ++d) {
+    const int half_window_width(
+        (static_cast<int>(window_coefficients_[d].size()) - 1) / 2);
+    const double* window_coefficients(
+        &(window_coefficients_[d][half_window_width]));
+    for (int j(-half_window_width); j <= half_window_width; ++j) {
+      if (0.0 == window_coefficients[-j]) continue;
+      const MeanTerm mean_term = {d, j, window_coefficients[-j]};
+      mean_terms_.push_back(mean_term);
+      for (int k(0); k < max_window_width; ++k) {
+        if (CheckRange(k - j, half_window_width, window_coefficients, false)) {
+          const PrecisionTerm precision_term = {
+              d, j, k, window_coefficients[-j], window_coefficients[k - j]};
+          precision_terms_.push_back(precision_term);
+        }
+      }
+    }
+  }
 }
 
 bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     const std::vector<std::vector<double> >& mean_vectors,
     const std::vector<std::vector<double> >& variance_vectors,
     std::vector<std::vector<double> >* smoothed_static_parameters) const {
-  if (!is_valid_ || variance_vectors.empty()) {
+  Buffer buffer;
+  return Run(mean_vectors, variance_vectors, smoothed_static_parameters,
+             &buffer);
+}
+
+bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    std::vector<std::vector<double> >* smoothed_static_parameters) const {
+  Buffer buffer;
+  return Run(mean_vectors, covariance_matrices, smoothed_static_parameters,
+             &buffer);
+}
+
+bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<std::vector<double> >& variance_vectors,
+    std::vector<std::vector<double> >* smoothed_static_parameters,
+    Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || mean_vectors.empty() ||
+      mean_vectors.size() != variance_vectors.size() ||
+      NULL == smoothed_static_parameters || NULL == buffer) {
     return false;
   }
 
-  const int sequence_length(static_cast<int>(variance_vectors.size()));
-  std::vector<SymmetricMatrix> covariance_matrices(
-      sequence_length,
-      SymmetricMatrix(static_cast<int>(variance_vectors[0].size())));
-  for (int t(0); t < sequence_length; ++t) {
-    if (!covariance_matrices[t].SetDiagonal(variance_vectors[t])) {
-      return false;
+  const int num_window(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int length(static_size * num_window);
+  if (!CheckSize(mean_vectors, length) ||
+      !CheckSize(variance_vectors, length)) {
+    return false;
+  }
+
+  const int sequence_length(static_cast<int>(mean_vectors.size()));
+  const int continuous_length(
+      MarkContinuousFrames(mean_vectors, &buffer->is_continuous_));
+
+  // Set precisions.
+  buffer->vseq_.resize(length * continuous_length);
+  for (int absolute_t(0), t(0); absolute_t < sequence_length; ++absolute_t) {
+    if (!buffer->is_continuous_[absolute_t]) continue;
+    for (int k(0); k < length; ++k) {
+      if (!InvertVariance(k, variance_vectors[absolute_t][k],
+                          &buffer->vseq_[length * t + k])) {
+        return false;
+      }
     }
+    ++t;
   }
-  return Run(mean_vectors, covariance_matrices, smoothed_static_parameters);
+
+  SolveWithDiagonalPrecisions(mean_vectors, continuous_length, buffer);
+  StoreParameters(buffer->is_continuous_, buffer->wum_,
+                  smoothed_static_parameters);
+
+  return true;
 }
 
 bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     const std::vector<std::vector<double> >& mean_vectors,
     const std::vector<SymmetricMatrix>& covariance_matrices,
-    std::vector<std::vector<double> >* smoothed_static_parameters) const {
+    std::vector<std::vector<double> >* smoothed_static_parameters,
+    Buffer* buffer) const {
   // Check inputs.
   if (!is_valid_ || mean_vectors.empty() ||
       mean_vectors.size() != covariance_matrices.size() ||
-      NULL == smoothed_static_parameters) {
+      NULL == smoothed_static_parameters || NULL == buffer) {
     return false;
   }
 
@@ -127,85 +226,275 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     return false;
   }
 
+  const int sequence_length(static_cast<int>(mean_vectors.size()));
+  const int continuous_length(
+      MarkContinuousFrames(mean_vectors, &buffer->is_continuous_));
+
+  bool is_diagonal(true);
+  for (int absolute_t(0); absolute_t < sequence_length; ++absolute_t) {
+    if (buffer->is_continuous_[absolute_t] &&
+        !IsDiagonal(covariance_matrices[absolute_t])) {
+      is_diagonal = false;
+      break;
+    }
+  }
+
+  if (is_diagonal) {
+    // Set precisions.
+    buffer->vseq_.resize(length * continuous_length);
+    for (int absolute_t(0), t(0); absolute_t < sequence_length;
+         ++absolute_t) {
+      if (!buffer->is_continuous_[absolute_t]) continue;
+      for (int k(0); k < length; ++k) {
+        if (!InvertVariance(k, covariance_matrices[absolute_t][k][k],
+                            &buffer->vseq_[length * t + k])) {
+          return false;
+        }
+      }
+      ++t;
+    }
+    SolveWithDiagonalPrecisions(mean_vectors, continuous_length, buffer);
+  } else {
+    if (!SolveWithFullPrecisions(mean_vectors, covariance_matrices,
+                                 continuous_length, buffer)) {
+      return false;
+    }
+  }
+
+  StoreParameters(buffer->is_continuous_, buffer->wum_,
+                  smoothed_static_parameters);
+
+  return true;
+}
+
+int NonrecursiveMaximumLikelihoodParameterGeneration::MarkContinuousFrames(
+    const std::vector<std::vector<double> >& mean_vectors,
+    std::vector<bool>* is_continuous) const {
   // Store positions that contain a magic number.
   const int sequence_length(static_cast<int>(mean_vectors.size()));
-  std::vector<bool> is_continuous(sequence_length, true);
+  is_continuous->assign(sequence_length, true);
   if (use_magic_number_) {
     for (int absolute_t(0); absolute_t < sequence_length; ++absolute_t) {
       if (magic_number_ == mean_vectors[absolute_t][0]) {
-        is_continuous[absolute_t] = false;
+        (*is_continuous)[absolute_t] = false;
       }
     }
   }
-  const int continuous_length(static_cast<int>(
-      std::count(is_continuous.begin(), is_continuous.end(), true)));
+  return static_cast<int>(
+      std::count(is_continuous->begin(), is_continuous->end(), true));
+}
 
-  // Prepare memories.
+bool NonrecursiveMaximumLikelihoodParameterGeneration::IsBoundary(
+    int t, int absolute_t, int window_index, int continuous_length,
+    const std::vector<bool>& is_continuous) const {
+  const int sequence_length(static_cast<int>(is_continuous.size()));
+  const int half_window_width(
+      (static_cast<int>(window_coefficients_[window_index].size()) - 1) / 2);
+  const double* window_coefficients(
+      &(window_coefficients_[window_index][half_window_width]));
+  for (int j(-half_window_width); j <= half_window_width; ++j) {
+    const int biased_t(t + j);
+    const int biased_absolute_t(absolute_t + j);
+    if (biased_t < 0 || continuous_length <= biased_t ||
+        (0.0 != window_coefficients[j] && 0 <= biased_absolute_t &&
+         biased_absolute_t < sequence_length &&
+         !is_continuous[biased_absolute_t])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void NonrecursiveMaximumLikelihoodParameterGeneration::
+    SolveWithDiagonalPrecisions(
+        const std::vector<std::vector<double> >& mean_vectors,
+        int continuous_length, Buffer* buffer) const {
+  // Since the static components are independent of each other, W'U^{-1}W is
+  // stored as the band matrices of the components. The element at the t-th
+  // row and the (t+k)-th column of the m-th component is stored in
+  // wuw[(W * t + k) * (M + 1) + m], where W is the maximum window width.
+  const int num_window(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int length(static_size * num_window);
   const int max_window_width(2 * max_half_window_width_ + 1);
-  const int wuw_height(static_size * continuous_length);
-  const int wuw_width(static_size * max_window_width);
-  std::vector<std::vector<double> > mseq(continuous_length,
-                                         std::vector<double>(length));
-  std::vector<SymmetricMatrix> vseq(continuous_length, SymmetricMatrix(length));
-  std::vector<double> wum(wuw_height);
-  std::vector<std::vector<double> > wuw(wuw_height,
-                                        std::vector<double>(wuw_width));
-  std::vector<double> gg(wuw_height);
-  std::vector<double> cc(wuw_height);
-  {
-    if (smoothed_static_parameters->size() !=
-        static_cast<std::size_t>(sequence_length)) {
-      smoothed_static_parameters->resize(sequence_length);
+  const int band_size(static_size * max_window_width);
+  const int sequence_length(static_cast<int>(mean_vectors.size()));
+  const std::vector<bool>& is_continuous(buffer->is_continuous_);
+
+  // Prepare memories.
+  buffer->mseq_.resize(length * continuous_length);
+  buffer->wum_.assign(static_size * continuous_length, 0.0);
+  buffer->wuw_.assign(band_size * continuous_length, 0.0);
+  buffer->z_.resize(static_size);
+  if (0 == continuous_length) {
+    return;
+  }
+  double* mseq(&(buffer->mseq_[0]));
+  double* vseq(&(buffer->vseq_[0]));
+  double* wum(&(buffer->wum_[0]));
+  double* wuw(&(buffer->wuw_[0]));
+  double* z(&(buffer->z_[0]));
+
+  // Set mseq and vseq.
+  for (int absolute_t(0), t(0); absolute_t < sequence_length; ++absolute_t) {
+    if (!is_continuous[absolute_t]) continue;
+
+    const double* mean(&(mean_vectors[absolute_t][0]));
+    for (int d(0); d < num_window; ++d) {
+      const int offset(length * t + static_size * d);
+      if (IsBoundary(t, absolute_t, d, continuous_length, is_continuous)) {
+        std::fill(mseq + offset, mseq + offset + static_size, 0.0);
+        std::fill(vseq + offset, vseq + offset + static_size, 0.0);
+      } else {
+        for (int m(0); m < static_size; ++m) {
+          mseq[offset + m] = vseq[offset + m] * mean[offset - length * t + m];
+        }
+      }
+    }
+
+    // Update counter.
+    ++t;
+  }
+
+  // Calculate WUM and WUW.
+  for (int t(0); t < continuous_length; ++t) {
+    double* wum_t(wum + static_size * t);
+    for (const MeanTerm& term : mean_terms_) {
+      const int biased_t(t + term.time_offset);
+      if (biased_t < 0 || continuous_length <= biased_t) continue;
+      const double* m_t(mseq + length * biased_t +
+                        static_size * term.window_index);
+      for (int m(0); m < static_size; ++m) {
+        wum_t[m] += term.coefficient * m_t[m];
+      }
+    }
+
+    for (const PrecisionTerm& term : precision_terms_) {
+      const int biased_t(t + term.time_offset);
+      if (biased_t < 0 || continuous_length <= biased_t ||
+          continuous_length <= t + term.band_index) {
+        continue;
+      }
+      const double* v_t(vseq + length * biased_t +
+                        static_size * term.window_index);
+      double* wuw_tk(wuw + band_size * t + static_size * term.band_index);
+      for (int m(0); m < static_size; ++m) {
+        wuw_tk[m] +=
+            term.left_coefficient * v_t[m] * term.right_coefficient;
+      }
+    }
+  }
+
+  // Compute LDL' decomposition.
+  for (int t(0); t < continuous_length; ++t) {
+    double* wuw_t(wuw + band_size * t);
+    for (int i(1); i < max_window_width && i <= t; ++i) {
+      const double* wuw_ti(wuw + band_size * (t - i));
+      for (int m(0); m < static_size; ++m) {
+        const double l(wuw_ti[static_size * i + m]);
+        wuw_t[m] -= l * l * wuw_ti[m];
+      }
+    }
+
+    for (int m(0); m < static_size; ++m) {
+      z[m] = 1.0 / wuw_t[m];
+    }
+    for (int i(1); i < max_window_width; ++i) {
+      double* wuw_tk(wuw_t + static_size * i);
+      for (int j(1); i + j < max_window_width && j <= t; ++j) {
+        const double* wuw_tj(wuw + band_size * (t - j));
+        for (int m(0); m < static_size; ++m) {
+          wuw_tk[m] -= wuw_tj[static_size * j + m] *
+                       wuw_tj[static_size * (i + j) + m] * wuw_tj[m];
+        }
+      }
+      for (int m(0); m < static_size; ++m) {
+        wuw_tk[m] *= z[m];
+      }
+    }
+  }
+
+  // Forward substitution to solve a set of linear equations.
+  for (int t(0); t < continuous_length; ++t) {
+    double* g_t(wum + static_size * t);
+    for (int i(1); i < max_window_width && i <= t; ++i) {
+      const double* l(wuw + band_size * (t - i) + static_size * i);
+      const double* g_ti(wum + static_size * (t - i));
+      for (int m(0); m < static_size; ++m) {
+        g_t[m] -= l[m] * g_ti[m];
+      }
+    }
+  }
+
+  // Backward substitution to solve a set of linear equations.
+  for (int t(continuous_length - 1); 0 <= t; --t) {
+    double* c_t(wum + static_size * t);
+    const double* wuw_t(wuw + band_size * t);
+    for (int m(0); m < static_size; ++m) {
+      c_t[m] /= wuw_t[m];
     }
-    for (int t(0); t < sequence_length; ++t) {
-      if ((*smoothed_static_parameters)[t].size() !=
-          static_cast<std::size_t>(static_size)) {
-        (*smoothed_static_parameters)[t].resize(static_size);
+    for (int i(1); i < max_window_width && t + i < continuous_length; ++i) {
+      const double* c_ti(wum + static_size * (t + i));
+      for (int m(0); m < static_size; ++m) {
+        c_t[m] -= wuw_t[static_size * i + m] * c_ti[m];
       }
     }
   }
+}
+
+bool NonrecursiveMaximumLikelihoodParameterGeneration::SolveWithFullPrecisions(
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    int continuous_length, Buffer* buffer) const {
+  // The static components are interleaved and solved jointly. The precision
+  // matrices are stored in packed lower triangular form.
+  const int num_window(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int length(static_size * num_window);
+  const int packed_size(length * (length + 1) / 2);
+  const int max_window_width(2 * max_half_window_width_ + 1);
+  const int wuw_height(static_size * continuous_length);
+  const int wuw_width(static_size * max_window_width);
+  const int sequence_length(static_cast<int>(mean_vectors.size()));
+  const std::vector<bool>& is_continuous(buffer->is_continuous_);
+
+  // Prepare memories.
+  buffer->mseq_.assign(length * continuous_length, 0.0);
+  buffer->vseq_.assign(packed_size * continuous_length, 0.0);
+  buffer->wum_.assign(wuw_height, 0.0);
+  buffer->wuw_.assign(wuw_height * wuw_width, 0.0);
+  if (0 == continuous_length) {
+    return true;
+  }
+  double* mseq(&(buffer->mseq_[0]));
+  double* vseq(&(buffer->vseq_[0]));
+  double* wum(&(buffer->wum_[0]));
+  double* wuw(&(buffer->wuw_[0]));
 
   // Set mseq and vseq.
+  SymmetricMatrix precision;
   for (int absolute_t(0), t(0); absolute_t < sequence_length; ++absolute_t) {
     if (!is_continuous[absolute_t]) continue;
 
-    SymmetricMatrix precision;
     if (!covariance_matrices[absolute_t].Invert(&precision)) {
       return false;
     }
     const double* mean(&(mean_vectors[absolute_t][0]));
+    double* m_t(mseq + length * t);
+    double* v_t(vseq + packed_size * t);
 
     for (int k(0); k < length; ++k) {
-      // Check boundary.
-      bool is_boundary(false);
-      {
-        const int d(k / static_size);
-        const int half_window_width(
-            (static_cast<int>(window_coefficients_[d].size()) - 1) / 2);
-        for (int j(-half_window_width); j <= half_window_width; ++j) {
-          const int biased_t(t + j);
-          const int biased_absolute_t(absolute_t + j);
-          const double* window_coefficients(
-              &(window_coefficients_[d][half_window_width]));
-          if (biased_t < 0 || continuous_length <= biased_t ||
-              (0.0 != window_coefficients[j] && 0 <= biased_absolute_t &&
-               biased_absolute_t < sequence_length &&
-               !is_continuous[biased_absolute_t])) {
-            is_boundary = true;
-          }
-        }
-      }
-
-      if (!is_boundary) {
+      if (!IsBoundary(t, absolute_t, k / static_size, continuous_length,
+                      is_continuous)) {
         const double p(precision[k][k]);
-        mseq[t][k] = p * mean[k];
-        vseq[t][k][k] = p;
+        m_t[k] = p * mean[k];
+        v_t[GetPackedIndex(k, k)] = p;
         for (int l(0); l < k; ++l) {
           const double q(precision[k][l]);
           if (0.0 != q) {
-            mseq[t][k] += q * mean[l];
-            mseq[t][l] += q * mean[k];
-            vseq[t][k][l] = q;
+            m_t[k] += q * mean[l];
+            m_t[l] += q * mean[k];
+            v_t[GetPackedIndex(k, l)] = q;
           }
         }
       }
@@ -219,6 +508,7 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
   for (int t(0); t < continuous_length; ++t) {
     for (int m(0); m < static_size; ++m) {
       const int tau(static_size * t + m);
+      double* wuw_tau(wuw + wuw_width * tau);
       for (int n(0); n < static_size; ++n) {
         for (int d(0); d < num_window; ++d) {
           const int half_window_width(
@@ -234,14 +524,15 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
             if (0 == n &&
                 CheckRange(j, half_window_width, window_coefficients, true)) {
               wum[tau] += (window_coefficients[-j] *
-                           mseq[biased_t][d * static_size + m]);
+                           mseq[length * biased_t + d * static_size + m]);
             }
 
             // Accumulate W'U^{-1}W.
+            const double* v_t(vseq + packed_size * biased_t);
             double wu(0.0);
             for (int c(0); c < num_window; ++c) {
-              const double u(
-                  vseq[biased_t][static_size * c + m][static_size * d + n]);
+              const double u(v_t[GetPackedIndex(static_size * c + m,
+                                                static_size * d + n)]);
               const int half_window_width2(
                   (static_cast<int>(window_coefficients_[c].size()) - 1) / 2);
               const double* window_coefficients2(
@@ -259,7 +550,7 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
                 if (CheckRange(k - j, half_window_width, window_coefficients,
                                false) &&
                     0 <= index) {
-                  wuw[tau][index] += wu * window_coefficients[k - j];
+                  wuw_tau[index] += wu * window_coefficients[k - j];
                 }
               }
             }
@@ -269,64 +560,68 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     }
   }
 
-  // Compute Cholesky factor.
+  // Compute LDL' decomposition.
   for (int t(0); t < wuw_height; ++t) {
+    double* wuw_t(wuw + wuw_width * t);
     for (int i(1); i < wuw_width && i <= t; ++i) {
-      wuw[t][0] -= wuw[t - i][i] * wuw[t - i][i] * wuw[t - i][0];
+      const double* wuw_ti(wuw + wuw_width * (t - i));
+      wuw_t[0] -= wuw_ti[i] * wuw_ti[i] * wuw_ti[0];
     }
 
-    const double z(1.0 / wuw[t][0]);
+    const double z(1.0 / wuw_t[0]);
     for (int i(1); i < wuw_width; ++i) {
       for (int j(1); i + j < wuw_width && j <= t; ++j) {
-        wuw[t][i] -= wuw[t - j][j] * wuw[t - j][i + j] * wuw[t - j][0];
+        const double* wuw_tj(wuw + wuw_width * (t - j));
+        wuw_t[i] -= wuw_tj[j] * wuw_tj[i + j] * wuw_tj[0];
       }
-      wuw[t][i] *= z;
+      wuw_t[i] *= z;
     }
   }
 
   // Forward substitution to solve a set of linear equations.
-  {
-    double* r(&(wum[0]));
-    double* g(&(gg[0]));
-    for (int t(0); t < wuw_height; ++t) {
-      g[t] = r[t];
-      for (int i(1); i < wuw_width && i <= t; ++i) {
-        g[t] -= wuw[t - i][i] * g[t - i];
-      }
+  for (int t(0); t < wuw_height; ++t) {
+    for (int i(1); i < wuw_width && i <= t; ++i) {
+      wum[t] -= wuw[wuw_width * (t - i) + i] * wum[t - i];
     }
   }
 
   // Backward substitution to solve a set of linear equations.
-  {
-    double* g(&(gg[0]));
-    double* c(&(cc[0]));
-    for (int t(wuw_height - 1); 0 <= t; --t) {
-      c[t] = g[t] / wuw[t][0];
-      for (int i(1); i < wuw_width && t + i < wuw_height; ++i) {
-        c[t] -= wuw[t][i] * c[t + i];
-      }
+  for (int t(wuw_height - 1); 0 <= t; --t) {
+    const double* wuw_t(wuw + wuw_width * t);
+    wum[t] /= wuw_t[0];
+    for (int i(1); i < wuw_width && t + i < wuw_height; ++i) {
+      wum[t] -= wuw_t[i] * wum[t + i];
     }
   }
 
-  // Store generated parameters.
-  {
-    double* c(&(cc[0]));
-    int u(0);
-    for (int absolute_t(0); absolute_t < sequence_length; ++absolute_t) {
-      double* C(&((*smoothed_static_parameters)[absolute_t][0]));
-      if (is_continuous[absolute_t]) {
-        for (int k(0); k < static_size; ++k) {
-          C[k] = c[u++];
-        }
-      } else {
-        for (int k(0); k < static_size; ++k) {
-          C[k] = magic_number_;
-        }
+  return true;
+}
+
+void NonrecursiveMaximumLikelihoodParameterGeneration::StoreParameters(
+    const std::vector<bool>& is_continuous, const std::vector<double>& cc,
+    std::vector<std::vector<double> >* smoothed_static_parameters) const {
+  const int static_size(num_order_ + 1);
+  const int sequence_length(static_cast<int>(is_continuous.size()));
+  if (smoothed_static_parameters->size() !=
+      static_cast<std::size_t>(sequence_length)) {
+    smoothed_static_parameters->resize(sequence_length);
+  }
+
+  for (int absolute_t(0), u(0); absolute_t < sequence_length; ++absolute_t) {
+    std::vector<double>& c((*smoothed_static_parameters)[absolute_t]);
+    if (c.size() != static_cast<std::size_t>(static_size)) {
+      c.resize(static_size);
+    }
+    if (is_continuous[absolute_t]) {
+      for (int k(0); k < static_size; ++k) {
+        c[k] = cc[u++];
+      }
+    } else {
+      for (int k(0); k < static_size; ++k) {
+        c[k] = magic_number_;
       }
     }
   }
-
-  return true;
 }
 
 }  // namespace sptk
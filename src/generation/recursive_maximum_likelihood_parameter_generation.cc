@@ -16,7 +16,7 @@
 
 #include "SPTK/generation/recursive_maximum_likelihood_parameter_generation.h"
 
-#include <algorithm>  // std::fill, std::max
+#include <algorithm>  // std::copy, std::fill, std::max
 #include <cfloat>     // DBL_MAX
 #include <cstddef>    // std::size_t
 
@@ -32,50 +32,21 @@ RecursiveMaximumLikelihoodParameterGeneration::
       window_coefficients_(window_coefficients),
       input_source_(input_source),
       is_valid_(true) {
-  if (num_order_ < 0 || num_past_frame_ < 0 || NULL == input_source_ ||
-      !input_source_->IsValid()) {
+  if (NULL == input_source_ || !input_source_->IsValid() || !Initialize()) {
     is_valid_ = false;
     return;
   }
 
-  int max_half_window_width(0);
-  for (std::vector<std::vector<double> >::iterator itr(
-           window_coefficients_.begin());
-       itr != window_coefficients_.end(); ++itr) {
-    const int window_width(static_cast<int>(itr->size()));
-    if (0 == window_width % 2) {
-      itr->push_back(0.0);
-    }
-    const int half_window_width(window_width / 2);
-    if (max_half_window_width < half_window_width) {
-      max_half_window_width = half_window_width;
-    }
-  }
-
-  if (num_past_frame_ < max_half_window_width) {
-    is_valid_ = false;
-    return;
-  }
-
-  // calculation_field is past + present + future.
-  calculation_field_ = num_past_frame_ + 1 + max_half_window_width;
-  num_remaining_frame_ = calculation_field_;
-  current_frame_ = num_past_frame_;
-
   for (int i(1); i < calculation_field_; ++i) {
-    if (!input_source->Get(&buffer_.static_and_dynamic_parameters)) {
-      const int static_and_dynamic_size(
-          static_cast<int>(buffer_.static_and_dynamic_parameters.size() / 2));
-      // Initialize with zero mean.
-      std::fill(buffer_.static_and_dynamic_parameters.begin(),
-                buffer_.static_and_dynamic_parameters.begin() +
-                    static_and_dynamic_size,
-                0.0);
-      // Initialize with infinite variance.
-      std::fill(buffer_.static_and_dynamic_parameters.begin() +
-                    static_and_dynamic_size,
-                buffer_.static_and_dynamic_parameters.end(), DBL_MAX);
-      --num_remaining_frame_;
+    if (input_source_->Get(&buffer_.static_and_dynamic_parameters)) {
+      if (buffer_.static_and_dynamic_parameters.size() !=
+          static_cast<std::size_t>(input_size_)) {
+        is_valid_ = false;
+        return;
+      }
+      ++num_input_frame_;
+    } else {
+      SetUnobservedParameters();
     }
     if (!Forward()) {
       is_valid_ = false;
@@ -84,133 +55,208 @@ RecursiveMaximumLikelihoodParameterGeneration::
   }
 }
 
+RecursiveMaximumLikelihoodParameterGeneration::
+    RecursiveMaximumLikelihoodParameterGeneration(
+        int num_order, int num_past_frame,
+        const std::vector<std::vector<double> >& window_coefficients)
+    : num_order_(num_order),
+      num_past_frame_(num_past_frame),
+      window_coefficients_(window_coefficients),
+      input_source_(NULL),
+      is_valid_(true) {
+  if (!Initialize()) {
+    is_valid_ = false;
+    return;
+  }
+}
+
 bool RecursiveMaximumLikelihoodParameterGeneration::Get(
     std::vector<double>* smoothed_static_parameters) {
-  if (!is_valid_ || NULL == smoothed_static_parameters) {
+  if (!is_valid_ || NULL == input_source_ ||
+      NULL == smoothed_static_parameters) {
     return false;
   }
 
-  if (!input_source_->Get(&buffer_.static_and_dynamic_parameters)) {
-    const int static_and_dynamic_size(
-        static_cast<int>(buffer_.static_and_dynamic_parameters.size() / 2));
-    // Unobserbed mean is zero.
-    std::fill(
-        buffer_.static_and_dynamic_parameters.begin(),
-        buffer_.static_and_dynamic_parameters.begin() + static_and_dynamic_size,
-        0.0);
-    // Unobserved variance is infinite.
-    std::fill(
-        buffer_.static_and_dynamic_parameters.begin() + static_and_dynamic_size,
-        buffer_.static_and_dynamic_parameters.end(), DBL_MAX);
-    if (num_remaining_frame_ <= 1) {
+  if (input_source_->Get(&buffer_.static_and_dynamic_parameters)) {
+    if (buffer_.static_and_dynamic_parameters.size() !=
+        static_cast<std::size_t>(input_size_)) {
+      return false;
+    }
+    ++num_input_frame_;
+  } else {
+    if (num_input_frame_ <= num_output_frame_) {
       return false;
     }
-    --num_remaining_frame_;
+    SetUnobservedParameters();
   }
   if (!Forward()) {
     return false;
   }
 
-  const int static_size(GetSize());
-  if (smoothed_static_parameters->size() !=
-      static_cast<std::size_t>(static_size)) {
-    smoothed_static_parameters->resize(static_size);
+  Output(smoothed_static_parameters);
+
+  return true;
+}
+
+bool RecursiveMaximumLikelihoodParameterGeneration::Push(
+    const std::vector<double>& static_and_dynamic_parameters,
+    std::vector<double>* smoothed_static_parameters, bool* is_output) {
+  // Frames cannot be pushed after flushing.
+  if (!is_valid_ || NULL != input_source_ ||
+      static_and_dynamic_parameters.size() !=
+          static_cast<std::size_t>(input_size_) ||
+      NULL == smoothed_static_parameters || NULL == is_output ||
+      num_input_frame_ != GetNumForwardedFrame()) {
+    return false;
   }
 
-  const int t((current_frame_ - num_past_frame_ - 1) % calculation_field_);
-  double* output(&((*smoothed_static_parameters)[0]));
-  for (int m(0); m < static_size; ++m) {
-    output[m] = buffer_.c[m][t];
+  std::copy(static_and_dynamic_parameters.begin(),
+            static_and_dynamic_parameters.end(),
+            buffer_.static_and_dynamic_parameters.begin());
+  ++num_input_frame_;
+  if (!Forward()) {
+    return false;
+  }
+
+  *is_output =
+      (num_output_frame_ + calculation_field_ <= GetNumForwardedFrame());
+  if (*is_output) {
+    Output(smoothed_static_parameters);
   }
 
   return true;
 }
 
-bool RecursiveMaximumLikelihoodParameterGeneration::Forward() {
-  const int num_delta(static_cast<int>(window_coefficients_.size()));
-  const int static_size(num_order_ + 1);
-  const int dynamic_size(static_size * num_delta);
+bool RecursiveMaximumLikelihoodParameterGeneration::Flush(
+    std::vector<double>* smoothed_static_parameters) {
+  if (!is_valid_ || NULL != input_source_ ||
+      NULL == smoothed_static_parameters ||
+      num_input_frame_ <= num_output_frame_) {
+    return false;
+  }
 
-  // Prepare memories.
-  {
-    if (buffer_.stored_dynamic_mean_vectors.size() !=
-        static_cast<std::size_t>(dynamic_size)) {
-      buffer_.stored_dynamic_mean_vectors.resize(dynamic_size);
-      for (int m(0); m < dynamic_size; ++m) {
-        buffer_.stored_dynamic_mean_vectors[m].resize(calculation_field_);
-      }
+  while (GetNumForwardedFrame() < num_output_frame_ + calculation_field_) {
+    SetUnobservedParameters();
+    if (!Forward()) {
+      return false;
     }
+  }
 
-    if (buffer_.stored_dynamic_diagonal_covariance_matrices.size() !=
-        static_cast<std::size_t>(dynamic_size)) {
-      buffer_.stored_dynamic_diagonal_covariance_matrices.resize(dynamic_size);
-      for (int m(0); m < dynamic_size; ++m) {
-        buffer_.stored_dynamic_diagonal_covariance_matrices[m].resize(
-            calculation_field_);
-      }
-    }
+  Output(smoothed_static_parameters);
 
-    if (buffer_.pi.size() != static_cast<std::size_t>(static_size)) {
-      buffer_.pi.resize(static_size);
-      for (int m(0); m < static_size; ++m) {
-        buffer_.pi[m].resize(calculation_field_);
-      }
-    }
+  return true;
+}
 
-    if (buffer_.k.size() != static_cast<std::size_t>(static_size)) {
-      buffer_.k.resize(static_size);
-      for (int m(0); m < static_size; ++m) {
-        buffer_.k[m].resize(calculation_field_);
-      }
-    }
+bool RecursiveMaximumLikelihoodParameterGeneration::Initialize() {
+  if (num_order_ < 0 || num_past_frame_ < 0) {
+    return false;
+  }
 
-    if (buffer_.p.size() != static_cast<std::size_t>(static_size)) {
-      buffer_.p.resize(static_size);
-      for (int m(0); m < static_size; ++m) {
-        buffer_.p[m].resize(calculation_field_);
-        for (int u(0); u < calculation_field_; ++u) {
-          buffer_.p[m][u].resize(2 * calculation_field_ + 1);
-          std::fill(buffer_.p[m][u].begin(), buffer_.p[m][u].end(), 0.0);
-          buffer_.p[m][u][calculation_field_] = DBL_MAX;
-        }
-      }
+  int max_half_window_width(0);
+  for (std::vector<std::vector<double> >::iterator itr(
+           window_coefficients_.begin());
+       itr != window_coefficients_.end(); ++itr) {
+    const int window_width(static_cast<int>(itr->size()));
+    if (0 == window_width % 2) {
+      itr->push_back(0.0);
     }
-
-    if (buffer_.c.size() != static_cast<std::size_t>(static_size)) {
-      buffer_.c.resize(static_size);
-      for (int m(0); m < static_size; ++m) {
-        buffer_.c[m].resize(calculation_field_);
-        std::fill(buffer_.c[m].begin(), buffer_.c[m].end(), 0.0);
-      }
+    const int half_window_width(window_width / 2);
+    if (max_half_window_width < half_window_width) {
+      max_half_window_width = half_window_width;
     }
   }
 
-  // Copy inputs.
+  if (num_past_frame_ < max_half_window_width) {
+    return false;
+  }
+
+  // calculation_field is past + present + future.
+  const int num_delta(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int dynamic_size(static_size * num_delta);
+  input_size_ = 2 * (static_size + dynamic_size);
+  calculation_field_ = num_past_frame_ + 1 + max_half_window_width;
+  current_frame_ = num_past_frame_;
+  num_input_frame_ = 0;
+  num_output_frame_ = 0;
+
+  // Prepare memories. Each buffer is a ring buffer along time whose length is
+  // the calculation field. The t-th row of the error covariance of the m-th
+  // component, P[m][t], is stored from p[(L * m + t) * (2L + 1)], where L is
+  // the calculation field, and its center is the diagonal element.
+  const int p_width(2 * calculation_field_ + 1);
+  buffer_.static_and_dynamic_parameters.resize(input_size_);
+  buffer_.stored_dynamic_mean_vectors.resize(dynamic_size * calculation_field_);
+  buffer_.stored_dynamic_diagonal_covariance_matrices.resize(
+      dynamic_size * calculation_field_);
+  buffer_.pi.resize(calculation_field_);
+  buffer_.k.resize(calculation_field_);
+  buffer_.p.assign(static_size * calculation_field_ * p_width, 0.0);
+  for (int i(calculation_field_); i < static_cast<int>(buffer_.p.size());
+       i += p_width) {
+    buffer_.p[i] = DBL_MAX;
+  }
+  buffer_.c.assign(static_size * calculation_field_, 0.0);
+  buffer_.positions.resize(calculation_field_);
+
+  return true;
+}
+
+void RecursiveMaximumLikelihoodParameterGeneration::SetUnobservedParameters() {
+  const int static_and_dynamic_size(input_size_ / 2);
+  if (buffer_.static_and_dynamic_parameters.size() !=
+      static_cast<std::size_t>(input_size_)) {
+    buffer_.static_and_dynamic_parameters.resize(input_size_);
+  }
+  // Unobserbed mean is zero.
+  std::fill(
+      buffer_.static_and_dynamic_parameters.begin(),
+      buffer_.static_and_dynamic_parameters.begin() + static_and_dynamic_size,
+      0.0);
+  // Unobserved variance is infinite.
+  std::fill(
+      buffer_.static_and_dynamic_parameters.begin() + static_and_dynamic_size,
+      buffer_.static_and_dynamic_parameters.end(), DBL_MAX);
+}
+
+bool RecursiveMaximumLikelihoodParameterGeneration::Forward() {
+  const int num_delta(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int dynamic_size(static_size * num_delta);
   const int max_half_window_width(calculation_field_ - num_past_frame_ - 1);
+  const int p_width(2 * calculation_field_ + 1);
+
+  // Find the positions of frames in ring buffers. The position of the u-th
+  // frame from the current frame is stored in positions[u].
+  int* positions(&(buffer_.positions[num_past_frame_]));
+  for (int u(-num_past_frame_); u <= max_half_window_width; ++u) {
+    positions[u] = (current_frame_ + u) % calculation_field_;
+  }
+
+  // Copy inputs.
   {
-    const int t((current_frame_ + max_half_window_width) % calculation_field_);
+    const int t(positions[max_half_window_width]);
 
     const double* static_and_dynamic_mean_vector(
         &(buffer_.static_and_dynamic_parameters[0]));
     for (int m(0); m < static_size; ++m) {
-      buffer_.c[m][t] = static_and_dynamic_mean_vector[m];
+      buffer_.c[calculation_field_ * m + t] = static_and_dynamic_mean_vector[m];
     }
     for (int m(0); m < dynamic_size; ++m) {
-      buffer_.stored_dynamic_mean_vectors[m][t] =
+      buffer_.stored_dynamic_mean_vectors[calculation_field_ * m + t] =
           static_and_dynamic_mean_vector[static_size + m];
     }
 
     const double* static_and_dynamic_diagonal_covariance_matrix(
         &(buffer_.static_and_dynamic_parameters[static_size + dynamic_size]));
     for (int m(0); m < static_size; ++m) {
-      std::fill(buffer_.p[m][t].begin(), buffer_.p[m][t].end(), 0.0);
-    }
-    for (int m(0); m < static_size; ++m) {
-      buffer_.p[m][t][calculation_field_] =
-          static_and_dynamic_diagonal_covariance_matrix[m];
+      double* p(&(buffer_.p[(calculation_field_ * m + t) * p_width]));
+      std::fill(p, p + p_width, 0.0);
+      p[calculation_field_] = static_and_dynamic_diagonal_covariance_matrix[m];
     }
     for (int m(0); m < dynamic_size; ++m) {
-      buffer_.stored_dynamic_diagonal_covariance_matrices[m][t] =
+      const int index(calculation_field_ * m + t);
+      buffer_.stored_dynamic_diagonal_covariance_matrices[index] =
           static_and_dynamic_diagonal_covariance_matrix[static_size + m];
     }
   }
@@ -224,9 +270,10 @@ bool RecursiveMaximumLikelihoodParameterGeneration::Forward() {
     // Do not update state if given variance is infinite.
     bool update(true);
     for (int m(0); m < static_size; ++m) {
+      const double* p(&(buffer_.p[calculation_field_ * m * p_width +
+                                  calculation_field_]));
       for (int j(-half_window_width); j <= half_window_width; ++j) {
-        if (DBL_MAX == buffer_.p[m][(current_frame_ + j) % calculation_field_]
-                                [calculation_field_]) {
+        if (DBL_MAX == p[positions[j] * p_width]) {
           update = false;
           break;
         }
@@ -235,72 +282,62 @@ bool RecursiveMaximumLikelihoodParameterGeneration::Forward() {
     }
     if (!update) continue;
 
-    // Calculate the numerator of Kalman gain.
     for (int m(0); m < static_size; ++m) {
-      double* pi(&buffer_.pi[m][num_past_frame_]);
+      // The center of P[m][0].
+      double* p(&(buffer_.p[calculation_field_ * m * p_width +
+                            calculation_field_]));
+      double* pi(&(buffer_.pi[num_past_frame_]));
+      double* k(&(buffer_.k[num_past_frame_]));
+      double* c(&(buffer_.c[calculation_field_ * m]));
+      const int dynamic_index(calculation_field_ * (static_size * d + m));
+
+      // Calculate the numerator of Kalman gain.
       for (int u(-num_past_frame_); u <= max_half_window_width; ++u) {
         double tmp(0.0);
         for (int j(-half_window_width); j <= half_window_width; ++j) {
-          double* p(&buffer_.p[m][(current_frame_ + j) % calculation_field_]
-                              [calculation_field_]);
-          tmp += window_coefficients[j] * p[u - j];
+          tmp += window_coefficients[j] * p[positions[j] * p_width + u - j];
         }
         pi[u] = tmp;
       }
-    }
 
-    // Calculate Kalman gain.
-    for (int m(0); m < static_size; ++m) {
-      double* pi(&buffer_.pi[m][num_past_frame_]);
-      double tmp(0.0);
-      for (int j(-half_window_width); j <= half_window_width; ++j) {
-        tmp += window_coefficients[j] * pi[j];
-      }
+      // Calculate Kalman gain.
+      {
+        double tmp(0.0);
+        for (int j(-half_window_width); j <= half_window_width; ++j) {
+          tmp += window_coefficients[j] * pi[j];
+        }
 
-      const double denominator(
-          1.0 /
-          (tmp +
-           buffer_.stored_dynamic_diagonal_covariance_matrices
-               [static_size * d + m][current_frame_ % calculation_field_]));
-      double* k(&buffer_.k[m][num_past_frame_]);
-      for (int u(-num_past_frame_); u <= max_half_window_width; ++u) {
-        k[u] = pi[u] * denominator;
+        const double denominator(
+            1.0 / (tmp + buffer_.stored_dynamic_diagonal_covariance_matrices
+                             [dynamic_index + positions[0]]));
+        for (int u(-num_past_frame_); u <= max_half_window_width; ++u) {
+          k[u] = pi[u] * denominator;
+        }
       }
-    }
 
-    // Update error covariance.
-    for (int m(0); m < static_size; ++m) {
-      double* pi(&buffer_.pi[m][num_past_frame_]);
-      double* k(&buffer_.k[m][num_past_frame_]);
+      // Update error covariance.
       for (int u(-num_past_frame_); u <= max_half_window_width; ++u) {
-        double* pu(&buffer_.p[m][(current_frame_ + u) % calculation_field_]
-                             [calculation_field_]);
+        double* pu(p + positions[u] * p_width);
         for (int v(std::max(u, -half_window_width)); v <= max_half_window_width;
              ++v) {
           pu[v - u] -= k[v] * pi[u];
           if (v != u) {
-            double* pv(&buffer_.p[m][(current_frame_ + v) % calculation_field_]
-                                 [calculation_field_]);
+            double* pv(p + positions[v] * p_width);
             pv[u - v] = pu[v - u];
           }
         }
       }
-    }
-
-    // Update state estimates.
-    for (int m(0); m < static_size; ++m) {
-      double* c(&buffer_.c[m][0]);
-      double tmp(buffer_.stored_dynamic_mean_vectors[static_size * d + m]
-                                                    [current_frame_ %
-                                                     calculation_field_]);
-      for (int j(-half_window_width); j <= half_window_width; ++j) {
-        tmp -= window_coefficients[j] *
-               c[(current_frame_ + j) % calculation_field_];
-      }
 
-      double* k(&buffer_.k[m][num_past_frame_]);
-      for (int u(-num_past_frame_); u <= max_half_window_width; ++u) {
-        c[(current_frame_ + u) % calculation_field_] += k[u] * tmp;
+      // Update state estimates.
+      {
+        double tmp(
+            buffer_.stored_dynamic_mean_vectors[dynamic_index + positions[0]]);
+        for (int j(-half_window_width); j <= half_window_width; ++j) {
+          tmp -= window_coefficients[j] * c[positions[j]];
+        }
+        for (int u(-num_past_frame_); u <= max_half_window_width; ++u) {
+          c[positions[u]] += k[u] * tmp;
+        }
       }
     }
   }
@@ -310,4 +347,20 @@ bool RecursiveMaximumLikelihoodParameterGeneration::Forward() {
   return true;
 }
 
+void RecursiveMaximumLikelihoodParameterGeneration::Output(
+    std::vector<double>* smoothed_static_parameters) {
+  const int static_size(GetSize());
+  if (smoothed_static_parameters->size() !=
+      static_cast<std::size_t>(static_size)) {
+    smoothed_static_parameters->resize(static_size);
+  }
+
+  const int t((current_frame_ - num_past_frame_ - 1) % calculation_field_);
+  double* output(&((*smoothed_static_parameters)[0]));
+  for (int m(0); m < static_size; ++m) {
+    output[m] = buffer_.c[calculation_field_ * m + t];
+  }
+  ++num_output_frame_;
+}
+
 }  // namespace sptk
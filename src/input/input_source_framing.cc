@@ -0,0 +1,149 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/input/input_source_framing.h"
+
+#include <algorithm>  // std::copy, std::fill, std::transform
+#include <cstddef>    // std::size_t
+#include <numeric>    // std::accumulate
+
+namespace sptk {
+
+InputSourceFraming::InputSourceFraming(int frame_length, int frame_period,
+                                       FramingTypes framing_type,
+                                       bool zero_mean,
+                                       std::istream* input_stream)
+    : frame_length_(frame_length),
+      frame_period_(frame_period),
+      framing_type_(framing_type),
+      zero_mean_(zero_mean),
+      center_(kBeginningOfDataIsCenterOfFirstFrame == framing_type
+                  ? frame_length / 2
+                  : 0),
+      input_stream_(input_stream),
+      is_valid_(true),
+      is_first_frame_(true),
+      is_end_(false),
+      is_eof_(false),
+      is_failed_(false),
+      last_data_position_in_frame_(0),
+      data_(frame_length < 0 ? 0 : frame_length) {
+  if (frame_length_ <= 0 || frame_period_ <= 0 || framing_type_ < 0 ||
+      kNumFramingTypes <= framing_type_ || NULL == input_stream_) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool InputSourceFraming::Get(std::vector<double>* frame) {
+  if (!is_valid_ || NULL == frame || is_end_) {
+    return false;
+  }
+
+  if (!Read()) {
+    is_end_ = true;
+    return false;
+  }
+
+  if (frame->size() != static_cast<std::size_t>(frame_length_)) {
+    frame->resize(frame_length_);
+  }
+  if (zero_mean_) {
+    const double mean(std::accumulate(data_.begin(), data_.end(), 0.0) /
+                      frame_length_);
+    std::transform(data_.begin(), data_.end(), frame->begin(),
+                   [mean](double x) { return x - mean; });
+  } else {
+    std::copy(data_.begin(), data_.end(), frame->begin());
+  }
+
+  return true;
+}
+
+bool InputSourceFraming::Read() {
+  const int overlap(frame_length_ - frame_period_);
+  int actual_read_size;
+
+  // Extract the first frame.
+  if (is_first_frame_) {
+    is_first_frame_ = false;
+
+    int read_point;
+    int read_size;
+    if (kBeginningOfDataIsCenterOfFirstFrame == framing_type_) {
+      if (0 == frame_length_ % 2) {
+        read_point = frame_length_ / 2;
+        read_size = frame_length_ / 2;
+      } else {
+        read_point = (frame_length_ - 1) / 2;
+        read_size = (frame_length_ + 1) / 2;
+      }
+    } else {
+      read_point = 0;
+      read_size = frame_length_;
+    }
+
+    if (!ReadStream(true, 0, read_point, read_size, &data_, input_stream_,
+                    &actual_read_size)) {
+      return false;
+    }
+
+    if (overlap <= 0) {
+      return true;
+    }
+    is_eof_ = input_stream_->peek() == std::ios::traits_type::eof();
+    last_data_position_in_frame_ = center_ + actual_read_size - 1;
+  } else if (0 < overlap) {
+    // Move overlapped data.
+    std::copy(data_.begin() + frame_period_, data_.end(), data_.begin());
+
+    // Read next data.
+    if (is_eof_) {
+      last_data_position_in_frame_ -= frame_period_;
+    } else {
+      if (!ReadStream(true, 0, overlap, frame_period_, &data_, input_stream_,
+                      &actual_read_size)) {
+        is_failed_ = true;
+        return false;
+      }
+
+      if (input_stream_->peek() == std::ios::traits_type::eof()) {
+        last_data_position_in_frame_ = overlap + actual_read_size - 1;
+        is_eof_ = true;
+      }
+    }
+  } else {
+    if (!ReadStream(true, -overlap, 0, frame_length_, &data_, input_stream_,
+                    &actual_read_size)) {
+      return false;
+    }
+    return !(kBeginningOfDataIsCenterOfFirstFrame == framing_type_ &&
+             actual_read_size <= center_);
+  }
+
+  // The frames are extracted until the center passes the last data.
+  if (last_data_position_in_frame_ < center_) {
+    return false;
+  }
+  if (is_eof_) {
+    std::fill(data_.begin() + last_data_position_in_frame_ + 1, data_.end(),
+              0.0);
+  }
+
+  return true;
+}
+
+}  // namespace sptk
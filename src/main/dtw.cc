@@ -24,6 +24,7 @@
 #include "Getopt/getoptwin.h"
 #include "SPTK/math/distance_calculation.h"
 #include "SPTK/math/dynamic_time_warping.h"
+#include "SPTK/math/fast_dynamic_time_warping.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -34,6 +35,13 @@ const sptk::DynamicTimeWarping::LocalPathConstraints
         sptk::DynamicTimeWarping::LocalPathConstraints::kType4);
 const sptk::DistanceCalculation::DistanceMetrics kDefaultDistanceMetric(
     sptk::DistanceCalculation::DistanceMetrics::kEuclidean);
+const sptk::DynamicTimeWarping::GlobalPathConstraints
+    kDefaultGlobalPathConstraint(
+        sptk::DynamicTimeWarping::GlobalPathConstraints::kUnconstrained);
+const int kDefaultWindowWidth(10);
+const double kDefaultMaximumSlope(2.0);
+const int kDefaultRadius(10);
+const bool kDefaultScoreOnlyFlag(false);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -51,17 +59,30 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 1 (Euclidean)" << std::endl;
   *stream << "                 2 (squared Euclidean)" << std::endl;
   *stream << "                 3 (symmetric Kullback-Leibler)" << std::endl;
+  *stream << "       -g g  : type of global path constraint (   int)[" << std::setw(5) << std::right << kDefaultGlobalPathConstraint << "][ 0 <= g <= 2 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (none)" << std::endl;
+  *stream << "                 1 (Sakoe-Chiba band)" << std::endl;
+  *stream << "                 2 (Itakura parallelogram)" << std::endl;
+  *stream << "       -w w  : width of Sakoe-Chiba band      (   int)[" << std::setw(5) << std::right << kDefaultWindowWidth         << "][ 0 <= w <=   ]" << std::endl;  // NOLINT
+  *stream << "       -x x  : maximum slope of Itakura       (double)[" << std::setw(5) << std::right << kDefaultMaximumSlope        << "][ 1 <  x <=   ]" << std::endl;  // NOLINT
+  *stream << "               parallelogram" << std::endl;
+  *stream << "       -r r  : radius of FastDTW              (   int)[" << std::setw(5) << std::right << kDefaultRadius              << "][ 0 <= r <=   ]" << std::endl;  // NOLINT
   *stream << "       -P P  : output filename of int type    (string)[" << std::setw(5) << std::right << "N/A"                       << "]" << std::endl;  // NOLINT
   *stream << "               Viterbi path" << std::endl;
   *stream << "       -S S  : output filename of double type (string)[" << std::setw(5) << std::right << "N/A"                       << "]" << std::endl;  // NOLINT
   *stream << "               total score" << std::endl;
+  *stream << "       -s    : output only total score        (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultScoreOnlyFlag) << "]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  file1:" << std::endl;
   *stream << "       reference vector sequence              (double)" << std::endl;  // NOLINT
   *stream << "  infile:" << std::endl;
   *stream << "       query vector sequence                  (double)[stdin]" << std::endl;  // NOLINT
   *stream << "  stdout:" << std::endl;
-  *stream << "       warped vector sequence                 (double)" << std::endl;  // NOLINT
+  *stream << "       warped vector sequence or total score  (double)" << std::endl;  // NOLINT
+  *stream << "  notice:" << std::endl;
+  *stream << "       if -s option is given, -P option is not used" << std::endl;
+  *stream << "       if -r option is given, approximate DTW is performed" << std::endl;  // NOLINT
+  *stream << "       -r option can not be used with -g, -w, and -x options" << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -85,16 +106,46 @@ void PrintUsage(std::ostream* stream) {
  *     \arg @c 1 Euclidean
  *     \arg @c 2 squared Euclidean
  *     \arg @c 3 symmetric Kullback-Leibler
+ * - @b -g @e int
+ *   - type of global path constraint
+ *     \arg @c 0 none
+ *     \arg @c 1 Sakoe-Chiba band
+ *     \arg @c 2 Itakura parallelogram
+ * - @b -w @e int
+ *   - width of Sakoe-Chiba band @f$(0 \le W)@f$
+ * - @b -x @e double
+ *   - maximum slope of Itakura parallelogram @f$(1 < S)@f$
+ * - @b -r @e int
+ *   - radius of FastDTW @f$(0 \le r)@f$
  * - @b -P @e str
  *   - int-type Viterbi path
  * - @b -S @e str
  *   - double-type DTW score
+ * - @b -s
+ *   - output only DTW score
  * - @b file1 @e str
  *   - double-type reference vector sequence
  * - @b infile @e str
  *   - double-type query vector sequence
  * - @b stdout
- *   - double-type concatenated vector sequence
+ *   - double-type concatenated vector sequence or DTW score
+ *
+ * The search space can be restricted to reduce computation and memory for
+ * long sequences. When only the DTW score is required, the memory usage is
+ * proportional to the length of the reference sequence.
+ *
+ * @code{.sh}
+ *   dtw -l 2 -g 1 -w 50 reference.d < query.d > warped.d
+ *   dtw -l 2 -g 2 -x 2 -s reference.d < query.d > score.d
+ * @endcode
+ *
+ * If -r option is given, the Viterbi path is approximately obtained by
+ * FastDTW, whose computational cost is linear in the length of sequences.
+ * The global path constraint cannot be used with FastDTW.
+ *
+ * @code{.sh}
+ *   dtw -l 2 -r 10 reference.d < query.d > warped.d
+ * @endcode
  *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
@@ -106,11 +157,20 @@ int main(int argc, char* argv[]) {
       kDefaultLocalPathConstraint);
   sptk::DistanceCalculation::DistanceMetrics distance_metric(
       kDefaultDistanceMetric);
+  sptk::DynamicTimeWarping::GlobalPathConstraints global_path_constraint(
+      kDefaultGlobalPathConstraint);
+  int window_width(kDefaultWindowWidth);
+  double maximum_slope(kDefaultMaximumSlope);
+  int radius(kDefaultRadius);
+  bool global_path_parameter_flag(false);
+  bool fast_dtw_flag(false);
   const char* total_score_file(NULL);
   const char* viterbi_path_file(NULL);
+  bool score_only_flag(kDefaultScoreOnlyFlag);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "l:m:p:d:P:S:h", NULL, NULL));
+    const int option_char(
+        getopt_long(argc, argv, "l:m:p:d:g:w:x:r:P:S:sh", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -175,6 +235,60 @@ int main(int argc, char* argv[]) {
             static_cast<sptk::DistanceCalculation::DistanceMetrics>(tmp);
         break;
       }
+      case 'g': {
+        const int min(0);
+        const int max(static_cast<int>(
+                          sptk::DynamicTimeWarping::GlobalPathConstraints::
+                              kNumGlobalPathConstraints) -
+                      1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -g option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("dtw", error_message);
+          return 1;
+        }
+        global_path_constraint =
+            static_cast<sptk::DynamicTimeWarping::GlobalPathConstraints>(tmp);
+        break;
+      }
+      case 'w': {
+        if (!sptk::ConvertStringToInteger(optarg, &window_width) ||
+            window_width < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -w option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("dtw", error_message);
+          return 1;
+        }
+        global_path_parameter_flag = true;
+        break;
+      }
+      case 'x': {
+        if (!sptk::ConvertStringToDouble(optarg, &maximum_slope) ||
+            maximum_slope <= 1.0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -x option must be greater than 1.0";
+          sptk::PrintErrorMessage("dtw", error_message);
+          return 1;
+        }
+        global_path_parameter_flag = true;
+        break;
+      }
+      case 'r': {
+        if (!sptk::ConvertStringToInteger(optarg, &radius) || radius < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -r option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("dtw", error_message);
+          return 1;
+        }
+        fast_dtw_flag = true;
+        break;
+      }
       case 'P': {
         viterbi_path_file = optarg;
         break;
@@ -183,6 +297,10 @@ int main(int argc, char* argv[]) {
         total_score_file = optarg;
         break;
       }
+      case 's': {
+        score_only_flag = true;
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -194,6 +312,16 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  if (fast_dtw_flag &&
+      (sptk::DynamicTimeWarping::GlobalPathConstraints::kUnconstrained !=
+           global_path_constraint ||
+       global_path_parameter_flag)) {
+    std::ostringstream error_message;
+    error_message << "Cannot specify -g, -w, or -x option with -r option";
+    sptk::PrintErrorMessage("dtw", error_message);
+    return 1;
+  }
+
   const char* reference_file;
   const char* query_file;
   const int num_input_files(argc - optind);
@@ -248,23 +376,54 @@ int main(int argc, char* argv[]) {
     }
   }
 
-  sptk::DynamicTimeWarping dynamic_time_warping(
-      num_order, local_path_constraint, distance_metric);
-  if (!dynamic_time_warping.IsValid()) {
-    std::ostringstream error_message;
-    error_message << "Failed to initialize DynamicTimeWarping";
-    sptk::PrintErrorMessage("dtw", error_message);
-    return 1;
-  }
-
   std::vector<std::pair<int, int> > viterbi_path;
   double total_score;
-  if (!dynamic_time_warping.Run(query_vectors, reference_vectors, &viterbi_path,
-                                &total_score)) {
-    std::ostringstream error_message;
-    error_message << "Failed to perform dynamic time warping";
-    sptk::PrintErrorMessage("dtw", error_message);
-    return 1;
+  if (fast_dtw_flag) {
+    sptk::FastDynamicTimeWarping fast_dynamic_time_warping(
+        num_order, local_path_constraint, distance_metric, radius);
+    if (!fast_dynamic_time_warping.IsValid()) {
+      std::ostringstream error_message;
+      error_message << "Failed to initialize FastDynamicTimeWarping";
+      sptk::PrintErrorMessage("dtw", error_message);
+      return 1;
+    }
+
+    if (!fast_dynamic_time_warping.Run(query_vectors, reference_vectors,
+                                       score_only_flag ? NULL : &viterbi_path,
+                                       &total_score)) {
+      std::ostringstream error_message;
+      error_message << "Failed to perform dynamic time warping";
+      sptk::PrintErrorMessage("dtw", error_message);
+      return 1;
+    }
+  } else {
+    sptk::DynamicTimeWarping dynamic_time_warping(
+        num_order, local_path_constraint, distance_metric,
+        global_path_constraint, window_width, maximum_slope);
+    if (!dynamic_time_warping.IsValid()) {
+      std::ostringstream error_message;
+      error_message << "Failed to initialize DynamicTimeWarping";
+      sptk::PrintErrorMessage("dtw", error_message);
+      return 1;
+    }
+
+    if (!dynamic_time_warping.Run(query_vectors, reference_vectors,
+                                  score_only_flag ? NULL : &viterbi_path,
+                                  &total_score)) {
+      std::ostringstream error_message;
+      error_message << "Failed to perform dynamic time warping";
+      sptk::PrintErrorMessage("dtw", error_message);
+      return 1;
+    }
+  }
+
+  if (score_only_flag) {
+    if (!sptk::WriteStream(total_score, &std::cout)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write total score";
+      sptk::PrintErrorMessage("dtw", error_message);
+      return 1;
+    }
   }
 
   for (std::vector<std::pair<int, int> >::iterator itr(viterbi_path.begin());
@@ -280,7 +439,7 @@ int main(int argc, char* argv[]) {
     }
   }
 
-  if (NULL != viterbi_path_file) {
+  if (NULL != viterbi_path_file && !score_only_flag) {
     std::ofstream ofs;
     ofs.open(viterbi_path_file, std::ios::out | std::ios::binary);
     if (ofs.fail()) {
@@ -26,6 +26,7 @@
 #include "SPTK/generation/normal_distributed_random_value_generation.h"
 #include "SPTK/input/input_source_from_stream.h"
 #include "SPTK/input/input_source_interpolation_with_magic_number.h"
+#include "SPTK/utils/buffered_output_stream.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -219,9 +220,10 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
+    sptk::BufferedOutputStream buffered_output_stream(&std::cout);
     double excitation;
     while (excitation_generation.Get(&excitation, NULL, NULL, NULL)) {
-      if (!sptk::WriteStream(excitation, &std::cout)) {
+      if (!buffered_output_stream.Write(excitation)) {
         std::ostringstream error_message;
         error_message << "Failed to write excitation";
         sptk::PrintErrorMessage("excite", error_message);
@@ -229,6 +231,13 @@ int main(int argc, char* argv[]) {
         return 1;
       }
     }
+    if (!buffered_output_stream.Flush()) {
+      std::ostringstream error_message;
+      error_message << "Failed to write excitation";
+      sptk::PrintErrorMessage("excite", error_message);
+      delete random_generation;
+      return 1;
+    }
   } catch (std::exception&) {
     std::ostringstream error_message;
     error_message << "Unknown exception";
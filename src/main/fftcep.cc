@@ -25,6 +25,8 @@
 #include "SPTK/analysis/fast_fourier_transform_cepstral_analysis.h"
 #include "SPTK/conversion/spectrum_to_spectrum.h"
 #include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/utils/parallel_frame_executor.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -43,6 +45,7 @@ const int kDefaultNumOrder(25);
 const int kDefaultNumIteration(0);
 const double kDefaultAccelerationFactor(0.0);
 const InputFormats kDefaultInputFormat(kWaveform);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -64,6 +67,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 4 (windowed waveform)" << std::endl;
   *stream << "       -e e  : small value added to power spectrum (double)[" << std::setw(5) << std::right << "N/A"                      << "][ 0.0 <  e <=     ]" << std::endl;  // NOLINT
   *stream << "       -E E  : relative floor                      (double)[" << std::setw(5) << std::right << "N/A"                      << "][     <= E <  0.0 ]" << std::endl;  // NOLINT
+  *stream << "       -j j  : number of threads                   (   int)[" << std::setw(5) << std::right << kDefaultNumThread        << "][   1 <= j <=     ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       data sequence                               (double)[stdin]" << std::endl;  // NOLINT
@@ -77,6 +81,63 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
+class FrameProcessor
+    : public sptk::ParallelFrameExecutor::FrameProcessorInterface {
+ public:
+  FrameProcessor(InputFormats input_format,
+                 const sptk::SpectrumToSpectrum& spectrum_to_spectrum,
+                 const sptk::WaveformToSpectrum& waveform_to_spectrum,
+                 const sptk::FastFourierTransformCepstralAnalysis& analysis)
+      : input_format_(input_format),
+        spectrum_to_spectrum_(spectrum_to_spectrum),
+        waveform_to_spectrum_(waveform_to_spectrum),
+        analysis_(analysis) {
+  }
+
+  virtual bool Run(int, const std::vector<double>& input,
+                   std::vector<double>* output, std::ostream* log) {
+    if (kWaveform == input_format_) {
+      if (!waveform_to_spectrum_.Run(input, &processed_input_,
+                                     &buffer_for_spectral_analysis_)) {
+        std::ostringstream error_message;
+        error_message << "Failed to transform waveform to spectrum";
+        sptk::PrintErrorMessage("fftcep", error_message, log);
+        return false;
+      }
+    } else {
+      if (!spectrum_to_spectrum_.Run(input, &processed_input_)) {
+        std::ostringstream error_message;
+        error_message << "Failed to convert spectrum";
+        sptk::PrintErrorMessage("fftcep", error_message, log);
+        return false;
+      }
+    }
+
+    if (!analysis_.Run(processed_input_, output,
+                       &buffer_for_cepstral_analysis_)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run FFT cepstral analysis";
+      sptk::PrintErrorMessage("fftcep", error_message, log);
+      return false;
+    }
+
+    return true;
+  }
+
+ private:
+  const InputFormats input_format_;
+  const sptk::SpectrumToSpectrum& spectrum_to_spectrum_;
+  const sptk::WaveformToSpectrum& waveform_to_spectrum_;
+  const sptk::FastFourierTransformCepstralAnalysis& analysis_;
+
+  std::vector<double> processed_input_;
+  sptk::WaveformToSpectrum::Buffer buffer_for_spectral_analysis_;
+  sptk::FastFourierTransformCepstralAnalysis::Buffer
+      buffer_for_cepstral_analysis_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameProcessor);
+};
+
 }  // namespace
 
 /**
@@ -101,6 +162,8 @@ void PrintUsage(std::ostream* stream) {
  *   - small value added to power spectrum
  * - @b -E @e double
  *   - relative floor in decibels
+ * - @b -j @e int
+ *   - number of threads @f$(1 \le T)@f$
  * - @b infile @e str
  *   - double-type windowed sequence or spectrum
  * - @b stdout
@@ -115,6 +178,13 @@ void PrintUsage(std::ostream* stream) {
  *     fftcep -m 24 -l 512 > data.cep
  * @endcode
  *
+ * The frames can be analyzed by @f$T@f$ threads without changing the output.
+ *
+ * @code{.sh}
+ *   frame -p 80 -l 400 < data.d | window -l 400 -L 512 |
+ *     fftcep -m 24 -l 512 --threads 4 > data.cep
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -127,10 +197,16 @@ int main(int argc, char* argv[]) {
   InputFormats input_format(kDefaultInputFormat);
   double epsilon(0.0);
   double relative_floor_in_decibels(-DBL_MAX);
+  int num_thread(kDefaultNumThread);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "l:m:i:a:q:e:E:h", NULL, NULL));
+        getopt_long(argc, argv, "l:m:i:a:q:e:E:j:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -212,6 +288,17 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("fftcep", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -268,7 +355,6 @@ int main(int argc, char* argv[]) {
       fft_length, fft_length,
       sptk::SpectrumToSpectrum::InputOutputFormats::kPowerSpectrum, epsilon,
       relative_floor_in_decibels);
-  sptk::WaveformToSpectrum::Buffer buffer_for_spectral_analysis;
   if (kWaveform == input_format && !waveform_to_spectrum.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize WaveformToSpectrum";
@@ -278,8 +364,6 @@ int main(int argc, char* argv[]) {
 
   sptk::FastFourierTransformCepstralAnalysis analysis(
       fft_length, num_order, num_iteration, acceleration_factor);
-  sptk::FastFourierTransformCepstralAnalysis::Buffer
-      buffer_for_cepstral_analysis;
   if (!analysis.IsValid()) {
     std::ostringstream error_message;
     error_message
@@ -290,44 +374,29 @@ int main(int argc, char* argv[]) {
 
   const int input_length(kWaveform == input_format ? fft_length
                                                    : fft_length / 2 + 1);
-  const int output_length(num_order + 1);
-  std::vector<double> input(input_length);
-  std::vector<double> processed_input(fft_length / 2 + 1);
-  std::vector<double> output(output_length);
+  sptk::InputSourceFromStream input_source(false, input_length, &input_stream);
 
-  while (sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
-                          NULL)) {
-    if (kWaveform == input_format) {
-      if (!waveform_to_spectrum.Run(input, &processed_input,
-                                    &buffer_for_spectral_analysis)) {
-        std::ostringstream error_message;
-        error_message << "Failed to transform waveform to spectrum";
-        sptk::PrintErrorMessage("fftcep", error_message);
-        return 1;
-      }
-    } else {
-      if (!spectrum_to_spectrum.Run(input, &processed_input)) {
-        std::ostringstream error_message;
-        error_message << "Failed to convert spectrum";
-        sptk::PrintErrorMessage("fftcep", error_message);
-        return 1;
-      }
-    }
-
-    if (!analysis.Run(processed_input, &output,
-                      &buffer_for_cepstral_analysis)) {
-      std::ostringstream error_message;
-      error_message << "Failed to run FFT cepstral analysis";
-      sptk::PrintErrorMessage("fftcep", error_message);
-      return 1;
-    }
+  std::vector<sptk::ParallelFrameExecutor::FrameProcessorInterface*>
+      frame_processors(num_thread);
+  for (int i(0); i < num_thread; ++i) {
+    frame_processors[i] = new FrameProcessor(
+        input_format, spectrum_to_spectrum, waveform_to_spectrum, analysis);
+  }
+  sptk::ParallelFrameExecutor parallel_frame_executor(frame_processors);
 
-    if (!sptk::WriteStream(0, output_length, output, &std::cout, NULL)) {
+  bool is_processed;
+  const bool is_success(
+      parallel_frame_executor.Run(&input_source, &std::cout, &is_processed));
+  for (int i(0); i < num_thread; ++i) {
+    delete frame_processors[i];
+  }
+  if (!is_success) {
+    if (is_processed) {
       std::ostringstream error_message;
       error_message << "Failed to write FFT cepstrum";
       sptk::PrintErrorMessage("fftcep", error_message);
-      return 1;
     }
+    return 1;
   }
 
   return 0;
@@ -14,28 +14,22 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <algorithm>  // std::copy, std::fill, std::transform
-#include <fstream>    // std::ifstream
-#include <iomanip>    // std::setw
-#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <numeric>    // std::accumulate
-#include <sstream>    // std::ostringstream
-#include <vector>     // std::vector
+#include <fstream>   // std::ifstream
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>   // std::ostringstream
+#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
+#include "SPTK/input/input_source_framing.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
 
-enum FramingTypes {
-  kBegginingOfDataIsCenterOfFirstFrame,
-  kBegginingOfDataIsStartOfFirstFrame,
-  kNumFramingTypes,
-};
-
 const int kDefaultFrameLength(256);
 const int kDefaultFramePeriod(100);
-const FramingTypes kDefaultFramingType(kBegginingOfDataIsCenterOfFirstFrame);
+const sptk::InputSourceFraming::FramingTypes kDefaultFramingType(
+    sptk::InputSourceFraming::kBeginningOfDataIsCenterOfFirstFrame);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -62,31 +56,6 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
-bool WriteData(const std::vector<double>& data, bool zero_mean) {
-  // 这里的.size()是为了获取vector data 的内部元素个数。
-  const int length(static_cast<int>(data.size()));
-  if (zero_mean) {
-    std::vector<double> processed_data(length);
-    const double mean(std::accumulate(data.begin(), data.end(), 0.0) / length);
-    std::transform(data.begin(), data.end(), processed_data.begin(),
-                   [mean](double x) { return x - mean; });
-    if (!sptk::WriteStream(0, length, processed_data, &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write data";
-      sptk::PrintErrorMessage("frame", error_message);
-      return false;
-    }
-  } else {
-    if (!sptk::WriteStream(0, length, data, &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write data";
-      sptk::PrintErrorMessage("frame", error_message);
-      return false;
-    }
-  }
-  return true;
-}
-
 }  // namespace
 
 /**
@@ -147,7 +116,7 @@ bool WriteData(const std::vector<double>& data, bool zero_mean) {
 int main(int argc, char* argv[]) {
   int frame_length(kDefaultFrameLength);
   int frame_period(kDefaultFramePeriod);
-  FramingTypes framing_type(kDefaultFramingType);
+  sptk::InputSourceFraming::FramingTypes framing_type(kDefaultFramingType);
   bool zero_mean(false);
 
   for (;;) {
@@ -179,7 +148,8 @@ int main(int argc, char* argv[]) {
       }
       case 'n': {
         const int min(0);
-        const int max(static_cast<int>(kNumFramingTypes) - 1);
+        const int max(
+            static_cast<int>(sptk::InputSourceFraming::kNumFramingTypes) - 1);
         int tmp;
         if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
             !sptk::IsInRange(tmp, min, max)) {
@@ -189,7 +159,8 @@ int main(int argc, char* argv[]) {
           sptk::PrintErrorMessage("frame", error_message);
           return 1;
         }
-        framing_type = static_cast<FramingTypes>(tmp);
+        framing_type =
+            static_cast<sptk::InputSourceFraming::FramingTypes>(tmp);
         break;
       }
       case 'z': {
@@ -226,95 +197,32 @@ int main(int argc, char* argv[]) {
   }
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
-  std::vector<double> data(frame_length);
-  int actual_read_size;
-
-  // Extract the first frame.
-  {
-    int read_point;
-    int read_size;
-    if (kBegginingOfDataIsCenterOfFirstFrame == framing_type) {
-      if (0 == frame_length % 2) {
-        read_point = frame_length / 2;
-        read_size = frame_length / 2;
-      } else {
-        read_point = (frame_length - 1) / 2;
-        read_size = (frame_length + 1) / 2;
-      }
-    } else if (kBegginingOfDataIsStartOfFirstFrame == framing_type) {
-      read_point = 0;
-      read_size = frame_length;
-    } else {
-      return 0;
-    }
-
-    if (!sptk::ReadStream(true, 0, read_point, read_size, &data, &input_stream,
-                          &actual_read_size)) {
-      return 0;
-    }
-  }
-
-  int center;
-  if (kBegginingOfDataIsCenterOfFirstFrame == framing_type) {
-    center = frame_length / 2;
-  } else if (kBegginingOfDataIsStartOfFirstFrame == framing_type) {
-    center = 0;
-  } else {
-    return 0;
+  sptk::InputSourceFraming input_source(frame_length, frame_period,
+                                        framing_type, zero_mean,
+                                        &input_stream);
+  if (!input_source.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "Failed to initialize InputSourceFraming";
+    sptk::PrintErrorMessage("frame", error_message);
+    return 1;
   }
 
-  // Extract the remaining frames.
-  const int overlap(frame_length - frame_period);
-  if (0 < overlap) {
-    bool is_eof(input_stream.peek() == std::ios::traits_type::eof());
-    int last_data_position_in_frame(center + actual_read_size - 1);
-    while (center <= last_data_position_in_frame) {
-      if (is_eof) {
-        std::fill(data.begin() + last_data_position_in_frame + 1, data.end(),
-                  0.0);
-      }
-
-      // Write framed data.
-      if (!WriteData(data, zero_mean)) {
-        return 1;
-      }
-
-      // Move overlapped data.
-      std::copy(data.begin() + frame_period, data.end(), data.begin());
-
-      // Read next data.
-      if (is_eof) {
-        last_data_position_in_frame -= frame_period;
-      } else {
-        if (!sptk::ReadStream(true, 0, overlap, frame_period, &data,
-                              &input_stream, &actual_read_size)) {
-          std::ostringstream error_message;
-          error_message << "Failed to read data";
-          sptk::PrintErrorMessage("frame", error_message);
-          return 1;
-        }
-
-        if (input_stream.peek() == std::iostream::traits_type::eof()) {
-          last_data_position_in_frame = overlap + actual_read_size - 1;
-          is_eof = true;
-        }
-      }
-    }
-  } else {
-    if (!WriteData(data, zero_mean)) {
+  std::vector<double> data(frame_length);
+  // 这里的.size()是为了获取vector data 的内部元素个数。
+  const int length(static_cast<int>(data.size()));
+  while (input_source.Get(&data)) {
+    if (!sptk::WriteStream(0, length, data, &std::cout, NULL)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write data";
+      sptk::PrintErrorMessage("frame", error_message);
       return 1;
     }
-
-    while (sptk::ReadStream(true, -overlap, 0, frame_length, &data,
-                            &input_stream, &actual_read_size)) {
-      if (kBegginingOfDataIsCenterOfFirstFrame == framing_type &&
-          actual_read_size <= center) {
-        break;
-      }
-      if (!WriteData(data, zero_mean)) {
-        return 1;
-      }
-    }
+  }
+  if (input_source.IsFailed()) {
+    std::ostringstream error_message;
+    error_message << "Failed to read data";
+    sptk::PrintErrorMessage("frame", error_message);
+    return 1;
   }
 
   return 0;
@@ -18,10 +18,10 @@
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/math/frequency_transform.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -31,6 +31,9 @@ const int kDefaultNumOutputOrder(25);
 const double kDefaultInputAlpha(0.0);
 const double kDefaultOutputAlpha(0.35);
 
+// Number of sequences transformed at once.
+const int kBlockSize(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -188,22 +191,19 @@ int main(int argc, char* argv[]) {
   }
 
   const int input_length(num_input_order + 1);
-  const int output_length(num_output_order + 1);
-  std::vector<double> minimum_phase_sequence(input_length);
-  std::vector<double> warped_sequence(output_length);
-
-  while (sptk::ReadStream(false, 0, 0, input_length, &minimum_phase_sequence,
-                          &input_stream, NULL)) {
-    if (!frequency_transform.Run(minimum_phase_sequence, &warped_sequence,
-                                 &buffer)) {
+  sptk::Matrix minimum_phase_sequences(kBlockSize, input_length);
+  sptk::Matrix warped_sequences;
+
+  while (sptk::ReadStream(&minimum_phase_sequences, &input_stream, NULL)) {
+    if (!frequency_transform.RunBatch(minimum_phase_sequences,
+                                      &warped_sequences, &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to run frequency transform";
       sptk::PrintErrorMessage("freqt", error_message);
       return 1;
     }
 
-    if (!sptk::WriteStream(0, output_length, warped_sequence, &std::cout,
-                           NULL)) {
+    if (!sptk::WriteStream(warped_sequences, &std::cout)) {
       std::ostringstream error_message;
       error_message << "Failed to write warped sequence";
       sptk::PrintErrorMessage("freqt", error_message);
@@ -35,6 +35,7 @@ const double kDefaultVarianceFloor(1e-6);
 const double kDefaultSmoothingParameter(0.0);
 const bool kDefaultFullCovarianceFlag(false);
 const bool kDefaultShowLikelihoodFlag(false);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -56,6 +57,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "               type initial GMM parameters" << std::endl;
   *stream << "       -f    : use full covariance      (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultFullCovarianceFlag) << "]" << std::endl;  // NOLINT
   *stream << "       -V    : show log-likelihood      (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultShowLikelihoodFlag) << "]" << std::endl;  // NOLINT
+  *stream << "       -j j  : number of threads        (   int)[" << std::setw(5) << std::right << kDefaultNumThread            << "][   1 <= j <=     ]" << std::endl;  // NOLINT
   *stream << "     (level 2)" << std::endl;
   *stream << "       -B B1 .. Bp : block size of      (   int)[" << std::setw(5) << std::right << "N/A"                        << "][   1 <= B <= l   ]" << std::endl;  // NOLINT
   *stream << "                     covariance matrix" << std::endl;
@@ -100,6 +102,8 @@ void PrintUsage(std::ostream* stream) {
  *   - use full covariance
  * - @b -V
  *   - show log likelihood at each iteration
+ * - @b -j @e int
+ *   - number of threads used in E-step @f$(1 \le J)@f$
  * - @b -B @e int+
  *   - block size of covariance matrix
  * - @b infile @e str
@@ -139,11 +143,17 @@ int main(int argc, char* argv[]) {
   const char* initial_gmm_file(NULL);
   bool full_covariance_flag(kDefaultFullCovarianceFlag);
   bool show_likelihood_flag(kDefaultShowLikelihoodFlag);
+  int num_thread(kDefaultNumThread);
   std::vector<int> block_size;
 
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
+
   for (;;) {
-    const int option_char(
-        getopt_long(argc, argv, "l:m:k:i:d:w:v:M:U:fVB:h", NULL, NULL));
+    const int option_char(getopt_long(
+        argc, argv, "l:m:k:i:d:w:v:M:U:fVj:B:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -248,6 +258,17 @@ int main(int argc, char* argv[]) {
         show_likelihood_flag = true;
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("gmm", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'B': {
         block_size.clear();
         int size;
@@ -377,7 +398,7 @@ int main(int argc, char* argv[]) {
            ? sptk::GaussianMixtureModeling::InitializationType::kUbm
            : sptk::GaussianMixtureModeling::InitializationType::kKMeans),
       (show_likelihood_flag ? 1 : num_iteration + 1), smoothing_parameter,
-      weights, mean_vectors, covariance_matrices);
+      weights, mean_vectors, covariance_matrices, num_thread);
   if (!gaussian_mixture_modeling.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize GaussianMixtureModel";
@@ -29,6 +29,7 @@ namespace {
 const int kDefaultNumOrder(25);
 const int kDefaultNumMixture(16);
 const bool kDefaultFullCovarianceFlag(false);
+const int kBatchSize(1024);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -253,22 +254,35 @@ int main(int argc, char* argv[]) {
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
   const int length(num_order + 1);
-  std::vector<double> input_vector(length);
+  std::vector<std::vector<double> > input_vectors(
+      kBatchSize, std::vector<double>(length));
+  std::vector<double> log_probabilities;
   sptk::GaussianMixtureModeling::Buffer buffer;
 
-  while (sptk::ReadStream(false, 0, 0, length, &input_vector, &input_stream,
-                          NULL)) {
-    double log_probability;
+  for (bool is_eof(false); !is_eof;) {
+    // Read a batch of input vectors.
+    int batch_size(0);
+    for (; batch_size < kBatchSize; ++batch_size) {
+      if (!sptk::ReadStream(false, 0, 0, length, &input_vectors[batch_size],
+                            &input_stream, NULL)) {
+        is_eof = true;
+        break;
+      }
+    }
+    if (0 == batch_size) break;
+    input_vectors.resize(batch_size, std::vector<double>(length));
+
     if (!sptk::GaussianMixtureModeling::CalculateLogProbability(
-            num_order, num_mixture, is_diagonal, true, input_vector, weights,
-            mean_vectors, covariance_matrices, NULL, &log_probability,
+            num_order, num_mixture, is_diagonal, true, input_vectors, weights,
+            mean_vectors, covariance_matrices, NULL, &log_probabilities,
             &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to compute log-probability";
       sptk::PrintErrorMessage("gmmp", error_message);
       return 1;
     }
-    if (!sptk::WriteStream(log_probability, &std::cout)) {
+    if (!sptk::WriteStream(0, batch_size, log_probabilities, &std::cout,
+                           NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write log-probability";
       sptk::PrintErrorMessage("gmmp", error_message);
@@ -28,6 +28,7 @@
 namespace {
 
 const int kDefaultStartIndex(0);
+const bool kDefaultCanonicalFlag(false);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -40,6 +41,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -s s  : start index               (   int)[" << std::setw(5) << std::right << kDefaultStartIndex << "][   <= s <=   ]" << std::endl;  // NOLINT
   *stream << "       -L L  : output filename of double (string)[" << std::setw(5) << std::right << "N/A"              << "]" << std::endl;  // NOLINT
   *stream << "               type average code length" << std::endl;
+  *stream << "       -c    : output canonical codes    (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultCanonicalFlag) << "]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       probability sequence              (double)[stdin]" << std::endl;  // NOLINT
@@ -60,11 +62,18 @@ void PrintUsage(std::ostream* stream) {
  *   - start index @f$(S)@f$
  * - @b -L @e str
  *   - output filename of double-type average code length
+ * - @b -c @e bool
+ *   - output canonical codewords
  * - @b infile @e str
  *   - double-type probability sequence
  * - @b stdout
  *   - ascii-type codebook
  *
+ * If @c -c is given, the codewords are assigned in the canonical form, i.e.,
+ * shorter codewords precede longer ones and codewords of the same length are
+ * consecutive integers in the order of the symbols. The code lengths, and
+ * thus the average code length, are the same as those of the default codes.
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -72,9 +81,10 @@ void PrintUsage(std::ostream* stream) {
 int main(int argc, char* argv[]) {
   int start_index(kDefaultStartIndex);
   const char* average_code_length_file(NULL);
+  bool canonical_flag(kDefaultCanonicalFlag);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "s:L:h", NULL, NULL));
+    const int option_char(getopt_long(argc, argv, "s:L:ch", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -91,6 +101,10 @@ int main(int argc, char* argv[]) {
         average_code_length_file = optarg;
         break;
       }
+      case 'c': {
+        canonical_flag = true;
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -143,7 +157,7 @@ int main(int argc, char* argv[]) {
   if (probabilities.empty()) return 0;
 
   const int num_element(static_cast<int>(probabilities.size()));
-  sptk::HuffmanCoding huffman_coding(num_element);
+  sptk::HuffmanCoding huffman_coding(num_element, canonical_flag);
   if (!huffman_coding.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize HuffmanCoding";
@@ -14,9 +14,12 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
+#include <climits>   // CHAR_BIT
 #include <fstream>   // std::ifstream
+#include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
+#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/compression/huffman_decoding.h"
@@ -24,6 +27,8 @@
 
 namespace {
 
+const bool kDefaultBoolFormatFlag(false);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -32,11 +37,12 @@ void PrintUsage(std::ostream* stream) {
   *stream << "  usage:" << std::endl;
   *stream << "       huffman_decode [ options ] cbfile [ infile ] > stdout" << std::endl;  // NOLINT
   *stream << "  options:" << std::endl;
+  *stream << "       -b    : input in bool-type format  (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultBoolFormatFlag) << "]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  cbfile:" << std::endl;
   *stream << "       codebook                   (string)" << std::endl;
   *stream << "  infile:" << std::endl;
-  *stream << "       codeword sequence          (  bool)[stdin]" << std::endl;
+  *stream << "       packed codeword sequence   ( uchar)[stdin]" << std::endl;
   *stream << "  stdout:" << std::endl;
   *stream << "       symbol sequence            (   int)" << std::endl;
   *stream << std::endl;
@@ -48,15 +54,20 @@ void PrintUsage(std::ostream* stream) {
 }  // namespace
 
 /**
- * @a huffman_encode @e cbfile [ @e infile ]
+ * @a huffman_decode [ @e option ] @e cbfile [ @e infile ]
  *
+ * - @b -b
+ *   - input codewords in bool-type format
  * - @b cbfile @e str
  *   - ascii codebook
  * - @b infile @e str
- *   - bool-type codeword sequence
+ *   - unsigned char-type packed codeword sequence
  * - @b stdout
  *   - int-type symbol sequence
  *
+ * The input format is the same as the output format of @c huffman_encode.
+ * The packed codewords are decoded byte by byte with lookup tables.
+ *
  * The below example encodes @c data.i and decodes it.
  *
  * @code{.sh}
@@ -69,11 +80,17 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  bool bool_format_flag(kDefaultBoolFormatFlag);
+
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "h", NULL, NULL));
+    const int option_char(getopt_long(argc, argv, "bh", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
+      case 'b': {
+        bool_format_flag = true;
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -127,12 +144,80 @@ int main(int argc, char* argv[]) {
   }
   std::istream& input_stream(ifs2.fail() ? std::cin : ifs2);
 
-  bool input;
-  int output;
-  bool is_leaf;
+  if (bool_format_flag) {
+    bool input;
+    int output;
+    bool is_leaf;
+
+    while (sptk::ReadStream(&input, &input_stream)) {
+      if (!huffman_decoding.Get(input, &output, &is_leaf)) {
+        std::ostringstream error_message;
+        error_message << "Failed to decode";
+        sptk::PrintErrorMessage("huffman_decode", error_message);
+        return 1;
+      }
+
+      if (is_leaf && !sptk::WriteStream(output, &std::cout)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write decoded data";
+        sptk::PrintErrorMessage("huffman_decode", error_message);
+        return 1;
+      }
+    }
+
+    return 0;
+  }
 
-  while (sptk::ReadStream(&input, &input_stream)) {
-    if (!huffman_decoding.Get(input, &output, &is_leaf)) {
+  // The last byte is the number of padding bits, so that two bytes are read
+  // ahead of decoding.
+  unsigned char input;
+  unsigned char next_input;
+  unsigned char next_next_input;
+  if (!sptk::ReadStream(&input, &input_stream)) {
+    return 0;
+  }
+  if (!sptk::ReadStream(&next_input, &input_stream)) {
+    std::ostringstream error_message;
+    error_message << "Unexpected end of packed codeword sequence";
+    sptk::PrintErrorMessage("huffman_decode", error_message);
+    return 1;
+  }
+
+  std::vector<int> outputs;
+  while (sptk::ReadStream(&next_next_input, &input_stream)) {
+    if (!huffman_decoding.Get(input, &outputs)) {
+      std::ostringstream error_message;
+      error_message << "Failed to decode";
+      sptk::PrintErrorMessage("huffman_decode", error_message);
+      return 1;
+    }
+
+    for (int output : outputs) {
+      if (!sptk::WriteStream(output, &std::cout)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write decoded data";
+        sptk::PrintErrorMessage("huffman_decode", error_message);
+        return 1;
+      }
+    }
+
+    input = next_input;
+    next_input = next_next_input;
+  }
+
+  // Decode the last byte except for the padding bits.
+  const int num_padding_bit(next_input);
+  if (CHAR_BIT <= num_padding_bit) {
+    std::ostringstream error_message;
+    error_message << "Invalid number of padding bits";
+    sptk::PrintErrorMessage("huffman_decode", error_message);
+    return 1;
+  }
+  for (int i(CHAR_BIT - 1); num_padding_bit <= i; --i) {
+    int output;
+    bool is_leaf;
+    if (!huffman_decoding.Get(static_cast<bool>((input >> i) & 1), &output,
+                              &is_leaf)) {
       std::ostringstream error_message;
       error_message << "Failed to decode";
       sptk::PrintErrorMessage("huffman_decode", error_message);
@@ -14,7 +14,9 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
+#include <climits>   // CHAR_BIT
 #include <fstream>   // std::ifstream
+#include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
 #include <vector>    // std::vector
@@ -25,6 +27,8 @@
 
 namespace {
 
+const bool kDefaultBoolFormatFlag(false);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -33,13 +37,14 @@ void PrintUsage(std::ostream* stream) {
   *stream << "  usage:" << std::endl;
   *stream << "       huffman_encode [ options ] cbfile [ infile ] > stdout" << std::endl;  // NOLINT
   *stream << "  options:" << std::endl;
+  *stream << "       -b    : output in bool-type format (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultBoolFormatFlag) << "]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  cbfile:" << std::endl;
   *stream << "       codebook                   (string)" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       symbol sequence            (   int)[stdin]" << std::endl;
   *stream << "  stdout:" << std::endl;
-  *stream << "       codeword sequence          (  bool)" << std::endl;
+  *stream << "       packed codeword sequence   ( uchar)" << std::endl;
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -51,12 +56,19 @@ void PrintUsage(std::ostream* stream) {
 /**
  * @a huffman_encode @e cbfile [ @e infile ]
  *
+ * - @b -b
+ *   - output codewords in bool-type format
  * - @b cbfile @e str
  *   - ascii codebook
  * - @b infile @e str
  *   - int-type symbol sequence
  * - @b stdout
- *   - bool-type codeword sequence
+ *   - unsigned char-type packed codeword sequence
+ *
+ * The codeword bits are packed into bytes from the most significant bit. The
+ * last byte is padded with zeros and followed by one byte that holds the
+ * number of the padding bits. If @c -b is given, each bit is written as one
+ * bool-type value, which is the format used in the previous versions.
  *
  * The below example encodes @c data.i and decodes it.
  *
@@ -70,11 +82,17 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  bool bool_format_flag(kDefaultBoolFormatFlag);
+
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "h", NULL, NULL));
+    const int option_char(getopt_long(argc, argv, "bh", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
+      case 'b': {
+        bool_format_flag = true;
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -130,6 +148,9 @@ int main(int argc, char* argv[]) {
 
   int input;
   std::vector<bool> output;
+  unsigned char packed_output(0);
+  int num_packed_bit(0);
+  bool is_empty(true);
 
   while (sptk::ReadStream(&input, &input_stream)) {
     if (!huffman_encoding.Run(input, &output)) {
@@ -140,15 +161,48 @@ int main(int argc, char* argv[]) {
     }
 
     const int output_length(static_cast<int>(output.size()));
-    for (int i(0); i < output_length; ++i) {
-      if (!sptk::WriteStream(static_cast<bool>(output[i]), &std::cout)) {
-        std::ostringstream error_message;
-        error_message << "Failed to write encoded data";
-        sptk::PrintErrorMessage("huffman_encode", error_message);
-        return 1;
+    if (0 < output_length) is_empty = false;
+    if (bool_format_flag) {
+      for (int i(0); i < output_length; ++i) {
+        if (!sptk::WriteStream(static_cast<bool>(output[i]), &std::cout)) {
+          std::ostringstream error_message;
+          error_message << "Failed to write encoded data";
+          sptk::PrintErrorMessage("huffman_encode", error_message);
+          return 1;
+        }
+      }
+    } else {
+      for (int i(0); i < output_length; ++i) {
+        packed_output = static_cast<unsigned char>((packed_output << 1) |
+                                                   (output[i] ? 1 : 0));
+        if (CHAR_BIT == ++num_packed_bit) {
+          if (!sptk::WriteStream(packed_output, &std::cout)) {
+            std::ostringstream error_message;
+            error_message << "Failed to write encoded data";
+            sptk::PrintErrorMessage("huffman_encode", error_message);
+            return 1;
+          }
+          packed_output = 0;
+          num_packed_bit = 0;
+        }
       }
     }
   }
 
+  // Flush the last byte and the number of padding bits.
+  if (!bool_format_flag && !is_empty) {
+    const unsigned char num_padding_bit(
+        static_cast<unsigned char>((CHAR_BIT - num_packed_bit) % CHAR_BIT));
+    packed_output =
+        static_cast<unsigned char>(packed_output << num_padding_bit);
+    if ((0 < num_packed_bit && !sptk::WriteStream(packed_output, &std::cout)) ||
+        !sptk::WriteStream(num_padding_bit, &std::cout)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write encoded data";
+      sptk::PrintErrorMessage("huffman_encode", error_message);
+      return 1;
+    }
+  }
+
   return 0;
 }
@@ -14,11 +14,12 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::fill, std::min
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/filter/inverse_pseudo_quadrature_mirror_filter_banks.h"
@@ -32,6 +33,7 @@ const double kDefaultAttenuation(100.0);
 const int kDefaultNumIteration(100);
 const double kDefaultConvergenceThreshold(1e-6);
 const double kDefaultInitialStepSize(1e-2);
+const bool kDefaultInterpolationFlag(false);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -43,6 +45,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "  options:" << std::endl;
   *stream << "       -k k  : number of subbands         (   int)[" << std::setw(5) << std::right << kDefaultNumSubband           << "][   1 <= k <=   ]" << std::endl;  // NOLINT
   *stream << "       -m m  : order of filter            (   int)[" << std::setw(5) << std::right << kDefaultNumFilterOrder       << "][   2 <= m <=   ]" << std::endl;  // NOLINT
+  *stream << "       -c    : input decimated signals    (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultInterpolationFlag) << "]" << std::endl;  // NOLINT
   *stream << "     (level 2)" << std::endl;
   *stream << "       -a a  : stopband attenuation in dB (double)[" << std::setw(5) << std::right << kDefaultAttenuation          << "][   0 <  a <=   ]" << std::endl;  // NOLINT
   *stream << "       -i i  : number of iterations       (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][   0 <  i <=   ]" << std::endl;  // NOLINT
@@ -68,6 +71,8 @@ void PrintUsage(std::ostream* stream) {
  *   - number of subbands @f$(1 \le K)@f$
  * - @b -m @e int
  *   - order of filter @f$(2 \le M)@f$
+ * - @b -c
+ *   - input decimated subband signals
  * - @b -a @e double
  *   - stopband attenuation @f$(0 < \alpha)@f$
  * - @b -i @e int
@@ -88,6 +93,16 @@ void PrintUsage(std::ostream* stream) {
  *   interpolate -l 4 -p 4 -o 2 < data.sub | ipqmf -k 4 | x2x +ds > data.raw
  * @endcode
  *
+ * If the @c -c option is given, the decimated subband signals are directly
+ * interpolated and synthesized by the polyphase implementation. The below
+ * example gives almost the same result as
+ * @c interpolate @c -l @c 4 @c -p @c 4 @c | @c sopr @c -m @c 4 @c | @c ipqmf,
+ * but is much faster.
+ *
+ * @code{.sh}
+ *   ipqmf -k 4 -c < data.sub | x2x +ds > data.raw
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -99,9 +114,11 @@ int main(int argc, char* argv[]) {
   int num_iteration(kDefaultNumIteration);
   double convergence_threshold(kDefaultConvergenceThreshold);
   double initial_step_size(kDefaultInitialStepSize);
+  bool interpolation_flag(kDefaultInterpolationFlag);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "k:m:a:i:d:s:h", NULL, NULL));
+    const int option_char(
+        getopt_long(argc, argv, "k:m:ca:i:d:s:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -127,6 +144,10 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'c': {
+        interpolation_flag = true;
+        break;
+      }
       case 'a': {
         if (!sptk::ConvertStringToDouble(optarg, &attenuation) ||
             attenuation <= 0.0) {
@@ -218,6 +239,51 @@ int main(int argc, char* argv[]) {
   const int delay(sptk::IsEven(num_filter_order) ? num_filter_order / 2
                                                  : (num_filter_order + 1) / 2);
 
+  if (interpolation_flag) {
+    std::vector<double> outputs(num_subband);
+    int num_skip(delay);
+    int num_input(0);
+    int num_output(0);
+    for (bool is_eof(false);;) {
+      if (!is_eof && !sptk::ReadStream(false, 0, 0, num_subband, &input,
+                                       &input_stream, NULL)) {
+        is_eof = true;
+        // The interpolated signal ends with zeros except for one subband.
+        if (1 < num_subband) {
+          std::fill(input.begin(), input.end(), 0.0);
+        }
+      }
+      if (is_eof) {
+        if (num_input * num_subband <= num_output) break;
+      } else {
+        ++num_input;
+      }
+
+      if (!synthesis.Run(input, &outputs, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to perform PQMF synthesis";
+        sptk::PrintErrorMessage("ipqmf", error_message);
+        return 1;
+      }
+      const int begin(std::min(num_skip, num_subband));
+      const int end(
+          std::min(num_subband, begin + num_input * num_subband - num_output));
+      num_skip -= begin;
+      if (begin < end) {
+        if (!sptk::WriteStream(begin, end - begin, outputs, &std::cout,
+                               NULL)) {
+          std::ostringstream error_message;
+          error_message << "Failed to write reconstructed signal";
+          sptk::PrintErrorMessage("ipqmf", error_message);
+          return 1;
+        }
+        num_output += end - begin;
+      }
+    }
+
+    return 0;
+  }
+
   int n(0);
   while (
       sptk::ReadStream(false, 0, 0, num_subband, &input, &input_stream, NULL)) {
@@ -18,16 +18,19 @@
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/conversion/log_area_ratio_to_parcor_coefficients.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
 
 const int kDefaultNumOrder(25);
 
+// Number of frames converted at once.
+const int kBlockSize(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -129,11 +132,11 @@ int main(int argc, char* argv[]) {
   }
 
   const int length(num_order + 1);
-  std::vector<double> coefficients(length);
+  sptk::Matrix coefficients(kBlockSize, length);
 
-  while (sptk::ReadStream(false, 0, 0, length, &coefficients, &input_stream,
-                          NULL)) {
-    if (!log_area_ratio_to_parcor_coefficients.Run(&coefficients)) {
+  while (sptk::ReadStream(&coefficients, &input_stream, NULL)) {
+    if (!log_area_ratio_to_parcor_coefficients.RunBatch(coefficients,
+                                                        &coefficients)) {
       std::ostringstream error_message;
       error_message
           << "Failed to convert log area ratio to PARCOR coefficients";
@@ -141,7 +144,7 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    if (!sptk::WriteStream(0, length, coefficients, &std::cout, NULL)) {
+    if (!sptk::WriteStream(coefficients, &std::cout)) {
       std::ostringstream error_message;
       error_message << "Failed to write PARCOR coefficients";
       sptk::PrintErrorMessage("lar2par", error_message);
@@ -34,6 +34,7 @@ const int kDefaultMinNumVectorInCluster(1);
 const int kDefaultNumIteration(1000);
 const double kDefaultConvergenceThreshold(1e-5);
 const double kDefaultSplittingFactor(1e-5);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -51,6 +52,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "               initial codebook" << std::endl;
   *stream << "       -I I  : output filename of int type   (string)[" << std::setw(5) << std::right << "N/A"                         << "]" << std::endl;  // NOLINT
   *stream << "               codebook index" << std::endl;
+  *stream << "       -j j  : number of threads             (   int)[" << std::setw(5) << std::right << kDefaultNumThread             << "][   1 <= j <=   ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "     (level 2)" << std::endl;
   *stream << "       -n n  : minimum number of vectors in  (   int)[" << std::setw(5) << std::right << kDefaultMinNumVectorInCluster << "][   1 <= n <=   ]" << std::endl;  // NOLINT
@@ -88,6 +90,8 @@ void PrintUsage(std::ostream* stream) {
  *   - double-type initial codebook
  * - @b -I @e str
  *   - int-type output codebook index
+ * - @b -j @e int
+ *   - number of threads used in nearest codebook vector search
  * - @b -n @e int
  *   - minimum number of vectors in a cluster @f$(1 \le V)@f$
  * - @b -i @e int
@@ -122,10 +126,16 @@ int main(int argc, char* argv[]) {
   int num_iteration(kDefaultNumIteration);
   double convergence_threshold(kDefaultConvergenceThreshold);
   double splitting_factor(kDefaultSplittingFactor);
+  int num_thread(kDefaultNumThread);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
 
   for (;;) {
-    const int option_char(
-        getopt_long(argc, argv, "l:m:s:e:C:I:n:i:d:r:h", NULL, NULL));
+    const int option_char(getopt_long(
+        argc, argv, "l:m:s:e:C:I:j:n:i:d:r:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -224,6 +234,17 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("lbg", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -317,7 +338,7 @@ int main(int argc, char* argv[]) {
   sptk::LindeBuzoGrayAlgorithm codebook_design(
       num_order, static_cast<int>(codebook_vectors.size()),
       target_codebook_size, min_num_vector_in_cluster, num_iteration,
-      convergence_threshold, splitting_factor, seed);
+      convergence_threshold, splitting_factor, seed, num_thread);
   if (!codebook_design.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize LindeBuzoGrayAlgorithm";
@@ -24,7 +24,9 @@
 #include "Getopt/getoptwin.h"
 #include "SPTK/analysis/autocorrelation_analysis.h"
 #include "SPTK/conversion/spectrum_to_spectrum.h"
+#include "SPTK/input/input_source_from_stream.h"
 #include "SPTK/math/levinson_durbin_recursion.h"
+#include "SPTK/utils/parallel_frame_executor.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -44,6 +46,7 @@ const int kDefaultFrameLength(256);
 const int kDefaultNumOrder(25);
 const WarningType kDefaultWarningType(kIgnore);
 const InputFormats kDefaultInputFormat(kWaveform);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -66,6 +69,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 2 (|X(z)|)" << std::endl;
   *stream << "                 3 (|X(z)|^2)" << std::endl;
   *stream << "                 4 (windowed waveform)" << std::endl;
+  *stream << "       -j j  : number of threads                       (   int)[" << std::setw(5) << std::right << kDefaultNumThread   << "][ 1 <= j <=   ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       windowed data sequence                          (double)[stdin]" << std::endl;  // NOLINT
@@ -77,6 +81,76 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
+class FrameProcessor
+    : public sptk::ParallelFrameExecutor::FrameProcessorInterface {
+ public:
+  FrameProcessor(
+      InputFormats input_format, WarningType warning_type,
+      const sptk::SpectrumToSpectrum& spectrum_to_spectrum,
+      const sptk::AutocorrelationAnalysis& autocorrelation_analysis,
+      const sptk::LevinsonDurbinRecursion& levinson_durbin_recursion)
+      : input_format_(input_format),
+        warning_type_(warning_type),
+        spectrum_to_spectrum_(spectrum_to_spectrum),
+        autocorrelation_analysis_(autocorrelation_analysis),
+        levinson_durbin_recursion_(levinson_durbin_recursion) {
+  }
+
+  virtual bool Run(int frame_index, const std::vector<double>& input,
+                   std::vector<double>* output, std::ostream* log) {
+    const std::vector<double>* processed_input(&input);
+    if (kWaveform != input_format_) {
+      if (!spectrum_to_spectrum_.Run(input, &processed_input_)) {
+        std::ostringstream error_message;
+        error_message << "Failed to convert spectrum";
+        sptk::PrintErrorMessage("lpc", error_message, log);
+        return false;
+      }
+      processed_input = &processed_input_;
+    }
+
+    if (!autocorrelation_analysis_.Run(*processed_input, &autocorrelation_,
+                                       &buffer_for_analysis_)) {
+      std::ostringstream error_message;
+      error_message << "Failed to obtain autocorrelation";
+      sptk::PrintErrorMessage("lpc", error_message, log);
+      return false;
+    }
+
+    bool is_stable(false);
+    if (!levinson_durbin_recursion_.Run(autocorrelation_, output, &is_stable,
+                                        &buffer_for_levinson_)) {
+      std::ostringstream error_message;
+      error_message << "Failed to solve autocorrelation normal equations";
+      sptk::PrintErrorMessage("lpc", error_message, log);
+      return false;
+    }
+
+    if (!is_stable && kIgnore != warning_type_) {
+      std::ostringstream error_message;
+      error_message << frame_index << "th frame is unstable";
+      sptk::PrintErrorMessage("lpc", error_message, log);
+      if (kExit == warning_type_) return false;
+    }
+
+    return true;
+  }
+
+ private:
+  const InputFormats input_format_;
+  const WarningType warning_type_;
+  const sptk::SpectrumToSpectrum& spectrum_to_spectrum_;
+  const sptk::AutocorrelationAnalysis& autocorrelation_analysis_;
+  const sptk::LevinsonDurbinRecursion& levinson_durbin_recursion_;
+
+  std::vector<double> processed_input_;
+  std::vector<double> autocorrelation_;
+  sptk::AutocorrelationAnalysis::Buffer buffer_for_analysis_;
+  sptk::LevinsonDurbinRecursion::Buffer buffer_for_levinson_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameProcessor);
+};
+
 }  // namespace
 
 /**
@@ -98,6 +172,8 @@ void PrintUsage(std::ostream* stream) {
  *     \arg @c 2 amplitude spectrum
  *     \arg @c 3 power spectrum
  *     \arg @c 4 windowed waveform
+ * - @b -j @e int
+ *   - number of threads @f$(1 \le J)@f$
  * - @b infile @e str
  *   - double-type windowed data sequence
  * - @b stdout
@@ -115,6 +191,13 @@ void PrintUsage(std::ostream* stream) {
  *   frame < data.d | window | acorr -m 20 | levdur -m 20 > data.lpc
  * @endcode
  *
+ * The frames can be analyzed by @f$J@f$ threads without changing the output
+ * and the warnings.
+ *
+ * @code{.sh}
+ *   frame < data.d | window | lpc -m 20 --threads 4 > data.lpc
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -124,8 +207,16 @@ int main(int argc, char* argv[]) {
   int num_order(kDefaultNumOrder);
   WarningType warning_type(kDefaultWarningType);
   InputFormats input_format(kDefaultInputFormat);
+  int num_thread(kDefaultNumThread);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
+
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "l:m:e:q:h", NULL, NULL));
+    const int option_char(
+        getopt_long(argc, argv, "l:m:e:q:j:h", long_options, NULL));
     // // 带有冒号，: 表示参数m是可以指定值的，如 -m 100 或 -m user。
     if (-1 == option_char) break;
 
@@ -182,6 +273,17 @@ int main(int argc, char* argv[]) {
         input_format = static_cast<InputFormats>(tmp);
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("lpc", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -226,7 +328,6 @@ int main(int argc, char* argv[]) {
 
   sptk::AutocorrelationAnalysis autocorrelation_analysis(
       frame_length, num_order, kWaveform == input_format);
-  sptk::AutocorrelationAnalysis::Buffer buffer_for_analysis;
   if (!autocorrelation_analysis.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize AutocorrelationAnalysis";
@@ -235,7 +336,6 @@ int main(int argc, char* argv[]) {
   }
 
   sptk::LevinsonDurbinRecursion levinson_durbin_recursion(num_order);
-  sptk::LevinsonDurbinRecursion::Buffer buffer_for_levinson;
   if (!levinson_durbin_recursion.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize LevinsonDurbinRecursion";
@@ -245,63 +345,34 @@ int main(int argc, char* argv[]) {
 
   const int input_length(kWaveform == input_format ? frame_length
                                                    : frame_length / 2 + 1);
-  const int output_length(num_order + 1);
-
+  sptk::InputSourceFromStream input_source(false, input_length, &input_stream);
 
   // 我们这里是个vector，并且我们可以动态改变其长度，可以自由改变。可以自由插入，修改，但是耗费更多性能。这里我们定义了一个vector的double类型的模板，类型是 std::vector<double>。像是数组int a[3]其实是不能复制的
   // 但是vector可以，可以复制。而且数组的值的个数已经确定了，不能修改了。
   // 对数组赋值这里是 int a[3] = {1, 2, 3}; , 对vector赋值是 std::vector<int> x = {1, 2, 3}; 其实他们很像的。 vector是模拟数组的而且更容易用。
 
-  std::vector<double> input(input_length);
-  // 这里std::vector<double>初始化了一个叫input的容器，包含input_length个元素。
-
-  std::vector<double> autocorrelation(output_length);
-  std::vector<double> linear_predictive_coefficients(output_length);
-
-  for (int frame_index(0);
-       sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream, NULL);
-       ++frame_index) {
-    if (kWaveform != input_format) {
-      if (!spectrum_to_spectrum.Run(&input)) {
-        std::ostringstream error_message;
-        error_message << "Failed to convert spectrum";
-        sptk::PrintErrorMessage("lpc", error_message);
-        return 1;
-      }
-    }
-
-    if (!autocorrelation_analysis.Run(input, &autocorrelation,
-                                      &buffer_for_analysis)) {
-      std::ostringstream error_message;
-      error_message << "Failed to obtain autocorrelation";
-      sptk::PrintErrorMessage("lpc", error_message);
-      return 1;
-    }
-
-    bool is_stable(false);
-    if (!levinson_durbin_recursion.Run(autocorrelation,
-                                       &linear_predictive_coefficients,
-                                       &is_stable, &buffer_for_levinson)) {
-      std::ostringstream error_message;
-      error_message << "Failed to solve autocorrelation normal equations";
-      sptk::PrintErrorMessage("lpc", error_message);
-      return 1;
-    }
-
-    if (!is_stable && kIgnore != warning_type) {
-      std::ostringstream error_message;
-      error_message << frame_index << "th frame is unstable";
-      sptk::PrintErrorMessage("lpc", error_message);
-      if (kExit == warning_type) return 1;
-    }
+  std::vector<sptk::ParallelFrameExecutor::FrameProcessorInterface*>
+      frame_processors(num_thread);
+  for (int i(0); i < num_thread; ++i) {
+    frame_processors[i] =
+        new FrameProcessor(input_format, warning_type, spectrum_to_spectrum,
+                           autocorrelation_analysis, levinson_durbin_recursion);
+  }
+  sptk::ParallelFrameExecutor parallel_frame_executor(frame_processors);
 
-    if (!sptk::WriteStream(0, output_length, linear_predictive_coefficients,
-                           &std::cout, NULL)) {
+  bool is_processed;
+  const bool is_success(
+      parallel_frame_executor.Run(&input_source, &std::cout, &is_processed));
+  for (int i(0); i < num_thread; ++i) {
+    delete frame_processors[i];
+  }
+  if (!is_success) {
+    if (is_processed) {
       std::ostringstream error_message;
       error_message << "Failed to write linear predictive coefficients";
       sptk::PrintErrorMessage("lpc", error_message);
-      return 1;
     }
+    return 1;
   }
 
   return 0;
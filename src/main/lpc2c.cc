@@ -18,10 +18,10 @@
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/conversion/linear_predictive_coefficients_to_cepstrum.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -29,6 +29,9 @@ namespace {
 const int kDefaultNumInputOrder(25);
 const int kDefaultNumOutputOrder(25);
 
+// Number of frames converted at once.
+const int kBlockSize(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -149,14 +152,12 @@ int main(int argc, char* argv[]) {
   }
 
   const int input_length(num_input_order + 1);
-  const int output_length(num_output_order + 1);
-  std::vector<double> linear_predictive_coefficients(input_length);
-  std::vector<double> cepstrum(output_length);
+  sptk::Matrix linear_predictive_coefficients(kBlockSize, input_length);
+  sptk::Matrix cepstrum;
 
-  while (sptk::ReadStream(false, 0, 0, input_length,
-                          &linear_predictive_coefficients, &input_stream,
+  while (sptk::ReadStream(&linear_predictive_coefficients, &input_stream,
                           NULL)) {
-    if (!linear_predictive_coefficients_to_cepstrum.Run(
+    if (!linear_predictive_coefficients_to_cepstrum.RunBatch(
             linear_predictive_coefficients, &cepstrum)) {
       std::ostringstream error_message;
       error_message
@@ -165,7 +166,7 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    if (!sptk::WriteStream(0, output_length, cepstrum, &std::cout, NULL)) {
+    if (!sptk::WriteStream(cepstrum, &std::cout)) {
       std::ostringstream error_message;
       error_message << "Failed to write cepstrum";
       sptk::PrintErrorMessage("lpc2c", error_message);
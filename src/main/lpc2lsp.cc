@@ -14,7 +14,7 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <algorithm>  // std::transform
+#include <algorithm>  // std::copy, std::transform
 #include <cmath>      // std::log
 #include <fstream>    // std::ifstream
 #include <iomanip>    // std::setw
@@ -24,6 +24,7 @@
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/conversion/linear_predictive_coefficients_to_line_spectral_pairs.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -47,10 +48,17 @@ const int kDefaultNumOrder(25);
 const double kDefaultSamplingRate(10.0);
 const OutputGainType kDefaultOutputGainType(kLinearGain);
 const OutputFormats kDefaultOutputFormat(kFrequencyInRadians);
+const sptk::LinearPredictiveCoefficientsToLineSpectralPairs::Algorithms
+    kDefaultAlgorithm(
+        sptk::LinearPredictiveCoefficientsToLineSpectralPairs::kGridSearch);
 const int kDefaultNumSplit(256);
-const int kDefaultNumIteration(4);
+const int kDefaultNumIterationForGridSearch(4);
+const int kDefaultNumIterationForNewtonMethod(8);
 const double kDefaultConvergenceThreshold(1e-6);
 
+// Number of frames converted at once.
+const int kBlockSize(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -72,8 +80,12 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 3 (frequency [Hz])" << std::endl;
   *stream << "       -h    : print this message" << std::endl;
   *stream << "     (level 2)" << std::endl;
+  *stream << "       -a a  : root finding algorithm                  (   int)[" << std::setw(5) << std::right << kDefaultAlgorithm            << "][   0 <= a <= 1 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (grid search)" << std::endl;
+  *stream << "                 1 (Newton method)" << std::endl;
   *stream << "       -n n  : number of splits of unit circle         (   int)[" << std::setw(5) << std::right << kDefaultNumSplit             << "][   1 <= n <=   ]" << std::endl;  // NOLINT
-  *stream << "       -i i  : maximum number of iterations            (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][   1 <= i <=   ]" << std::endl;  // NOLINT
+  *stream << "       -i i  : maximum number of iterations per root   (   int)[" << std::setw(5) << std::right << "N/A"                        << "][   1 <= i <=   ]" << std::endl;  // NOLINT
+  *stream << "                 (default: " << kDefaultNumIterationForGridSearch << " for grid search, " << kDefaultNumIterationForNewtonMethod << " for Newton method)" << std::endl;  // NOLINT
   *stream << "       -d d  : convergence threshold                   (double)[" << std::setw(5) << std::right << kDefaultConvergenceThreshold << "][ 0.0 <= d <=   ]" << std::endl;  // NOLINT
   *stream << "  infile:" << std::endl;
   *stream << "       linear predictive coefficients                  (double)[stdin]" << std::endl;  // NOLINT
@@ -105,10 +117,15 @@ void PrintUsage(std::ostream* stream) {
  *     \arg @c 1 frequency in cyc
  *     \arg @c 2 frequency in kHz
  *     \arg @c 3 frequency in Hz
+ * - @b -a @e int
+ *   - root finding algorithm
+ *     \arg @c 0 grid search
+ *     \arg @c 1 Newton method
  * - @b -n @e int
  *   - number of splits of unit circle @f$(1 \le S)@f$
  * - @b -i @e int
- *   - maximum number of iterations @f$(1 \le N)@f$
+ *   - maximum number of iterations per root @f$(1 \le N)@f$; 4 for the grid
+ *     search and 8 for the Newton method if not given
  * - @b -d @e double
  *   - convergence threshold @f$(0 \le \epsilon)@f$
  * - @b infile @e str
@@ -122,6 +139,15 @@ void PrintUsage(std::ostream* stream) {
  *   frame < data.d | window | lpc -m 10 | lpc2lsp -m 10 > data.lsp
  * @endcode
  *
+ * The grid search may miss two roots closer than the grid spacing, which is
+ * determined by @c -n. The Newton method finds the roots one by one starting
+ * from the adjacent root, and is usually faster. If the iteration does not
+ * converge within @c -i steps, the root is found on the grid instead.
+ *
+ * @code{.sh}
+ *   frame < data.d | window | lpc -m 10 | lpc2lsp -m 10 -a 1 > data.lsp
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -131,13 +157,15 @@ int main(int argc, char* argv[]) {
   double sampling_rate(kDefaultSamplingRate);
   OutputGainType output_gain_type(kDefaultOutputGainType);
   OutputFormats output_format(kDefaultOutputFormat);
+  sptk::LinearPredictiveCoefficientsToLineSpectralPairs::Algorithms algorithm(
+      kDefaultAlgorithm);
   int num_split(kDefaultNumSplit);
-  int num_iteration(kDefaultNumIteration);
+  int num_iteration(0);
   double convergence_threshold(kDefaultConvergenceThreshold);
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "m:s:k:o:n:i:d:h", NULL, NULL));
+        getopt_long(argc, argv, "m:s:k:o:a:n:i:d:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -193,6 +221,25 @@ int main(int argc, char* argv[]) {
         output_format = static_cast<OutputFormats>(tmp);
         break;
       }
+      case 'a': {
+        const int min(0);
+        const int max(sptk::LinearPredictiveCoefficientsToLineSpectralPairs::
+                          kNumAlgorithms -
+                      1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -a option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("lpc2lsp", error_message);
+          return 1;
+        }
+        algorithm = static_cast<
+            sptk::LinearPredictiveCoefficientsToLineSpectralPairs::Algorithms>(
+            tmp);
+        break;
+      }
       case 'n': {
         if (!sptk::ConvertStringToInteger(optarg, &num_split) ||
             num_split <= 0) {
@@ -256,9 +303,18 @@ int main(int argc, char* argv[]) {
   }
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
+  if (0 == num_iteration) {
+    num_iteration =
+        (sptk::LinearPredictiveCoefficientsToLineSpectralPairs::kGridSearch ==
+         algorithm)
+            ? kDefaultNumIterationForGridSearch
+            : kDefaultNumIterationForNewtonMethod;
+  }
+
   sptk::LinearPredictiveCoefficientsToLineSpectralPairs
       linear_predictive_coefficients_to_line_spectral_pairs(
-          num_order, num_split, num_iteration, convergence_threshold);
+          num_order, num_split, num_iteration, convergence_threshold,
+          algorithm);
   sptk::LinearPredictiveCoefficientsToLineSpectralPairs::Buffer buffer;
   if (!linear_predictive_coefficients_to_line_spectral_pairs.IsValid()) {
     std::ostringstream error_message;
@@ -271,12 +327,12 @@ int main(int argc, char* argv[]) {
   const int length(num_order + 1);
   const int write_size(kWithoutGain == output_gain_type ? num_order : length);
   const int begin(kWithoutGain == output_gain_type ? 1 : 0);
-  std::vector<double> coefficients(length);
+  sptk::Matrix coefficients(kBlockSize, length);
+  std::vector<double> output(write_size);
 
-  while (sptk::ReadStream(false, 0, 0, length, &coefficients, &input_stream,
-                          NULL)) {
-    if (!linear_predictive_coefficients_to_line_spectral_pairs.Run(
-            &coefficients, &buffer)) {
+  while (sptk::ReadStream(&coefficients, &input_stream, NULL)) {
+    if (!linear_predictive_coefficients_to_line_spectral_pairs.RunBatch(
+            coefficients, &coefficients, &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to convert linear predictive coefficients to "
                        "line spectral pairs";
@@ -284,58 +340,62 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    switch (output_format) {
-      case kFrequencyInRadians: {
-        std::transform(coefficients.begin() + 1, coefficients.end(),
-                       coefficients.begin() + 1,
-                       [](double w) { return w * sptk::kTwoPi; });
-        break;
-      }
-      case kFrequencyInCycles: {
-        // nothing to do
-        break;
-      }
-      case kFrequecnyInkHz: {
-        std::transform(coefficients.begin() + 1, coefficients.end(),
-                       coefficients.begin() + 1,
-                       [sampling_rate](double w) { return w * sampling_rate; });
-        break;
-      }
-      case kFrequecnyInHz: {
-        std::transform(coefficients.begin() + 1, coefficients.end(),
-                       coefficients.begin() + 1, [sampling_rate](double w) {
-                         return w * 1000.0 * sampling_rate;
-                       });
-        break;
-      }
-      default: {
-        break;
+    const int num_frame(coefficients.GetNumRow());
+    for (int t(0); t < num_frame; ++t) {
+      double* lsp(coefficients[t]);
+      switch (output_format) {
+        case kFrequencyInRadians: {
+          std::transform(lsp + 1, lsp + length, lsp + 1,
+                         [](double w) { return w * sptk::kTwoPi; });
+          break;
+        }
+        case kFrequencyInCycles: {
+          // nothing to do
+          break;
+        }
+        case kFrequecnyInkHz: {
+          std::transform(
+              lsp + 1, lsp + length, lsp + 1,
+              [sampling_rate](double w) { return w * sampling_rate; });
+          break;
+        }
+        case kFrequecnyInHz: {
+          std::transform(lsp + 1, lsp + length, lsp + 1,
+                         [sampling_rate](double w) {
+                           return w * 1000.0 * sampling_rate;
+                         });
+          break;
+        }
+        default: {
+          break;
+        }
       }
-    }
 
-    switch (output_gain_type) {
-      case kLinearGain: {
-        // nothing to do
-        break;
-      }
-      case kLogGain: {
-        coefficients[0] = std::log(coefficients[0]);
-        break;
-      }
-      case kWithoutGain: {
-        // nothing to do
-        break;
-      }
-      default: {
-        break;
+      switch (output_gain_type) {
+        case kLinearGain: {
+          // nothing to do
+          break;
+        }
+        case kLogGain: {
+          lsp[0] = std::log(lsp[0]);
+          break;
+        }
+        case kWithoutGain: {
+          // nothing to do
+          break;
+        }
+        default: {
+          break;
+        }
       }
-    }
 
-    if (!sptk::WriteStream(begin, write_size, coefficients, &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write line spectral pairs";
-      sptk::PrintErrorMessage("lpc2lsp", error_message);
-      return 1;
+      std::copy(lsp + begin, lsp + length, output.begin());
+      if (!sptk::WriteStream(0, write_size, output, &std::cout, NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write line spectral pairs";
+        sptk::PrintErrorMessage("lpc2lsp", error_message);
+        return 1;
+      }
     }
   }
 
@@ -14,6 +14,7 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
+#include <cmath>     // std::isnan
 #include <fstream>   // std::ifstream
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
@@ -23,6 +24,7 @@
 #include "Getopt/getoptwin.h"
 #include "SPTK/filter/median_filter.h"
 #include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/input/input_source_interface.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -41,6 +43,47 @@ const int kDefaultNumInputOrder(0);
 const int kDefaultNumFilterOrder(2);
 const WaysToApplyFilter kDefaultWayToApplyFilter(kEachDimension);
 
+class InputSourceRejectingNan : public sptk::InputSourceInterface {
+ public:
+  explicit InputSourceRejectingNan(sptk::InputSourceInterface* source)
+      : source_(source), is_nan_found_(false) {
+  }
+
+  virtual ~InputSourceRejectingNan() {
+  }
+
+  virtual int GetSize() const {
+    return source_ ? source_->GetSize() : 0;
+  }
+
+  virtual bool IsValid() const {
+    return (NULL != source_ && source_->IsValid());
+  }
+
+  virtual bool Get(std::vector<double>* buffer) {
+    if (!IsValid() || is_nan_found_ || !source_->Get(buffer)) {
+      return false;
+    }
+    for (double x : *buffer) {
+      if (std::isnan(x)) {
+        is_nan_found_ = true;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool IsNanFound() const {
+    return is_nan_found_;
+  }
+
+ private:
+  sptk::InputSourceInterface* source_;
+  bool is_nan_found_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputSourceRejectingNan);
+};
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -204,7 +247,9 @@ int main(int argc, char* argv[]) {
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
   const int input_length(num_input_order + 1);
-  sptk::InputSourceFromStream input_source(false, input_length, &input_stream);
+  sptk::InputSourceFromStream input_source_from_stream(false, input_length,
+                                                      &input_stream);
+  InputSourceRejectingNan input_source(&input_source_from_stream);
   sptk::MedianFilter median_filter(num_input_order, num_filter_order,
                                    &input_source,
                                    kEachDimension == way_to_apply_filter,
@@ -228,5 +273,12 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  if (input_source.IsNanFound()) {
+    std::ostringstream error_message;
+    error_message << "Input must not contain NaN";
+    sptk::PrintErrorMessage("medfilt", error_message);
+    return 1;
+  }
+
   return 0;
 }
@@ -14,7 +14,8 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <algorithm>  // std::sort
+#include <algorithm>  // std::max_element, std::nth_element
+#include <cmath>      // std::isnan
 #include <fstream>    // std::ifstream
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
@@ -51,22 +52,17 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
-bool OutputMedian(const std::vector<std::vector<double> >& input_vectors) {
-  const int num_vector(static_cast<int>(input_vectors.size()));
-  const int half_num_vector(num_vector / 2);
-  const int vector_length(static_cast<int>(input_vectors[0].size()));
-
-  std::vector<double> vector_for_sort(num_vector);
-  for (int data_index(0); data_index < vector_length; ++data_index) {
-    for (int i(0); i < num_vector; ++i) {
-      vector_for_sort[i] = input_vectors[i][data_index];
+bool OutputMedian(std::vector<std::vector<double> >* data_of_each_dimension) {
+  for (std::vector<double>& data : *data_of_each_dimension) {
+    // Partially sort the data since only the middle values are needed.
+    const int half_num_data(static_cast<int>(data.size()) / 2);
+    std::nth_element(data.begin(), data.begin() + half_num_data, data.end());
+    double median(data[half_num_data]);
+    if (0 == data.size() % 2) {
+      median = (*std::max_element(data.begin(), data.begin() + half_num_data) +
+                median) *
+               0.5;
     }
-    std::sort(vector_for_sort.begin(), vector_for_sort.end());
-    const double median(0 == num_vector % 2
-                            ? (vector_for_sort[half_num_vector - 1] +
-                               vector_for_sort[half_num_vector]) *
-                                  0.5
-                            : vector_for_sort[half_num_vector]);
     if (!sptk::WriteStream(median, &std::cout)) {
       return false;
     }
@@ -206,30 +202,43 @@ int main(int argc, char* argv[]) {
   }
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
-  std::vector<std::vector<double> > input_vectors;
+  std::vector<std::vector<double> > data_of_each_dimension(vector_length);
   if (kMagicNumberForEndOfFile != output_interval) {
-    input_vectors.reserve(output_interval);
+    for (int i(0); i < vector_length; ++i) {
+      data_of_each_dimension[i].reserve(output_interval);
+    }
   }
 
   std::vector<double> data(vector_length);
   for (int index(1);
        sptk::ReadStream(false, 0, 0, vector_length, &data, &input_stream, NULL);
        ++index) {
-    input_vectors.push_back(data);
+    for (int i(0); i < vector_length; ++i) {
+      if (std::isnan(data[i])) {
+        std::ostringstream error_message;
+        error_message << "Input must not contain NaN";
+        sptk::PrintErrorMessage("median", error_message);
+        return 1;
+      }
+      data_of_each_dimension[i].push_back(data[i]);
+    }
     if (kMagicNumberForEndOfFile != output_interval &&
         0 == index % output_interval) {
-      if (!OutputMedian(input_vectors)) {
+      if (!OutputMedian(&data_of_each_dimension)) {
         std::ostringstream error_message;
         error_message << "Failed to write median";
         sptk::PrintErrorMessage("median", error_message);
         return 1;
       }
-      input_vectors.clear();
+      for (int i(0); i < vector_length; ++i) {
+        data_of_each_dimension[i].clear();
+      }
     }
   }
 
-  if (kMagicNumberForEndOfFile == output_interval && 0 < input_vectors.size()) {
-    if (!OutputMedian(input_vectors)) {
+  if (kMagicNumberForEndOfFile == output_interval &&
+      !data_of_each_dimension[0].empty()) {
+    if (!OutputMedian(&data_of_each_dimension)) {
       std::ostringstream error_message;
       error_message << "Failed to write median";
       sptk::PrintErrorMessage("median", error_message);
@@ -25,6 +25,8 @@
 #include "SPTK/analysis/mel_frequency_cepstral_coefficients_analysis.h"
 #include "SPTK/conversion/spectrum_to_spectrum.h"
 #include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/utils/parallel_frame_executor.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -55,6 +57,7 @@ const double kDefaultLowestFrequency(0.0);
 const InputFormats kDefaultInputFormat(kWaveform);
 const OutputFormats kDefaultOutputFormat(kMfcc);
 const double kDefaultFloor(1.0);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -83,6 +86,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 2 (mfcc and c0)" << std::endl;
   *stream << "                 3 (mfcc, c0, and energy)" << std::endl;
   *stream << "       -e e  : floor of raw filter-bank output (double)[" << std::setw(5) << std::right << kDefaultFloor                << "][ 0.0 <  e <=       ]" << std::endl;  // NOLINT
+  *stream << "       -j j  : number of threads               (   int)[" << std::setw(5) << std::right << kDefaultNumThread            << "][   1 <= j <=       ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       windowed data sequence or spectrum      (double)[stdin]" << std::endl;  // NOLINT
@@ -96,6 +100,80 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
+class FrameProcessor
+    : public sptk::ParallelFrameExecutor::FrameProcessorInterface {
+ public:
+  FrameProcessor(
+      InputFormats input_format, OutputFormats output_format,
+      const sptk::SpectrumToSpectrum& spectrum_to_spectrum,
+      const sptk::WaveformToSpectrum& waveform_to_spectrum,
+      const sptk::MelFrequencyCepstralCoefficientsAnalysis& analysis)
+      : input_format_(input_format),
+        output_format_(output_format),
+        spectrum_to_spectrum_(spectrum_to_spectrum),
+        waveform_to_spectrum_(waveform_to_spectrum),
+        analysis_(analysis) {
+  }
+
+  virtual bool Run(int, const std::vector<double>& input,
+                   std::vector<double>* output, std::ostream* log) {
+    if (kWaveform != input_format_) {
+      if (!spectrum_to_spectrum_.Run(input, &processed_input_)) {
+        std::ostringstream error_message;
+        error_message << "Failed to convert spectrum";
+        sptk::PrintErrorMessage("mfcc", error_message, log);
+        return false;
+      }
+    } else {
+      if (!waveform_to_spectrum_.Run(input, &processed_input_,
+                                     &buffer_for_spectral_analysis_)) {
+        std::ostringstream error_message;
+        error_message << "Failed to transform waveform to spectrum";
+        sptk::PrintErrorMessage("mfcc", error_message, log);
+        return false;
+      }
+    }
+
+    const bool is_energy_output(kMfccAndEnergy == output_format_ ||
+                                kMfccAndC0AndEnergy == output_format_);
+    double energy;
+    if (!analysis_.Run(processed_input_, &mfcc_,
+                       is_energy_output ? &energy : NULL,
+                       &buffer_for_mfcc_analysis_)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run mfcc analysis";
+      sptk::PrintErrorMessage("mfcc", error_message, log);
+      return false;
+    }
+
+    // Arrange the output in the order of MFCCs, C0, and energy.
+    output->assign(mfcc_.begin() + 1, mfcc_.end());
+    if (kMfccAndC0 == output_format_ || kMfccAndC0AndEnergy == output_format_) {
+      output->push_back(mfcc_[0]);
+    }
+    if (is_energy_output) {
+      output->push_back(energy);
+    }
+
+    return true;
+  }
+
+ private:
+  const InputFormats input_format_;
+  const OutputFormats output_format_;
+  const sptk::SpectrumToSpectrum& spectrum_to_spectrum_;
+  const sptk::WaveformToSpectrum& waveform_to_spectrum_;
+  const sptk::MelFrequencyCepstralCoefficientsAnalysis& analysis_;
+
+  std::vector<double> processed_input_;
+  std::vector<double> mfcc_;
+  sptk::WaveformToSpectrum::Buffer buffer_for_spectral_analysis_;
+  sptk::MelFrequencyCepstralCoefficientsAnalysis::Buffer
+      buffer_for_mfcc_analysis_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameProcessor);
+};
+
 }  // namespace
 
 /**
@@ -130,6 +208,8 @@ void PrintUsage(std::ostream* stream) {
  *     @arg @c 3 MFCC, C0, and energy
  * - @b -e @e double
  *   - floor value of raw filter-bank output @f$(0 < \epsilon)@f$
+ * - @b -j @e int
+ *   - number of threads @f$(1 \le J)@f$
  * - @b infile @e str
  *   - double-type windowed sequence or spectrum
  * - @b stdout
@@ -149,6 +229,9 @@ void PrintUsage(std::ostream* stream) {
  *     delta -m 12 -d -0.5 0.0 0.5 -d 0.25 0.0 -0.5 0.0 0.25 > data.mfcc
  * @endcode
  *
+ * The frames can be analyzed by @f$J@f$ threads with the option @c -j (or
+ * @c --threads) without changing the output.
+ *
  * The corresponding HTK config file is shown as below.
  *
  * @code
@@ -250,10 +333,16 @@ int main(int argc, char* argv[]) {
   InputFormats input_format(kDefaultInputFormat);
   OutputFormats output_format(kDefaultOutputFormat);
   double floor(kDefaultFloor);
+  int num_thread(kDefaultNumThread);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
 
   for (;;) {
-    const int option_char(
-        getopt_long(argc, argv, "n:m:l:c:s:L:H:q:o:e:h", NULL, NULL));
+    const int option_char(getopt_long(
+        argc, argv, "n:m:l:c:s:L:H:q:o:e:j:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -373,6 +462,17 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("mfcc", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -437,7 +537,6 @@ int main(int argc, char* argv[]) {
       fft_length, fft_length,
       sptk::SpectrumToSpectrum::InputOutputFormats::kPowerSpectrum, 0.0,
       -DBL_MAX);
-  sptk::WaveformToSpectrum::Buffer buffer_for_spectral_analysis;
   if (kWaveform == input_format && !waveform_to_spectrum.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to set condition for spectral analysis";
@@ -448,8 +547,6 @@ int main(int argc, char* argv[]) {
   sptk::MelFrequencyCepstralCoefficientsAnalysis analysis(
       fft_length, num_channel, num_order, liftering_coefficient,
       sampling_rate_in_hz, lowest_frequency, highest_frequency, floor);
-  sptk::MelFrequencyCepstralCoefficientsAnalysis::Buffer
-      buffer_for_mfcc_analysis;
   if (!analysis.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to set condition for MFCC analysis";
@@ -459,68 +556,30 @@ int main(int argc, char* argv[]) {
 
   const int input_length(kWaveform == input_format ? fft_length
                                                    : fft_length / 2 + 1);
-  const int output_length(num_order);
-  std::vector<double> input(input_length);
-  std::vector<double> processed_input(fft_length / 2 + 1);
-  std::vector<double> output(output_length);
-  double energy;
-
-  while (sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
-                          NULL)) {
-    if (kWaveform != input_format) {
-      if (!spectrum_to_spectrum.Run(input, &processed_input)) {
-        std::ostringstream error_message;
-        error_message << "Failed to convert spectrum";
-        sptk::PrintErrorMessage("mfcc", error_message);
-        return 1;
-      }
-    } else {
-      if (!waveform_to_spectrum.Run(input, &processed_input,
-                                    &buffer_for_spectral_analysis)) {
-        std::ostringstream error_message;
-        error_message << "Failed to transform waveform to spectrum";
-        sptk::PrintErrorMessage("mfcc", error_message);
-        return 1;
-      }
-    }
+  sptk::InputSourceFromStream input_source(false, input_length, &input_stream);
 
-    if (!analysis.Run(processed_input, &output,
-                      (kMfccAndEnergy == output_format ||
-                       kMfccAndC0AndEnergy == output_format)
-                          ? &energy
-                          : NULL,
-                      &buffer_for_mfcc_analysis)) {
-      std::ostringstream error_message;
-      error_message << "Failed to run mfcc analysis";
-      sptk::PrintErrorMessage("mfcc", error_message);
-      return 1;
-    }
+  std::vector<sptk::ParallelFrameExecutor::FrameProcessorInterface*>
+      frame_processors(num_thread);
+  for (int i(0); i < num_thread; ++i) {
+    frame_processors[i] =
+        new FrameProcessor(input_format, output_format, spectrum_to_spectrum,
+                           waveform_to_spectrum, analysis);
+  }
+  sptk::ParallelFrameExecutor parallel_frame_executor(frame_processors);
 
-    if (!sptk::WriteStream(1, output_length, output, &std::cout, NULL)) {
+  bool is_processed;
+  const bool is_success(
+      parallel_frame_executor.Run(&input_source, &std::cout, &is_processed));
+  for (int i(0); i < num_thread; ++i) {
+    delete frame_processors[i];
+  }
+  if (!is_success) {
+    if (is_processed) {
       std::ostringstream error_message;
-      error_message << "Failed to write filter-bank output";
+      error_message << "Failed to write MFCCs";
       sptk::PrintErrorMessage("mfcc", error_message);
-      return 1;
-    }
-
-    if (kMfccAndC0 == output_format || kMfccAndC0AndEnergy == output_format) {
-      if (!sptk::WriteStream(output[0], &std::cout)) {
-        std::ostringstream error_message;
-        error_message << "Failed to write c0";
-        sptk::PrintErrorMessage("mfcc", error_message);
-        return 1;
-      }
-    }
-
-    if (kMfccAndEnergy == output_format ||
-        kMfccAndC0AndEnergy == output_format) {
-      if (!sptk::WriteStream(energy, &std::cout)) {
-        std::ostringstream error_message;
-        error_message << "Failed to write energy";
-        sptk::PrintErrorMessage("mfcc", error_message);
-        return 1;
-      }
     }
+    return 1;
   }
 
   return 0;
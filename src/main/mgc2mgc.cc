@@ -18,10 +18,10 @@
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/conversion/mel_generalized_cepstrum_to_mel_generalized_cepstrum.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -37,6 +37,9 @@ const double kDefaultOutputGamma(1.0);
 const bool kDefaultOutputNormalizationFlag(false);
 const bool kDefaultOutputMultiplicationFlag(false);
 
+// Number of frames converted at once.
+const int kBlockSize(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -305,20 +308,23 @@ int main(int argc, char* argv[]) {
   }
 
   const int input_length(input_num_order + 1);
-  const int output_length(output_num_order + 1);
-  std::vector<double> mel_generalized_cepstrum(input_length);
-  std::vector<double> transformed_mel_generalized_cepstrum(output_length);
+  sptk::Matrix mel_generalized_cepstra(kBlockSize, input_length);
+  sptk::Matrix transformed_mel_generalized_cepstra;
+
+  while (sptk::ReadStream(&mel_generalized_cepstra, &input_stream, NULL)) {
+    const int num_frame(mel_generalized_cepstra.GetNumRow());
 
-  while (sptk::ReadStream(false, 0, 0, input_length, &mel_generalized_cepstrum,
-                          &input_stream, NULL)) {
     // Perform input modification: 1+g*mgc[0] -> mgc[0]
-    if (!input_normalization_flag && input_multiplication_flag)
-      (*mel_generalized_cepstrum.begin()) =
-          (*(mel_generalized_cepstrum.begin()) - 1.0) / input_gamma;
+    if (!input_normalization_flag && input_multiplication_flag) {
+      for (int t(0); t < num_frame; ++t) {
+        mel_generalized_cepstra[t][0] =
+            (mel_generalized_cepstra[t][0] - 1.0) / input_gamma;
+      }
+    }
 
     // Transform.
-    if (!mel_generalized_cepstrum_transform.Run(
-            mel_generalized_cepstrum, &transformed_mel_generalized_cepstrum,
+    if (!mel_generalized_cepstrum_transform.RunBatch(
+            mel_generalized_cepstra, &transformed_mel_generalized_cepstra,
             &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to run mel-generalized cepstral transformation";
@@ -327,14 +333,15 @@ int main(int argc, char* argv[]) {
     }
 
     // Perform output modification: mgc[0] -> 1+g*mgc[0]
-    if (!output_normalization_flag && output_multiplication_flag)
-      (*transformed_mel_generalized_cepstrum.begin()) =
-          *(transformed_mel_generalized_cepstrum.begin()) * output_gamma + 1.0;
+    if (!output_normalization_flag && output_multiplication_flag) {
+      for (int t(0); t < num_frame; ++t) {
+        transformed_mel_generalized_cepstra[t][0] =
+            transformed_mel_generalized_cepstra[t][0] * output_gamma + 1.0;
+      }
+    }
 
     // Write results.
-    if (!sptk::WriteStream(0, output_length,
-                           transformed_mel_generalized_cepstrum, &std::cout,
-                           NULL)) {
+    if (!sptk::WriteStream(transformed_mel_generalized_cepstra, &std::cout)) {
       std::ostringstream error_message;
       error_message << "Failed to write mel-generalized cepstrum";
       sptk::PrintErrorMessage("mgc2mgc", error_message);
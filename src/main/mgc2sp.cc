@@ -24,6 +24,8 @@
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/conversion/mel_generalized_cepstrum_to_spectrum.h"
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/utils/parallel_frame_executor.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -46,6 +48,7 @@ const bool kDefaultNormalizationFlag(false);
 const bool kDefaultMultiplicationFlag(false);
 const int kDefaultFftLength(256);
 const OutputFormats kDefaultOutputFormat(kLogAmplitudeSpectrumInDecibels);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -71,6 +74,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 4 (arg|H(z)|/pi)" << std::endl;
   *stream << "                 5 (arg|H(z)|)" << std::endl;
   *stream << "                 6 (arg|H(z)|*180/pi)" << std::endl;
+  *stream << "       -j j  : number of threads                          (   int)[" << std::setw(5) << std::right << kDefaultNumThread    << "][    1 <= j <=     ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       mel-generalized cepstrum                           (double)[stdin]" << std::endl;  // NOLINT
@@ -85,6 +89,117 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
+class FrameProcessor
+    : public sptk::ParallelFrameExecutor::FrameProcessorInterface {
+ public:
+  FrameProcessor(double gamma, bool normalization_flag,
+                 bool multiplication_flag, int fft_length,
+                 OutputFormats output_format,
+                 const sptk::MelGeneralizedCepstrumToSpectrum&
+                     mel_generalized_cepstrum_to_spectrum)
+      : gamma_(gamma),
+        normalization_flag_(normalization_flag),
+        multiplication_flag_(multiplication_flag),
+        output_length_(fft_length / 2 + 1),
+        output_format_(output_format),
+        mel_generalized_cepstrum_to_spectrum_(
+            mel_generalized_cepstrum_to_spectrum) {
+  }
+
+  virtual bool Run(int, const std::vector<double>& input,
+                   std::vector<double>* output, std::ostream* log) {
+    // Perform input modification.
+    mel_generalized_cepstrum_ = input;
+    if (!normalization_flag_ && multiplication_flag_) {
+      (*mel_generalized_cepstrum_.begin()) =
+          (*(mel_generalized_cepstrum_.begin()) - 1.0) / gamma_;
+    }
+
+    // Transform.
+    if (!mel_generalized_cepstrum_to_spectrum_.Run(
+            mel_generalized_cepstrum_, &amplitude_spectrum_, &phase_spectrum_,
+            &buffer_)) {
+      std::ostringstream error_message;
+      error_message
+          << "Failed to transform mel-generalized ceptrum to spectrum";
+      sptk::PrintErrorMessage("mgc2sp", error_message, log);
+      return false;
+    }
+
+    switch (output_format_) {
+      case kLogAmplitudeSpectrumInDecibels: {
+        output->resize(output_length_);
+        std::transform(amplitude_spectrum_.begin(),
+                       amplitude_spectrum_.begin() + output_length_,
+                       output->begin(),
+                       [](double x) { return x * sptk::kNeper; });
+        break;
+      }
+      case kLogAmplitudeSpectrum: {
+        output->assign(amplitude_spectrum_.begin(),
+                       amplitude_spectrum_.begin() + output_length_);
+        break;
+      }
+      case kAmplitudeSpectrum: {
+        output->resize(output_length_);
+        std::transform(amplitude_spectrum_.begin(),
+                       amplitude_spectrum_.begin() + output_length_,
+                       output->begin(), [](double x) { return std::exp(x); });
+        break;
+      }
+      case kPowerSpectrum: {
+        output->resize(output_length_);
+        std::transform(amplitude_spectrum_.begin(),
+                       amplitude_spectrum_.begin() + output_length_,
+                       output->begin(),
+                       [](double x) { return std::exp(2.0 * x); });
+        break;
+      }
+      case kPhaseSpectrumInCycles: {
+        output->resize(output_length_);
+        std::transform(
+            phase_spectrum_.begin(), phase_spectrum_.begin() + output_length_,
+            output->begin(), [](double x) { return x / sptk::kPi; });
+        break;
+      }
+      case kPhaseSpectrumInRadians: {
+        output->assign(phase_spectrum_.begin(),
+                       phase_spectrum_.begin() + output_length_);
+        break;
+      }
+      case kPhaseSpectrumInDegrees: {
+        output->resize(output_length_);
+        std::transform(phase_spectrum_.begin(),
+                       phase_spectrum_.begin() + output_length_,
+                       output->begin(),
+                       [](double x) { return x * 180.0 / sptk::kPi; });
+        break;
+      }
+      default: {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+ private:
+  const double gamma_;
+  const bool normalization_flag_;
+  const bool multiplication_flag_;
+  const int output_length_;
+  const OutputFormats output_format_;
+  const sptk::MelGeneralizedCepstrumToSpectrum&
+      mel_generalized_cepstrum_to_spectrum_;
+
+  std::vector<double> mel_generalized_cepstrum_;
+  std::vector<double> amplitude_spectrum_;
+  std::vector<double> phase_spectrum_;
+  sptk::MelGeneralizedCepstrumToSpectrum::Buffer buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameProcessor);
+};
+
 }  // namespace
 
 /**
@@ -113,6 +228,8 @@ void PrintUsage(std::ostream* stream) {
  *     \arg @c 4 @f$\arg|H(z)| / \pi@f$
  *     \arg @c 5 @f$\arg|H(z)|@f$
  *     \arg @c 6 @f$\arg|H(z)| \times 180/\pi@f$
+ * - @b -j @e int
+ *   - number of threads @f$(1 \le J)@f$
  * - @b infile @e str
  *   - double-type mel-generalized cepstral coefficients
  * - @b stdout
@@ -125,6 +242,9 @@ void PrintUsage(std::ostream* stream) {
  *   mgc2sp -m 12 -a 0.35 -c 2 < data.mgcep > data.spec
  * @endcode
  *
+ * The frames can be converted by @f$J@f$ threads with the option @c -j (or
+ * @c --threads) without changing the output.
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -137,10 +257,16 @@ int main(int argc, char* argv[]) {
   bool multiplication_flag(kDefaultMultiplicationFlag);
   int fft_length(kDefaultFftLength);
   OutputFormats output_format(kDefaultOutputFormat);
+  int num_thread(kDefaultNumThread);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "m:a:g:c:nul:o:h", NULL, NULL));
+        getopt_long(argc, argv, "m:a:g:c:nul:o:j:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -221,6 +347,17 @@ int main(int argc, char* argv[]) {
         output_format = static_cast<OutputFormats>(tmp);
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("mgc2sp", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -261,7 +398,6 @@ int main(int argc, char* argv[]) {
   sptk::MelGeneralizedCepstrumToSpectrum mel_generalized_cepstrum_to_spectrum(
       num_order, alpha, gamma, normalization_flag, multiplication_flag,
       fft_length);
-  sptk::MelGeneralizedCepstrumToSpectrum::Buffer buffer;
   if (!mel_generalized_cepstrum_to_spectrum.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize MelGeneralizedCepstrumToSpectrum";
@@ -270,108 +406,34 @@ int main(int argc, char* argv[]) {
   }
 
   const int input_length(num_order + 1);
-  const int output_length(fft_length / 2 + 1);
-  std::vector<double> mel_generalized_cepstrum(input_length);
-  std::vector<double> amplitude_spectrum(fft_length);
-  std::vector<double> phase_spectrum(fft_length);
+  sptk::InputSourceFromStream input_source(false, input_length, &input_stream);
 
-  while (sptk::ReadStream(false, 0, 0, input_length, &mel_generalized_cepstrum,
-                          &input_stream, NULL)) {
-    // Perform input modification.
-    if (!normalization_flag && multiplication_flag) {
-      (*mel_generalized_cepstrum.begin()) =
-          (*(mel_generalized_cepstrum.begin()) - 1.0) / gamma;
-    }
+  std::vector<sptk::ParallelFrameExecutor::FrameProcessorInterface*>
+      frame_processors(num_thread);
+  for (int i(0); i < num_thread; ++i) {
+    frame_processors[i] = new FrameProcessor(
+        gamma, normalization_flag, multiplication_flag, fft_length,
+        output_format, mel_generalized_cepstrum_to_spectrum);
+  }
+  sptk::ParallelFrameExecutor parallel_frame_executor(frame_processors);
 
-    // Transform.
-    if (!mel_generalized_cepstrum_to_spectrum.Run(mel_generalized_cepstrum,
-                                                  &amplitude_spectrum,
-                                                  &phase_spectrum, &buffer)) {
+  bool is_processed;
+  const bool is_success(
+      parallel_frame_executor.Run(&input_source, &std::cout, &is_processed));
+  for (int i(0); i < num_thread; ++i) {
+    delete frame_processors[i];
+  }
+  if (!is_success) {
+    if (is_processed) {
       std::ostringstream error_message;
-      error_message
-          << "Failed to transform mel-generalized ceptrum to spectrum";
-      sptk::PrintErrorMessage("mgc2sp", error_message);
-      return 1;
-    }
-
-    switch (output_format) {
-      case kLogAmplitudeSpectrumInDecibels: {
-        std::transform(amplitude_spectrum.begin(),
-                       amplitude_spectrum.begin() + output_length,
-                       amplitude_spectrum.begin(),
-                       [](double x) { return x * sptk::kNeper; });
-        break;
-      }
-      case kLogAmplitudeSpectrum: {
-        // nothing to do
-        break;
-      }
-      case kAmplitudeSpectrum: {
-        std::transform(amplitude_spectrum.begin(),
-                       amplitude_spectrum.begin() + output_length,
-                       amplitude_spectrum.begin(),
-                       [](double x) { return std::exp(x); });
-        break;
-      }
-      case kPowerSpectrum: {
-        std::transform(amplitude_spectrum.begin(),
-                       amplitude_spectrum.begin() + output_length,
-                       amplitude_spectrum.begin(),
-                       [](double x) { return std::exp(2.0 * x); });
-        break;
-      }
-      case kPhaseSpectrumInCycles: {
-        std::transform(
-            phase_spectrum.begin(), phase_spectrum.begin() + output_length,
-            phase_spectrum.begin(), [](double x) { return x / sptk::kPi; });
-        break;
-      }
-      case kPhaseSpectrumInRadians: {
-        // nothing to do
-        break;
-      }
-      case kPhaseSpectrumInDegrees: {
-        std::transform(phase_spectrum.begin(),
-                       phase_spectrum.begin() + output_length,
-                       phase_spectrum.begin(),
-                       [](double x) { return x * 180.0 / sptk::kPi; });
-        break;
-      }
-      default: {
-        break;
-      }
-    }
-
-    switch (output_format) {
-      case kLogAmplitudeSpectrumInDecibels:
-      case kLogAmplitudeSpectrum:
-      case kAmplitudeSpectrum:
-      case kPowerSpectrum: {
-        if (!sptk::WriteStream(0, output_length, amplitude_spectrum, &std::cout,
-                               NULL)) {
-          std::ostringstream error_message;
-          error_message << "Failed to write amplitude spectrum";
-          sptk::PrintErrorMessage("mgc2sp", error_message);
-          return 1;
-        }
-        break;
-      }
-      case kPhaseSpectrumInCycles:
-      case kPhaseSpectrumInRadians:
-      case kPhaseSpectrumInDegrees: {
-        if (!sptk::WriteStream(0, output_length, phase_spectrum, &std::cout,
-                               NULL)) {
-          std::ostringstream error_message;
-          error_message << "Failed to write phase spectrum";
-          sptk::PrintErrorMessage("mgc2sp", error_message);
-          return 1;
-        }
-        break;
-      }
-      default: {
-        break;
+      if (output_format < kPhaseSpectrumInCycles) {
+        error_message << "Failed to write amplitude spectrum";
+      } else {
+        error_message << "Failed to write phase spectrum";
       }
+      sptk::PrintErrorMessage("mgc2sp", error_message);
     }
+    return 1;
   }
 
   return 0;
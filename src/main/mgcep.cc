@@ -27,6 +27,8 @@
 #include "SPTK/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.h"
 #include "SPTK/conversion/spectrum_to_spectrum.h"
 #include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/utils/parallel_frame_executor.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -56,6 +58,8 @@ const InputFormats kDefaultInputFormat(kWaveform);
 const OutputFormats kDefaultOutputFormat(kCepstrum);
 const int kDefaultNumIteration(30);
 const double kDefaultConvergenceThreshold(1e-3);
+const bool kDefaultWarmStartFlag(false);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -84,8 +88,10 @@ void PrintUsage(std::ostream* stream) {
   *stream << "     (level 2)" << std::endl;
   *stream << "       -i i  : maximum number of iterations        (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][    0 <= i <=     ]" << std::endl;  // NOLINT
   *stream << "       -d d  : convergence threshold               (double)[" << std::setw(5) << std::right << kDefaultConvergenceThreshold << "][  0.0 <= d <=     ]" << std::endl;  // NOLINT
+  *stream << "       -w    : warm start from previous frame      (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultWarmStartFlag) << "]" << std::endl;  // NOLINT
   *stream << "       -e e  : small value added to power spectrum (double)[" << std::setw(5) << std::right << "N/A"                        << "][  0.0 <  e <=     ]" << std::endl;  // NOLINT
   *stream << "       -E E  : relative floor in decibels          (double)[" << std::setw(5) << std::right << "N/A"                        << "][      <= E <  0.0 ]" << std::endl;  // NOLINT
+  *stream << "       -j j  : number of threads                   (   int)[" << std::setw(5) << std::right << kDefaultNumThread            << "][    1 <= j <=     ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       windowed data sequence or spectrum          (double)[stdin]" << std::endl;  // NOLINT
@@ -95,12 +101,107 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       value of l must be a power of 2" << std::endl;
   *stream << "       if c = 0 or g = 0, standard mel-cepstral analyzer is used" << std::endl;  // NOLINT
   *stream << "       if c > 0 or g != 0, mel-generalized cepstral analyzer is used" << std::endl;  // NOLINT
+  *stream << "       -w cannot be used with j > 1" << std::endl;
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
   // clang-format on
 }
 
+class FrameProcessor
+    : public sptk::ParallelFrameExecutor::FrameProcessorInterface {
+ public:
+  FrameProcessor(
+      InputFormats input_format, OutputFormats output_format, double alpha,
+      const sptk::SpectrumToSpectrum& spectrum_to_spectrum,
+      const sptk::WaveformToSpectrum& waveform_to_spectrum,
+      const sptk::MelGeneralizedCepstralAnalysis& analysis,
+      const sptk::MelCepstrumToMlsaDigitalFilterCoefficients&
+          mel_cepstrum_to_mlsa_digital_filter_coefficients,
+      const sptk::GeneralizedCepstrumGainNormalization&
+          generalized_cepstrum_gain_normalization)
+      : input_format_(input_format),
+        output_format_(output_format),
+        alpha_(alpha),
+        spectrum_to_spectrum_(spectrum_to_spectrum),
+        waveform_to_spectrum_(waveform_to_spectrum),
+        analysis_(analysis),
+        mel_cepstrum_to_mlsa_digital_filter_coefficients_(
+            mel_cepstrum_to_mlsa_digital_filter_coefficients),
+        generalized_cepstrum_gain_normalization_(
+            generalized_cepstrum_gain_normalization) {
+  }
+
+  virtual bool Run(int, const std::vector<double>& input,
+                   std::vector<double>* output, std::ostream* log) {
+    if (kWaveform == input_format_) {
+      if (!waveform_to_spectrum_.Run(input, &processed_input_,
+                                     &buffer_for_spectral_analysis_)) {
+        std::ostringstream error_message;
+        error_message << "Failed to transform waveform to spectrum";
+        sptk::PrintErrorMessage("mgcep", error_message, log);
+        return false;
+      }
+    } else {
+      if (!spectrum_to_spectrum_.Run(input, &processed_input_)) {
+        std::ostringstream error_message;
+        error_message << "Failed to convert spectrum";
+        sptk::PrintErrorMessage("mgcep", error_message, log);
+        return false;
+      }
+    }
+
+    if (!analysis_.Run(processed_input_, output,
+                       &buffer_for_cepstral_analysis_)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run mel-generalized cepstral analysis";
+      sptk::PrintErrorMessage("mgcep", error_message, log);
+      return false;
+    }
+
+    if (0.0 != alpha_ &&
+        (kMlsaFilterCoefficients == output_format_ ||
+         kGainNormalizedMlsaFilterCoefficients == output_format_)) {
+      if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_.Run(output)) {
+        std::ostringstream error_message;
+        error_message << "Failed to convert to MLSA filter coefficients";
+        sptk::PrintErrorMessage("mgcep", error_message, log);
+        return false;
+      }
+    }
+
+    if (kGainNormalizedCepstrum == output_format_ ||
+        kGainNormalizedMlsaFilterCoefficients == output_format_) {
+      if (!generalized_cepstrum_gain_normalization_.Run(output)) {
+        std::ostringstream error_message;
+        error_message << "Failed to normalize generalized cepstrum";
+        sptk::PrintErrorMessage("mgcep", error_message, log);
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+ private:
+  const InputFormats input_format_;
+  const OutputFormats output_format_;
+  const double alpha_;
+  const sptk::SpectrumToSpectrum& spectrum_to_spectrum_;
+  const sptk::WaveformToSpectrum& waveform_to_spectrum_;
+  const sptk::MelGeneralizedCepstralAnalysis& analysis_;
+  const sptk::MelCepstrumToMlsaDigitalFilterCoefficients&
+      mel_cepstrum_to_mlsa_digital_filter_coefficients_;
+  const sptk::GeneralizedCepstrumGainNormalization&
+      generalized_cepstrum_gain_normalization_;
+
+  std::vector<double> processed_input_;
+  sptk::WaveformToSpectrum::Buffer buffer_for_spectral_analysis_;
+  sptk::MelGeneralizedCepstralAnalysis::Buffer buffer_for_cepstral_analysis_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameProcessor);
+};
+
 }  // namespace
 
 /**
@@ -133,10 +234,14 @@ void PrintUsage(std::ostream* stream) {
  *   - number of iterations @f$(0 \le J)@f$
  * - @b -d @e double
  *   - convergence threshold @f$(0 \le \epsilon)@f$
+ * - @b -w
+ *   - warm start from previous frame
  * - @b -e @e double
  *   - small value added to power spectrum
  * - @b -E @e double
  *   - relative floor in decibels
+ * - @b -j @e int
+ *   - number of threads @f$(1 \le T)@f$
  * - @b infile @e str
  *   - double-type windowed sequence or spectrum
  * - @b stdout
@@ -154,6 +259,21 @@ void PrintUsage(std::ostream* stream) {
  *   frame < data.d | window | fftr -o 3 -H | mgcep -q 3 > data.mcep
  * @endcode
  *
+ * The option @c -w corrects the initial guess of each frame by using the result
+ * of the previous frame. It reduces the number of iterations for continuous
+ * speech. If the iteration diverges, the frame is analyzed again from the
+ * original initial guess. The result is slightly different from that without
+ * the option because the iteration stops at a different point.
+ *
+ * The frames are analyzed independently, so that they can be distributed over
+ * @f$T@f$ threads by the option @c -j (or @c --threads). The output is the
+ * same as that of one thread. Since the option @c -w makes each frame depend
+ * on the previous one, it cannot be used with multiple threads.
+ *
+ * @code{.sh}
+ *   frame < data.d | window | mgcep --threads 4 > data.mcep
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -167,12 +287,19 @@ int main(int argc, char* argv[]) {
   OutputFormats output_format(kDefaultOutputFormat);
   int num_iteration(kDefaultNumIteration);
   double convergence_threshold(kDefaultConvergenceThreshold);
+  bool warm_start_flag(kDefaultWarmStartFlag);
   double epsilon(0.0);
   double relative_floor_in_decibels(-DBL_MAX);
+  int num_thread(kDefaultNumThread);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
 
   for (;;) {
-    const int option_char(
-        getopt_long(argc, argv, "m:a:g:c:l:q:o:i:d:e:E:h", NULL, NULL));
+    const int option_char(getopt_long(
+        argc, argv, "m:a:g:c:l:q:o:i:d:we:E:j:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -282,6 +409,10 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'w': {
+        warm_start_flag = true;
+        break;
+      }
       case 'e': {
         if (!sptk::ConvertStringToDouble(optarg, &epsilon) || epsilon <= 0.0) {
           std::ostringstream error_message;
@@ -303,6 +434,17 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("mgcep", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -314,6 +456,13 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  if (warm_start_flag && 1 < num_thread) {
+    std::ostringstream error_message;
+    error_message << "Warm start cannot be used with multiple threads";
+    sptk::PrintErrorMessage("mgcep", error_message);
+    return 1;
+  }
+
   const int num_input_files(argc - optind);
   if (1 < num_input_files) {
     std::ostringstream error_message;
@@ -349,7 +498,6 @@ int main(int argc, char* argv[]) {
       fft_length, fft_length,
       sptk::SpectrumToSpectrum::InputOutputFormats::kPowerSpectrum, epsilon,
       relative_floor_in_decibels);
-  sptk::WaveformToSpectrum::Buffer buffer_for_spectral_analysis;
   if (kWaveform == input_format && !waveform_to_spectrum.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to set condition for spectral analysis";
@@ -357,10 +505,9 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  sptk::MelGeneralizedCepstralAnalysis analysis(fft_length, num_order, alpha,
-                                                gamma, num_iteration,
-                                                convergence_threshold);
-  sptk::MelGeneralizedCepstralAnalysis::Buffer buffer_for_cepstral_analysis;
+  sptk::MelGeneralizedCepstralAnalysis analysis(
+      fft_length, num_order, alpha, gamma, num_iteration, convergence_threshold,
+      warm_start_flag);
   if (!analysis.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to set condition for cepstral analysis";
@@ -388,65 +535,32 @@ int main(int argc, char* argv[]) {
 
   const int input_length(kWaveform == input_format ? fft_length
                                                    : fft_length / 2 + 1);
-  const int output_length(num_order + 1);
-  std::vector<double> input(input_length);
-  std::vector<double> processed_input(fft_length / 2 + 1);
-  std::vector<double> output(output_length);
-
-  while (sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
-                          NULL)) {
-    if (kWaveform == input_format) {
-      if (!waveform_to_spectrum.Run(input, &processed_input,
-                                    &buffer_for_spectral_analysis)) {
-        std::ostringstream error_message;
-        error_message << "Failed to transform waveform to spectrum";
-        sptk::PrintErrorMessage("mgcep", error_message);
-        return 1;
-      }
-    } else {
-      if (!spectrum_to_spectrum.Run(input, &processed_input)) {
-        std::ostringstream error_message;
-        error_message << "Failed to convert spectrum";
-        sptk::PrintErrorMessage("mgcep", error_message);
-        return 1;
-      }
-    }
-
-    if (!analysis.Run(processed_input, &output,
-                      &buffer_for_cepstral_analysis)) {
-      std::ostringstream error_message;
-      error_message << "Failed to run mel-generalized cepstral analysis";
-      sptk::PrintErrorMessage("mgcep", error_message);
-      return 1;
-    }
-
-    if (0.0 != alpha &&
-        (kMlsaFilterCoefficients == output_format ||
-         kGainNormalizedMlsaFilterCoefficients == output_format)) {
-      if (!mel_cepstrum_to_mlsa_digital_filter_coefficients.Run(&output)) {
-        std::ostringstream error_message;
-        error_message << "Failed to convert to MLSA filter coefficients";
-        sptk::PrintErrorMessage("mgcep", error_message);
-        return 1;
-      }
-    }
+  sptk::InputSourceFromStream input_source(false, input_length, &input_stream);
 
-    if (kGainNormalizedCepstrum == output_format ||
-        kGainNormalizedMlsaFilterCoefficients == output_format) {
-      if (!generalized_cepstrum_gain_normalization.Run(&output)) {
-        std::ostringstream error_message;
-        error_message << "Failed to normalize generalized cepstrum";
-        sptk::PrintErrorMessage("mgcep", error_message);
-        return 1;
-      }
-    }
+  std::vector<sptk::ParallelFrameExecutor::FrameProcessorInterface*>
+      frame_processors(num_thread);
+  for (int i(0); i < num_thread; ++i) {
+    frame_processors[i] = new FrameProcessor(
+        input_format, output_format, alpha, spectrum_to_spectrum,
+        waveform_to_spectrum, analysis,
+        mel_cepstrum_to_mlsa_digital_filter_coefficients,
+        generalized_cepstrum_gain_normalization);
+  }
+  sptk::ParallelFrameExecutor parallel_frame_executor(frame_processors);
 
-    if (!sptk::WriteStream(0, output_length, output, &std::cout, NULL)) {
+  bool is_processed;
+  const bool is_success(
+      parallel_frame_executor.Run(&input_source, &std::cout, &is_processed));
+  for (int i(0); i < num_thread; ++i) {
+    delete frame_processors[i];
+  }
+  if (!is_success) {
+    if (is_processed) {
       std::ostringstream error_message;
       error_message << "Failed to write mel-generalized cepstrum";
       sptk::PrintErrorMessage("mgcep", error_message);
-      return 1;
     }
+    return 1;
   }
 
   return 0;
@@ -27,7 +27,6 @@
 #include "SPTK/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.h"
 #include "SPTK/filter/mglsa_digital_filter.h"
 #include "SPTK/input/input_source_from_stream.h"
-#include "SPTK/input/input_source_interpolation.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -363,9 +362,7 @@ int main(int argc, char* argv[]) {
   const double gamma((0 == num_stage) ? 0.0 : -1.0 / num_stage);
   InputSourcePreprocessingForMelCepstrum preprocessing(alpha, gamma, gain_flag,
                                                        &input_source);
-  sptk::InputSourceInterpolation interpolation(
-      frame_period, interpolation_period, true, &preprocessing);
-  if (!interpolation.IsValid()) {
+  if (!preprocessing.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize InputSource";
     sptk::PrintErrorMessage("mglsadf", error_message);
@@ -382,29 +379,52 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  double signal;
+  // Filter coefficients are interpolated inside the filter frame by frame.
+  // The final frame is used until the end of input signals.
+  std::vector<double> next_filter_coefficients(filter_length);
+  const bool has_filter_coefficients(
+      preprocessing.Get(&filter_coefficients));
+  if (has_filter_coefficients &&
+      !preprocessing.Get(&next_filter_coefficients)) {
+    next_filter_coefficients = filter_coefficients;
+  }
+
+  std::vector<double> signals(frame_period);
+  int actual_read_size;
 
-  while (sptk::ReadStream(&signal, &stream_for_filter_input)) {
-    if (!interpolation.Get(&filter_coefficients)) {
+  while (sptk::ReadStream(true, 0, 0, frame_period, &signals,
+                          &stream_for_filter_input, &actual_read_size)) {
+    if (!has_filter_coefficients) {
       std::ostringstream error_message;
       error_message << "Cannot get filter coefficients";
       sptk::PrintErrorMessage("mglsadf", error_message);
       return 1;
     }
 
-    if (!filter.Run(filter_coefficients, &signal, &buffer)) {
+    if (actual_read_size < frame_period) {
+      signals.resize(actual_read_size);
+    }
+
+    if (!filter.Run(filter_coefficients, next_filter_coefficients,
+                    frame_period, interpolation_period, signals, &signals,
+                    &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to apply MGLSA digital filter";
       sptk::PrintErrorMessage("mglsadf", error_message);
       return 1;
     }
 
-    if (!sptk::WriteStream(signal, &std::cout)) {
+    if (!sptk::WriteStream(0, actual_read_size, signals, &std::cout, NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write a filter output";
       sptk::PrintErrorMessage("mglsadf", error_message);
       return 1;
     }
+
+    filter_coefficients.swap(next_filter_coefficients);
+    if (!preprocessing.Get(&next_filter_coefficients)) {
+      next_filter_coefficients = filter_coefficients;
+    }
   }
 
   return 0;
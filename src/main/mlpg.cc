@@ -426,7 +426,7 @@ int main(int argc, char* argv[]) {
     }
 
     sptk::RecursiveMaximumLikelihoodParameterGeneration generation(
-        num_order, num_past_frame, window_coefficients, &preprocessed_source);
+        num_order, num_past_frame, window_coefficients);
     if (!generation.IsValid()) {
       std::ostringstream error_message;
       error_message << "Failed to initialize "
@@ -435,8 +435,29 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
+    // Write each frame as soon as it is generated.
+    std::vector<double> static_and_dynamic_parameters;
     std::vector<double> smoothed_static_parameters(static_size);
-    while (generation.Get(&smoothed_static_parameters)) {
+    while (preprocessed_source.Get(&static_and_dynamic_parameters)) {
+      bool is_output;
+      if (!generation.Push(static_and_dynamic_parameters,
+                           &smoothed_static_parameters, &is_output)) {
+        std::ostringstream error_message;
+        error_message << "Failed to perform MLPG";
+        sptk::PrintErrorMessage("mlpg", error_message);
+        return 1;
+      }
+      if (is_output &&
+          !sptk::WriteStream(0, static_size, smoothed_static_parameters,
+                             &std::cout, NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write static parameters";
+        sptk::PrintErrorMessage("mlpg", error_message);
+        return 1;
+      }
+    }
+
+    while (generation.Flush(&smoothed_static_parameters)) {
       if (!sptk::WriteStream(0, static_size, smoothed_static_parameters,
                              &std::cout, NULL)) {
         std::ostringstream error_message;
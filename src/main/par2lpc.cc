@@ -18,16 +18,19 @@
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/conversion/parcor_coefficients_to_linear_predictive_coefficients.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
 
 const int kDefaultNumOrder(25);
 
+// Number of frames converted at once.
+const int kBlockSize(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -137,12 +140,12 @@ int main(int argc, char* argv[]) {
   }
 
   const int length(num_order + 1);
-  std::vector<double> coefficients(length);
+  sptk::Matrix parcor_coefficients(kBlockSize, length);
+  sptk::Matrix linear_predictive_coefficients;
 
-  while (sptk::ReadStream(false, 0, 0, length, &coefficients, &input_stream,
-                          NULL)) {
-    if (!parcor_coefficients_to_linear_predictive_coefficients.Run(
-            &coefficients, &buffer)) {
+  while (sptk::ReadStream(&parcor_coefficients, &input_stream, NULL)) {
+    if (!parcor_coefficients_to_linear_predictive_coefficients.RunBatch(
+            parcor_coefficients, &linear_predictive_coefficients, &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to convert PARCOR coefficients to "
                     << "linear predictive coefficients";
@@ -150,7 +153,7 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    if (!sptk::WriteStream(0, length, coefficients, &std::cout, NULL)) {
+    if (!sptk::WriteStream(linear_predictive_coefficients, &std::cout)) {
       std::ostringstream error_message;
       error_message << "Failed to write linear predictive coefficients";
       sptk::PrintErrorMessage("par2lpc", error_message);
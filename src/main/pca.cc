@@ -18,7 +18,6 @@
 #include <fstream>    // std::ifstream, std::ofstream
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <numeric>    // std::accumulate
 #include <sstream>    // std::ostringstream
 #include <vector>     // std::vector
 
@@ -34,6 +33,8 @@ const int kDefaultNumIteration(10000);
 const double kDefaultConvergenceThreshold(1e-6);
 const sptk::PrincipalComponentAnalysis::CovarianceType kDefaultCovarianceType(
     sptk::PrincipalComponentAnalysis::CovarianceType::kSampleCovariance);
+const sptk::PrincipalComponentAnalysis::Algorithms kDefaultAlgorithm(
+    sptk::PrincipalComponentAnalysis::Algorithms::kJacobi);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -52,6 +53,10 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 0 (sample covariance)" << std::endl;
   *stream << "                 1 (unbiased covariance)" << std::endl;
   *stream << "                 2 (correlation)" << std::endl;
+  *stream << "       -a a  : algorithm                      (   int)[" << std::setw(5) << std::right << kDefaultAlgorithm             << "][   0 <= a <= 2 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (Jacobi)" << std::endl;
+  *stream << "                 1 (Householder + QL)" << std::endl;
+  *stream << "                 2 (Lanczos)" << std::endl;
   *stream << "       -v v  : output filename of double type (string)[" << std::setw(5) << std::right << "N/A"                         << "]" << std::endl;  // NOLINT
   *stream << "               eigenvalues and proportions" << std::endl;
   *stream << "       -h    : print this message" << std::endl;
@@ -59,6 +64,9 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       vector sequence                        (double)[stdin]" << std::endl;  // NOLINT
   *stream << "  stdout:" << std::endl;
   *stream << "       mean vector and eigenvectors           (double)" << std::endl;  // NOLINT
+  *stream << "  notice:" << std::endl;
+  *stream << "       -i is used only for Jacobi" << std::endl;
+  *stream << "       -d is used only for Jacobi and Lanczos" << std::endl;
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -85,6 +93,11 @@ void PrintUsage(std::ostream* stream) {
  *     @arg @c 0 sample covariance
  *     @arg @c 1 unbiased covariance
  *     @arg @c 2 correlation
+ * - @b -a @e int
+ *   - algorithm
+ *     @arg @c 0 Jacobi
+ *     @arg @c 1 Householder + QL
+ *     @arg @c 2 Lanczos
  * - @b -v @e str
  *   - double-type eigenvalues and proportions
  * - @b infile @e str
@@ -103,6 +116,12 @@ void PrintUsage(std::ostream* stream) {
  *
  * The eigenvalues are sorted in descending order.
  *
+ * The default Jacobi method gives the same signs of eigenvectors as SPTK3,
+ * but it is slow for high-dimensional vectors. The other methods choose the
+ * sign of each eigenvector so that its largest element is positive. The Lanczos method
+ * computes only the first @f$N@f$ eigenpairs, and is efficient when
+ * @f$N \ll L@f$.
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -114,11 +133,12 @@ int main(int argc, char* argv[]) {
   double convergence_threshold(kDefaultConvergenceThreshold);
   sptk::PrincipalComponentAnalysis::CovarianceType covariance_type(
       kDefaultCovarianceType);
+  sptk::PrincipalComponentAnalysis::Algorithms algorithm(kDefaultAlgorithm);
   const char* eigenvalues_file(NULL);
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "l:m:n:i:d:u:v:h", NULL, NULL));
+        getopt_long(argc, argv, "l:m:n:i:d:u:a:v:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -197,6 +217,25 @@ int main(int argc, char* argv[]) {
             static_cast<sptk::PrincipalComponentAnalysis::CovarianceType>(tmp);
         break;
       }
+      case 'a': {
+        const int min(0);
+        const int max(static_cast<int>(
+                          sptk::PrincipalComponentAnalysis::Algorithms::
+                              kNumAlgorithms) -
+                      1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -a option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("pca", error_message);
+          return 1;
+        }
+        algorithm =
+            static_cast<sptk::PrincipalComponentAnalysis::Algorithms>(tmp);
+        break;
+      }
       case 'v': {
         eigenvalues_file = optarg;
         break;
@@ -254,7 +293,8 @@ int main(int argc, char* argv[]) {
   std::ostream& output_stream(ofs);
 
   sptk::PrincipalComponentAnalysis principal_component_analysis(
-      vector_length - 1, num_iteration, convergence_threshold, covariance_type);
+      vector_length - 1, num_iteration, convergence_threshold, covariance_type,
+      algorithm, num_principal_component);
   sptk::PrincipalComponentAnalysis::Buffer buffer;
   if (!principal_component_analysis.IsValid()) {
     std::ostringstream error_message;
@@ -263,23 +303,29 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  // Read input data.
-  std::vector<std::vector<double> > input_vectors;
+  // Accumulate statistics of input data.
+  int num_input_vector(0);
   {
     std::vector<double> tmp(vector_length);
+    principal_component_analysis.Clear(&buffer);
     while (sptk::ReadStream(false, 0, 0, vector_length, &tmp, &input_stream,
                             NULL)) {
-      input_vectors.push_back(tmp);
+      if (!principal_component_analysis.Accumulate(tmp, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to accumulate statistics";
+        sptk::PrintErrorMessage("pca", error_message);
+        return 1;
+      }
+      ++num_input_vector;
     }
   }
-  if (input_vectors.empty()) return 0;
+  if (0 == num_input_vector) return 0;
 
   std::vector<double> mean_vector(vector_length);
   std::vector<double> eigenvalues(vector_length);
   sptk::Matrix eigenvector_matrix(vector_length, vector_length);
-  if (!principal_component_analysis.Run(input_vectors, &mean_vector,
-                                        &eigenvalues, &eigenvector_matrix,
-                                        &buffer)) {
+  if (!principal_component_analysis.Run(&mean_vector, &eigenvalues,
+                                        &eigenvector_matrix, &buffer)) {
     std::ostringstream error_message;
     error_message << "Failed to perform principal component analysis";
     sptk::PrintErrorMessage("pca", error_message);
@@ -317,8 +363,15 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    const double norm(
-        1.0 / std::accumulate(eigenvalues.begin(), eigenvalues.end(), 0.0));
+    double total_variance;
+    if (!principal_component_analysis.GetTotalVariance(buffer,
+                                                       &total_variance)) {
+      std::ostringstream error_message;
+      error_message << "Failed to get total variance";
+      sptk::PrintErrorMessage("pca", error_message);
+      return 1;
+    }
+    const double norm(1.0 / total_variance);
     std::vector<double> proportions(num_principal_component);
     std::transform(eigenvalues.begin(),
                    eigenvalues.begin() + num_principal_component,
@@ -17,7 +17,7 @@
 #include <algorithm>  // std::transform
 #include <cmath>      // std::log
 #include <fstream>    // std::ifstream
-#include <iomanip>    // std::setw
+#include <iomanip>    // std::fixed, std::setprecision, std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>    // std::ostringstream
 #include <vector>     // std::vector
@@ -25,6 +25,7 @@
 #include "Getopt/getoptwin.h"
 // if the header file not in the current folder, we need to add the path
 #include "SPTK/analysis/pitch_extraction.h"
+#include "SPTK/analysis/pitch_extraction_with_voting.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -51,6 +52,10 @@ const double kDefaultVoicingThresholdForSwipe(0.3);
 const double kDefaultVoicingThresholdForReaper(0.9);
 const double kDefaultVoicingThresholdForWorld(0.1);
 const OutputFormats kDefaultOutputFormat(kPitch);
+const int kDefaultNumThread(1);
+const bool kDefaultTimingFlag(false);
+const int kChunkSize(16384);
+const char* kAlgorithmNames[] = {"RAPT", "SWIPE'", "REAPER", "WORLD"};
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -80,6 +85,11 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -t1 t : voicing threshold for SWIPE'  (double)[" << std::setw(5) << std::right << kDefaultVoicingThresholdForSwipe  << "][  0.2 <= t <= 0.5   ]" << std::endl;  // NOLINT
   *stream << "       -t2 t : voicing threshold for REAPER  (double)[" << std::setw(5) << std::right << kDefaultVoicingThresholdForReaper << "][ -0.5 <= t <= 1.6   ]" << std::endl;  // NOLINT
   *stream << "       -t3 t : voicing threshold for WORLD   (double)[" << std::setw(5) << std::right << kDefaultVoicingThresholdForWorld  << "][ 0.02 <= t <= 0.2   ]" << std::endl;  // NOLINT
+  *stream << "       -v v  : order of median filter to     (   int)[" << std::setw(5) << std::right << "N/A"                             << "][    0 <= v <=       ]" << std::endl;  // NOLINT
+  *stream << "               fuse results of all algorithms" << std::endl;
+  *stream << "       -j j  : number of threads for voting  (   int)[" << std::setw(5) << std::right << kDefaultNumThread                 << "][    1 <= j <=       ]" << std::endl;  // NOLINT
+  *stream << "       -T    : print elapsed time of each    (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultTimingFlag) << "]" << std::endl;  // NOLINT
+  *stream << "               algorithm in voting to stderr" << std::endl;
   *stream << "       -o o  : output format                 (   int)[" << std::setw(5) << std::right << kDefaultOutputFormat              << "][    0 <= o <= 2     ]" << std::endl;  // NOLINT
   *stream << "                 0 (1/F0)" << std::endl;
   *stream << "                 1 (F0)" << std::endl;
@@ -93,12 +103,45 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       if t is raised, the number of voiced frames increase in RAPT, REAPER, and WORLD" << std::endl;  // NOLINT
   *stream << "       if t is dropped, the number of voiced frames increase in SWIPE'" << std::endl;  // NOLINT
   *stream << "       the value of t should be in the recommended range but values outside the range can be given" << std::endl;  // NOLINT
+  *stream << "       only RAPT processes the input chunk by chunk; the other algorithms read the whole input first" << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
   // clang-format on
 }
 
+bool WritePitch(OutputFormats output_format, double sampling_rate_in_hz,
+                std::vector<double>* f0) {
+  switch (output_format) {
+    case kPitch: {
+      // 这里的begin指的是第一个元素，这个f0 vector的第一个元素。
+      std::transform(f0->begin(), f0->end(), f0->begin(),
+                     [sampling_rate_in_hz](double x) {
+                       return (0.0 < x) ? sampling_rate_in_hz / x : 0.0;
+                     });
+      break;
+    }
+    case kF0: {
+      // nothing to do
+      break;
+    }
+    case kLogF0: {
+      // 这里的end指的是最后一个元素.
+      std::transform(f0->begin(), f0->end(), f0->begin(), [](double x) {
+        return (0.0 < x) ? std::log(x) : sptk::kLogZero;
+      });
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+
+  const int f0_length(static_cast<int>(f0->size()));
+  return (0 == f0_length ||
+          sptk::WriteStream(0, f0_length, *f0, &std::cout, NULL));
+}
+
 }  // namespace
 
 /**
@@ -110,6 +153,13 @@ void PrintUsage(std::ostream* stream) {
  *     @arg @c 1 SWIPE'
  *     @arg @c 2 REAPER
  *     @arg @c 3 WORLD (DIO)
+ * - @b -v @e int
+ *   - order of median filter to fuse the results of all algorithms
+ *     @f$(0 \le N)@f$
+ * - @b -j @e int
+ *   - number of threads for voting @f$(1 \le J)@f$
+ * - @b -T
+ *   - print elapsed time of each algorithm in voting to stderr
  * - @b -p @e int
  *   - frame shift [point] @f$(1 \le P)@f$
  * - @b -s @e double
@@ -138,6 +188,33 @@ void PrintUsage(std::ostream* stream) {
  *
  * If @f$T@f$ is raised, the number of voiced frames increase except SWIPE'.
  *
+ * RAPT processes the input waveform chunk by chunk, so that the pitch is
+ * written before the end of the input and the memory usage does not grow with
+ * the length of the input. The other algorithms read the whole waveform first.
+ *
+ * If @c -v is given, all the algorithms are run on the same waveform by
+ * @f$J@f$ threads, and their log F0s are fused by the median filter of order
+ * @f$N@f$ across the algorithms. If @f$N=0@f$, a frame is voiced if at least
+ * half of the algorithms regard it as voiced, and the F0 of a voiced frame is
+ * the median of the voiced estimates. The option @c -a is ignored in this
+ * case.
+ *
+ * @code{.sh}
+ *   x2x +sd data.short | pitch -s 16 -p 80 -o 2 -v 2 -j 4 > data.lf0
+ * @endcode
+ *
+ * This is equivalent to the below lines.
+ *
+ * @code{.sh}
+ *   for a in $(seq 0 3); do
+ *     x2x +sd data.short | pitch -s 16 -p 80 -o 2 -a $a > data.lf0.$a
+ *   done
+ *   merge -l 1 -L 1 data.lf0.1 < data.lf0.0 |
+ *     merge -l 2 -L 1 data.lf0.2 |
+ *     merge -l 3 -L 1 data.lf0.3 |
+ *     medfilt -l 4 -k 2 -magic -1e+10 -w 1 > data.lf0
+ * @endcode
+ *
  * The below is a simple example to extract pitch from @c data.d
  *
  * @code{.sh}
@@ -160,6 +237,10 @@ int main(int argc, char* argv[]) {
       kDefaultVoicingThresholdForReaper,
       kDefaultVoicingThresholdForWorld,
   };
+  bool is_voting_enabled(false);
+  int num_filter_order(0);
+  int num_thread(kDefaultNumThread);
+  bool timing_flag(kDefaultTimingFlag);
   OutputFormats output_format(kDefaultOutputFormat);
 
 
@@ -171,12 +252,13 @@ int main(int argc, char* argv[]) {
       {"t1", required_argument, NULL, kT1},
       {"t2", required_argument, NULL, kT2},
       {"t3", required_argument, NULL, kT3},
+      {"threads", required_argument, NULL, 'j'},
       {0, 0, 0, 0},
   };
 
   for (;;) {
     const int option_char(
-        getopt_long_only(argc, argv, "a:p:s:L:H:o:h", long_options, NULL));
+        getopt_long_only(argc, argv, "a:p:s:L:H:v:j:To:h", long_options, NULL));
     if (-1 == option_char) break;
     // switch(条件)语句 , switch实现分支语句最核心的是case,我们可以通过case语句来实现,以及default标签.
     switch (option_char) {
@@ -290,6 +372,33 @@ int main(int argc, char* argv[]) {
         voicing_thresholds[sptk::PitchExtraction::Algorithms::kWorld] = tmp;
         break;
       }
+      case 'v': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_filter_order) ||
+            num_filter_order < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -v option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("pitch", error_message);
+          return 1;
+        }
+        is_voting_enabled = true;
+        break;
+      }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("pitch", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'T': {
+        timing_flag = true;
+        break;
+      }
       case 'o': {
         const int min(0);
         const int max(static_cast<int>(kNumOutputFormats) - 1);
@@ -351,6 +460,61 @@ int main(int argc, char* argv[]) {
     return 1;
   }
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  // Extract pitch by all algorithms and vote.
+  if (is_voting_enabled) {
+    const int num_algorithm(
+        static_cast<int>(sptk::PitchExtraction::Algorithms::kNumAlgorithms));
+    std::vector<sptk::PitchExtraction::Algorithms> algorithms(num_algorithm);
+    for (int i(0); i < num_algorithm; ++i) {
+      algorithms[i] = static_cast<sptk::PitchExtraction::Algorithms>(i);
+    }
+    sptk::PitchExtractionWithVoting pitch_extraction(
+        frame_shift, sampling_rate_in_hz, lower_f0, upper_f0,
+        voicing_thresholds, algorithms, num_filter_order, num_thread);
+    if (!pitch_extraction.IsValid()) {
+      std::ostringstream error_message;
+      error_message << "Failed to initialize PitchExtractionWithVoting";
+      sptk::PrintErrorMessage("pitch", error_message);
+      return 1;
+    }
+
+    std::vector<double> waveform;
+    {
+      double tmp;
+      while (sptk::ReadStream(&tmp, &input_stream)) {
+        waveform.push_back(tmp);
+      }
+    }
+    if (waveform.empty()) return 0;
+
+    std::vector<double> f0;
+    std::vector<double> elapsed_times;
+    if (!pitch_extraction.Run(waveform, &f0, &elapsed_times)) {
+      std::ostringstream error_message;
+      error_message << "Failed to extract pitch";
+      sptk::PrintErrorMessage("pitch", error_message);
+      return 1;
+    }
+
+    if (timing_flag) {
+      for (int i(0); i < num_algorithm; ++i) {
+        std::cerr << "pitch: " << std::setw(6) << std::left
+                  << kAlgorithmNames[algorithms[i]] << " " << std::fixed
+                  << std::setprecision(3) << elapsed_times[i] << " [sec]"
+                  << std::endl;
+      }
+    }
+
+    if (!WritePitch(output_format, sampling_rate_in_hz, &f0)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write pitch";
+      sptk::PrintErrorMessage("pitch", error_message);
+      return 1;
+    }
+    return 0;
+  }
+
   // call constructor with arguments
   sptk::PitchExtraction pitch_extraction(
       frame_shift, sampling_rate_in_hz, lower_f0, upper_f0,
@@ -362,6 +526,39 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  // Extract pitch chunk by chunk if possible.
+  if (pitch_extraction.IsStreamable()) {
+    sptk::PitchExtraction::Buffer buffer;
+    std::vector<double> waveform;
+    std::vector<double> f0;
+    bool is_first_chunk(true);
+    for (bool is_last_chunk(false); !is_last_chunk; is_first_chunk = false) {
+      int actual_read_size(0);
+      if (!sptk::ReadStream(true, 0, 0, kChunkSize, &waveform, &input_stream,
+                            &actual_read_size)) {
+        actual_read_size = 0;
+      }
+      waveform.resize(actual_read_size);
+      is_last_chunk = (actual_read_size < kChunkSize);
+      if (is_first_chunk && 0 == actual_read_size) return 0;
+
+      if (!pitch_extraction.Run(waveform, is_last_chunk, &f0, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to extract pitch";
+        sptk::PrintErrorMessage("pitch", error_message);
+        return 1;
+      }
+
+      if (!WritePitch(output_format, sampling_rate_in_hz, &f0)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write pitch";
+        sptk::PrintErrorMessage("pitch", error_message);
+        return 1;
+      }
+    }
+    return 0;
+  }
+
   std::vector<double> waveform;
   {
     double tmp;
@@ -380,33 +577,7 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  switch (output_format) {
-    case kPitch: {
-      // 这里的begin指的是第一个元素，这个f0 vector的第一个元素。
-      std::transform(f0.begin(), f0.end(), f0.begin(),
-                     [sampling_rate_in_hz](double x) {
-                       return (0.0 < x) ? sampling_rate_in_hz / x : 0.0;
-                     });
-      break;
-    }
-    case kF0: {
-      // nothing to do
-      break;
-    }
-    case kLogF0: {
-      // 这里的end指的是最后一个元素.
-      std::transform(f0.begin(), f0.end(), f0.begin(), [](double x) {
-        return (0.0 < x) ? std::log(x) : sptk::kLogZero;
-      });
-      break;
-    }
-    default: {
-      break;
-    }
-  }
-
-  const int f0_length(static_cast<int>(f0.size()));
-  if (!sptk::WriteStream(0, f0_length, f0, &std::cout, NULL)) {
+  if (!WritePitch(output_format, sampling_rate_in_hz, &f0)) {
     std::ostringstream error_message;
     error_message << "Failed to write pitch";
     sptk::PrintErrorMessage("pitch", error_message);
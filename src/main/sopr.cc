@@ -20,6 +20,8 @@
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/math/scalar_operation.h"
+#include "SPTK/utils/buffered_input_stream.h"
+#include "SPTK/utils/buffered_output_stream.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -55,6 +57,8 @@ enum LongOptions {
   kMAGIC,
 };
 
+const int kBlockSize(4096);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -708,23 +712,47 @@ int main(int argc, char* argv[]) {
   }
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
-  double number;
-  bool is_magic_number;
+  sptk::BufferedInputStream buffered_input_stream(&input_stream);
+  sptk::BufferedOutputStream buffered_output_stream(&std::cout);
+  double numbers[kBlockSize];
+  bool is_magic_numbers[kBlockSize];
+
+  for (;;) {
+    const int length(buffered_input_stream.Read(kBlockSize, numbers));
+    if (0 == length) break;
 
-  while (sptk::ReadStream(&number, &input_stream)) {
-    if (!scalar_operation.Run(&number, &is_magic_number)) {
+    if (!scalar_operation.Run(length, numbers, is_magic_numbers)) {
       std::ostringstream error_message;
       error_message << "Failed to perform scalar operation";
       sptk::PrintErrorMessage("sopr", error_message);
       return 1;
     }
-    if (!is_magic_number && !sptk::WriteStream(number, &std::cout)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write data";
-      sptk::PrintErrorMessage("sopr", error_message);
-      return 1;
+
+    // Write consecutive numbers at once while skipping magic numbers.
+    int begin(0);
+    while (begin < length) {
+      if (is_magic_numbers[begin]) {
+        ++begin;
+        continue;
+      }
+      int end(begin + 1);
+      while (end < length && !is_magic_numbers[end]) ++end;
+      if (!buffered_output_stream.Write(end - begin, numbers + begin)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write data";
+        sptk::PrintErrorMessage("sopr", error_message);
+        return 1;
+      }
+      begin = end;
     }
   }
 
+  if (!buffered_output_stream.Flush()) {
+    std::ostringstream error_message;
+    error_message << "Failed to write data";
+    sptk::PrintErrorMessage("sopr", error_message);
+    return 1;
+  }
+
   return 0;
 }
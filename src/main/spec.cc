@@ -25,6 +25,8 @@
 #include "SPTK/conversion/filter_coefficients_to_spectrum.h"
 #include "SPTK/conversion/spectrum_to_spectrum.h"
 #include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/utils/parallel_frame_executor.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -34,6 +36,7 @@ const int kDefaultNumNumeratorOrder(0);
 const int kDefaultNumDenominatorOrder(0);
 const sptk::SpectrumToSpectrum::InputOutputFormats kDefaultOutputFormat(
     sptk::SpectrumToSpectrum::kLogAmplitudeSpectrumInDecibels);
+const int kDefaultNumThread(1);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -57,6 +60,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 1 (ln|H(z)|)" << std::endl;
   *stream << "                 2 (|H(z)|)" << std::endl;
   *stream << "                 3 (|H(z)|^2)" << std::endl;
+  *stream << "       -j j  : number of threads                   (   int)[" << std::setw(5) << std::right << kDefaultNumThread           << "][   1 <= j <=     ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       data sequence                               (double)[stdin]" << std::endl;  // NOLINT
@@ -64,12 +68,39 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       spectrum                                    (double)" << std::endl;  // NOLINT
   *stream << "  notice:" << std::endl;
   *stream << "       value of l must be a power of 2" << std::endl;
+  *stream << "       -j is ignored if -z or -p is specified" << std::endl;
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
   // clang-format on
 }
 
+class FrameProcessor
+    : public sptk::ParallelFrameExecutor::FrameProcessorInterface {
+ public:
+  explicit FrameProcessor(const sptk::WaveformToSpectrum& waveform_to_spectrum)
+      : waveform_to_spectrum_(waveform_to_spectrum) {
+  }
+
+  virtual bool Run(int, const std::vector<double>& input,
+                   std::vector<double>* output, std::ostream* log) {
+    if (!waveform_to_spectrum_.Run(input, output, &buffer_)) {
+      std::ostringstream error_message;
+      error_message << "Failed to transform waveform to spectrum";
+      sptk::PrintErrorMessage("spec", error_message, log);
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  const sptk::WaveformToSpectrum& waveform_to_spectrum_;
+
+  sptk::WaveformToSpectrum::Buffer buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameProcessor);
+};
+
 }  // namespace
 
 /**
@@ -95,6 +126,8 @@ void PrintUsage(std::ostream* stream) {
  *     \arg @c 1 log amplitude spectrum
  *     \arg @c 2 amplitude spectrum
  *     \arg @c 3 power spectrum
+ * - @b -j @e int
+ *   - number of threads @f$(1 \le J)@f$
  * - @b infile @e str
  *   - double-type data sequence
  * - @b stdout
@@ -113,6 +146,10 @@ void PrintUsage(std::ostream* stream) {
  *   spec -E -30 data.d2 > data.sp
  * @endcode
  *
+ * The frames of data sequence can be transformed by @f$J@f$ threads with the
+ * option @c -j (or @c --threads) without changing the output. The option is
+ * ignored when filter coefficients are given by @c -z or @c -p.
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -129,10 +166,16 @@ int main(int argc, char* argv[]) {
   double relative_floor_in_decibels(-DBL_MAX);
   sptk::SpectrumToSpectrum::InputOutputFormats output_format(
       kDefaultOutputFormat);
+  int num_thread(kDefaultNumThread);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "l:m:n:z:p:e:E:o:h", NULL, NULL));
+        getopt_long(argc, argv, "l:m:n:z:p:e:E:o:j:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -218,6 +261,17 @@ int main(int argc, char* argv[]) {
             static_cast<sptk::SpectrumToSpectrum::InputOutputFormats>(tmp);
         break;
       }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("spec", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -349,7 +403,6 @@ int main(int argc, char* argv[]) {
     sptk::WaveformToSpectrum waveform_to_spectrum(fft_length, fft_length,
                                                   output_format, epsilon,
                                                   relative_floor_in_decibels);
-    sptk::WaveformToSpectrum::Buffer buffer;
     if (!waveform_to_spectrum.IsValid()) {
       std::ostringstream error_message;
       error_message << "Failed to set condition for transformation";
@@ -357,24 +410,28 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    const int output_length(fft_length / 2 + 1);
-    std::vector<double> waveform(fft_length);
-    std::vector<double> output(output_length);
-    while (sptk::ReadStream(true, 0, 0, fft_length, &waveform, &input_stream,
-                            NULL)) {
-      if (!waveform_to_spectrum.Run(waveform, &output, &buffer)) {
-        std::ostringstream error_message;
-        error_message << "Failed to transform waveform to spectrum";
-        sptk::PrintErrorMessage("spec", error_message);
-        return 1;
-      }
+    sptk::InputSourceFromStream input_source(true, fft_length, &input_stream);
 
-      if (!sptk::WriteStream(0, output_length, output, &std::cout, NULL)) {
+    std::vector<sptk::ParallelFrameExecutor::FrameProcessorInterface*>
+        frame_processors(num_thread);
+    for (int i(0); i < num_thread; ++i) {
+      frame_processors[i] = new FrameProcessor(waveform_to_spectrum);
+    }
+    sptk::ParallelFrameExecutor parallel_frame_executor(frame_processors);
+
+    bool is_processed;
+    const bool is_success(
+        parallel_frame_executor.Run(&input_source, &std::cout, &is_processed));
+    for (int i(0); i < num_thread; ++i) {
+      delete frame_processors[i];
+    }
+    if (!is_success) {
+      if (is_processed) {
         std::ostringstream error_message;
         error_message << "Failed to write spectrum";
         sptk::PrintErrorMessage("spec", error_message);
-        return 1;
       }
+      return 1;
     }
   }
 
@@ -0,0 +1,547 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <cfloat>    // DBL_MAX
+#include <fstream>   // std::ifstream
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>   // std::ostringstream
+#include <vector>    // std::vector
+
+#include "Getopt/getoptwin.h"
+#include "SPTK/conversion/waveform_to_mel_generalized_cepstrum.h"
+#include "SPTK/input/input_source_framing.h"
+#include "SPTK/utils/parallel_frame_executor.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/standard_window.h"
+
+namespace {
+
+const int kDefaultFrameLength(256);
+const int kDefaultFramePeriod(100);
+const sptk::InputSourceFraming::FramingTypes kDefaultFramingType(
+    sptk::InputSourceFraming::kBeginningOfDataIsCenterOfFirstFrame);
+const sptk::DataWindowing::NormalizationType kDefaultNormalizationType(
+    sptk::DataWindowing::NormalizationType::kPower);
+const int kDefaultWindowTypeIndex(0);
+const int kDefaultNumOrder(25);
+const double kDefaultAlpha(0.35);
+const double kDefaultGamma(0.0);
+const sptk::WaveformToMelGeneralizedCepstrum::OutputFormats
+    kDefaultOutputFormat(sptk::WaveformToMelGeneralizedCepstrum::kCepstrum);
+const int kDefaultNumIteration(30);
+const double kDefaultConvergenceThreshold(1e-3);
+const int kDefaultNumThread(1);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " wav2mgc - mel-generalized cepstral analysis of waveform" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       wav2mgc [ options ] [ infile ] > stdout" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -l l  : frame length                        (   int)[" << std::setw(5) << std::right << kDefaultFrameLength          << "][    1 <= l <=     ]" << std::endl;  // NOLINT
+  *stream << "       -p p  : frame period                        (   int)[" << std::setw(5) << std::right << kDefaultFramePeriod          << "][    1 <= p <=     ]" << std::endl;  // NOLINT
+  *stream << "       -t t  : framing type                        (   int)[" << std::setw(5) << std::right << kDefaultFramingType          << "][    0 <= t <= 1   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (the beginning of data is the center of the first frame)" << std::endl;  // NOLINT
+  *stream << "                 1 (the beginning of data is the start of the first frame)" << std::endl;  // NOLINT
+  *stream << "       -z    : mean subtraction                    (  bool)[" << std::setw(5) << std::right << "FALSE"                      << "]" << std::endl;  // NOLINT
+  *stream << "       -w w  : window type                         (   int)[" << std::setw(5) << std::right << kDefaultWindowTypeIndex      << "][    0 <= w <= 5   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (Blackman)" << std::endl;
+  *stream << "                 1 (Hamming)" << std::endl;
+  *stream << "                 2 (Hanning)" << std::endl;
+  *stream << "                 3 (Bartlett)" << std::endl;
+  *stream << "                 4 (trapezoidal)" << std::endl;
+  *stream << "                 5 (rectangular)" << std::endl;
+  *stream << "       -n n  : window normalization type           (   int)[" << std::setw(5) << std::right << kDefaultNormalizationType    << "][    0 <= n <= 2   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (none)" << std::endl;
+  *stream << "                 1 (power)" << std::endl;
+  *stream << "                 2 (magnitude)" << std::endl;
+  *stream << "       -L L  : FFT length                          (   int)[" << std::setw(5) << std::right << "l"                          << "][    l <= L <=     ]" << std::endl;  // NOLINT
+  *stream << "       -m m  : order of mel-generalized cepstrum   (   int)[" << std::setw(5) << std::right << kDefaultNumOrder             << "][    0 <= m <=     ]" << std::endl;  // NOLINT
+  *stream << "       -a a  : all-pass constant                   (double)[" << std::setw(5) << std::right << kDefaultAlpha                << "][ -1.0 <  a <  1.0 ]" << std::endl;  // NOLINT
+  *stream << "       -g g  : gamma                               (double)[" << std::setw(5) << std::right << kDefaultGamma                << "][ -1.0 <= g <= 0.0 ]" << std::endl;  // NOLINT
+  *stream << "       -c c  : gamma = -1 / c                      (   int)[" << std::setw(5) << std::right << "N/A"                        << "][    0 <= c <=     ]" << std::endl;  // NOLINT
+  *stream << "       -o o  : output format                       (   int)[" << std::setw(5) << std::right << kDefaultOutputFormat         << "][    0 <= o <= 3   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (mel-cepstrum)" << std::endl;
+  *stream << "                 1 (mlsa filter coefficients)" << std::endl;
+  *stream << "                 2 (gain normalized mel-cepstrum)" << std::endl;
+  *stream << "                 3 (gain normalized mlsa filter coefficients)" << std::endl;  // NOLINT
+  *stream << "       -j j  : number of threads                   (   int)[" << std::setw(5) << std::right << kDefaultNumThread            << "][    1 <= j <=     ]" << std::endl;  // NOLINT
+  *stream << "     (level 2)" << std::endl;
+  *stream << "       -i i  : maximum number of iterations        (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][    0 <= i <=     ]" << std::endl;  // NOLINT
+  *stream << "       -d d  : convergence threshold               (double)[" << std::setw(5) << std::right << kDefaultConvergenceThreshold << "][  0.0 <= d <=     ]" << std::endl;  // NOLINT
+  *stream << "       -e e  : small value added to power spectrum (double)[" << std::setw(5) << std::right << "N/A"                        << "][  0.0 <  e <=     ]" << std::endl;  // NOLINT
+  *stream << "       -E E  : relative floor in decibels          (double)[" << std::setw(5) << std::right << "N/A"                        << "][      <= E <  0.0 ]" << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       data sequence                               (double)[stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       mel-generalized cepstrum                    (double)" << std::endl;  // NOLINT
+  *stream << "  notice:" << std::endl;
+  *stream << "       value of L must be a power of 2" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+class FrameProcessor
+    : public sptk::ParallelFrameExecutor::FrameProcessorInterface {
+ public:
+  explicit FrameProcessor(const sptk::WaveformToMelGeneralizedCepstrum&
+                              waveform_to_mel_generalized_cepstrum)
+      : waveform_to_mel_generalized_cepstrum_(
+            waveform_to_mel_generalized_cepstrum) {
+  }
+
+  virtual bool Run(int, const std::vector<double>& input,
+                   std::vector<double>* output, std::ostream* log) {
+    if (!waveform_to_mel_generalized_cepstrum_.Run(input, output, &buffer_)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run mel-generalized cepstral analysis";
+      sptk::PrintErrorMessage("wav2mgc", error_message, log);
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  const sptk::WaveformToMelGeneralizedCepstrum&
+      waveform_to_mel_generalized_cepstrum_;
+
+  sptk::WaveformToMelGeneralizedCepstrum::Buffer buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameProcessor);
+};
+
+}  // namespace
+
+/**
+ * @a wav2mgc [ @e option ] [ @e infile ]
+ *
+ * - @b -l @e int
+ *   - frame length @f$(1 \le L)@f$
+ * - @b -p @e int
+ *   - frame period @f$(1 \le P)@f$
+ * - @b -t @e int
+ *   - framing type
+ *     \arg @c 0 the beginning of data is the center of the first frame
+ *     \arg @c 1 the beginning of data is the start of the first frame
+ * - @b -z
+ *   - perform mean subtraction in a frame
+ * - @b -w @e int
+ *   - window type
+ *     \arg @c 0 Blackman
+ *     \arg @c 1 Hamming
+ *     \arg @c 2 Hanning
+ *     \arg @c 3 Bartlett
+ *     \arg @c 4 Trapezoidal
+ *     \arg @c 5 Rectangular
+ * - @b -n @e int
+ *   - window normalization type
+ *     \arg @c 0 none
+ *     \arg @c 1 power
+ *     \arg @c 2 magnitude
+ * - @b -L @e int
+ *   - FFT length @f$(L \le N)@f$
+ * - @b -m @e int
+ *   - order of coefficients @f$(0 \le M)@f$
+ * - @b -a @e double
+ *   - all-pass constant @f$(|\alpha| < 1)@f$
+ * - @b -g @e double
+ *   - gamma @f$(|\gamma| \le 1)@f$
+ * - @b -c @e int
+ *   - gamma @f$\gamma = -1 / C@f$ @f$(1 \le C)@f$
+ * - @b -o @e int
+ *   - output format
+ *     \arg @c 0 mel-cepstrum
+ *     \arg @c 1 MLSA filter coefficients
+ *     \arg @c 2 gain normalized mel-cepstrum
+ *     \arg @c 3 gain normalized MLSA filter coefficients.
+ * - @b -j @e int
+ *   - number of threads @f$(1 \le J)@f$
+ * - @b -i @e int
+ *   - number of iterations @f$(0 \le J)@f$
+ * - @b -d @e double
+ *   - convergence threshold @f$(0 \le \epsilon)@f$
+ * - @b -e @e double
+ *   - small value added to power spectrum
+ * - @b -E @e double
+ *   - relative floor in decibels
+ * - @b infile @e str
+ *   - double-type data sequence
+ * - @b stdout
+ *   - double-type mel-generalized cepstral coefficients
+ *
+ * This command performs framing, windowing, and mel-generalized cepstral
+ * analysis in one process. The extracted frames are analyzed by @f$J@f$
+ * threads, and the output order is the same as the input order.
+ *
+ * In the example below, mel-cepstral coefficients are extracted from @c data.d.
+ *
+ * @code{.sh}
+ *   wav2mgc -l 400 -p 80 -L 512 -m 24 -a 0.42 -j 4 < data.d > data.mcep
+ * @endcode
+ *
+ * This is equivalent to the below line.
+ *
+ * @code{.sh}
+ *   frame -l 400 -p 80 < data.d | window -l 400 -L 512 |
+ *     mgcep -l 512 -m 24 -a 0.42 > data.mcep
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  int frame_length(kDefaultFrameLength);
+  int frame_period(kDefaultFramePeriod);
+  sptk::InputSourceFraming::FramingTypes framing_type(kDefaultFramingType);
+  bool zero_mean(false);
+  int window_type_index(kDefaultWindowTypeIndex);
+  sptk::DataWindowing::NormalizationType normalization_type(
+      kDefaultNormalizationType);
+  int fft_length(0);
+  bool is_fft_length_specified(false);
+  int num_order(kDefaultNumOrder);
+  double alpha(kDefaultAlpha);
+  double gamma(kDefaultGamma);
+  sptk::WaveformToMelGeneralizedCepstrum::OutputFormats output_format(
+      kDefaultOutputFormat);
+  int num_thread(kDefaultNumThread);
+  int num_iteration(kDefaultNumIteration);
+  double convergence_threshold(kDefaultConvergenceThreshold);
+  double epsilon(0.0);
+  double relative_floor_in_decibels(-DBL_MAX);
+
+  const struct option long_options[] = {
+      {"threads", required_argument, NULL, 'j'},
+      {0, 0, 0, 0},
+  };
+
+  for (;;) {
+    const int option_char(getopt_long(
+        argc, argv, "l:p:t:zw:n:L:m:a:g:c:o:j:i:d:e:E:h", long_options, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'l': {
+        if (!sptk::ConvertStringToInteger(optarg, &frame_length) ||
+            frame_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -l option must be a positive integer";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'p': {
+        if (!sptk::ConvertStringToInteger(optarg, &frame_period) ||
+            frame_period <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -p option must be a positive integer";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 't': {
+        const int min(0);
+        const int max(
+            static_cast<int>(sptk::InputSourceFraming::kNumFramingTypes) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -t option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        framing_type =
+            static_cast<sptk::InputSourceFraming::FramingTypes>(tmp);
+        break;
+      }
+      case 'z': {
+        zero_mean = true;
+        break;
+      }
+      case 'w': {
+        const int min(0);
+        const int max(sptk::StandardWindow::kNumIndexedWindowTypes - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -w option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        window_type_index = tmp;
+        break;
+      }
+      case 'n': {
+        const int min(0);
+        const int max(static_cast<int>(sptk::DataWindowing::NormalizationType::
+                                           kNumNormalizationTypes) -
+                      1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -n option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        normalization_type =
+            static_cast<sptk::DataWindowing::NormalizationType>(tmp);
+        break;
+      }
+      case 'L': {
+        if (!sptk::ConvertStringToInteger(optarg, &fft_length)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -L option must be an integer";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        is_fft_length_specified = true;
+        break;
+      }
+      case 'm': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_order) ||
+            num_order < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -m option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'a': {
+        if (!sptk::ConvertStringToDouble(optarg, &alpha) ||
+            !sptk::IsValidAlpha(alpha)) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -a option must be in (-1.0, 1.0)";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'g': {
+        if (!sptk::ConvertStringToDouble(optarg, &gamma) ||
+            !sptk::IsValidGamma(gamma)) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -g option must be in [-1.0, 0.0]";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'c': {
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) || tmp < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -c option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        gamma = (0 == tmp) ? 0.0 : -1.0 / tmp;
+        break;
+      }
+      case 'o': {
+        const int min(0);
+        const int max(static_cast<int>(sptk::WaveformToMelGeneralizedCepstrum::
+                                           kNumOutputFormats) -
+                      1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -o option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        output_format =
+            static_cast<sptk::WaveformToMelGeneralizedCepstrum::OutputFormats>(
+                tmp);
+        break;
+      }
+      case 'j': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -j option must be a positive integer";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'i': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_iteration) ||
+            num_iteration < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -i option must be a "
+                           "non-negative integer";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'd': {
+        if (!sptk::ConvertStringToDouble(optarg, &convergence_threshold) ||
+            convergence_threshold < 0.0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -d option must be a non-negative number";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'e': {
+        if (!sptk::ConvertStringToDouble(optarg, &epsilon) || epsilon <= 0.0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -e option must be a positive number";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'E': {
+        if (!sptk::ConvertStringToDouble(optarg, &relative_floor_in_decibels) ||
+            0.0 <= relative_floor_in_decibels) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -E option must be a negative number";
+          sptk::PrintErrorMessage("wav2mgc", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  if (!is_fft_length_specified) {
+    fft_length = frame_length;
+  } else if (fft_length < frame_length) {
+    std::ostringstream error_message;
+    error_message << "FFT length must be greater than or equal to frame length";
+    sptk::PrintErrorMessage("wav2mgc", error_message);
+    return 1;
+  }
+
+  const int num_input_files(argc - optind);
+  if (1 < num_input_files) {
+    std::ostringstream error_message;
+    error_message << "Too many input files";
+    sptk::PrintErrorMessage("wav2mgc", error_message);
+    return 1;
+  }
+  const char* input_file(0 == num_input_files ? NULL : argv[optind]);
+
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << input_file;
+    sptk::PrintErrorMessage("wav2mgc", error_message);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  sptk::StandardWindow::WindowType window_type;
+  if (!sptk::StandardWindow::GetWindowTypeFromIndex(window_type_index,
+                                                    &window_type)) {
+    return 1;
+  }
+
+  sptk::StandardWindow standard_window(frame_length, window_type, false);
+  sptk::WaveformToMelGeneralizedCepstrum waveform_to_mel_generalized_cepstrum(
+      &standard_window, normalization_type, fft_length, num_order, alpha,
+      gamma, num_iteration, convergence_threshold, epsilon,
+      relative_floor_in_decibels, output_format);
+  if (!waveform_to_mel_generalized_cepstrum.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "Failed to set condition for mel-generalized cepstral "
+                  << "analysis";
+    sptk::PrintErrorMessage("wav2mgc", error_message);
+    return 1;
+  }
+
+  sptk::InputSourceFraming input_source(frame_length, frame_period,
+                                        framing_type, zero_mean,
+                                        &input_stream);
+  if (!input_source.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "Failed to initialize InputSourceFraming";
+    sptk::PrintErrorMessage("wav2mgc", error_message);
+    return 1;
+  }
+
+  std::vector<sptk::ParallelFrameExecutor::FrameProcessorInterface*>
+      frame_processors(num_thread);
+  for (int i(0); i < num_thread; ++i) {
+    frame_processors[i] =
+        new FrameProcessor(waveform_to_mel_generalized_cepstrum);
+  }
+  sptk::ParallelFrameExecutor parallel_frame_executor(frame_processors);
+
+  bool is_processed;
+  const bool is_success(
+      parallel_frame_executor.Run(&input_source, &std::cout, &is_processed));
+  for (int i(0); i < num_thread; ++i) {
+    delete frame_processors[i];
+  }
+  if (!is_success) {
+    if (is_processed) {
+      std::ostringstream error_message;
+      error_message << "Failed to write mel-generalized cepstrum";
+      sptk::PrintErrorMessage("wav2mgc", error_message);
+    }
+    return 1;
+  }
+  if (input_source.IsFailed()) {
+    std::ostringstream error_message;
+    error_message << "Failed to read data";
+    sptk::PrintErrorMessage("wav2mgc", error_message);
+    return 1;
+  }
+
+  return 0;
+}
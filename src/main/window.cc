@@ -27,20 +27,10 @@
 
 namespace {
 
-enum LocalWindowType {
-  kBlackman = 0,
-  kHamming,
-  kHanning,
-  kBartlett,
-  kTrapezoidal,
-  kRectangular,
-  kNumWindowTypes
-};
-
 const int kDefaultFrameLength(256);
 const sptk::DataWindowing::NormalizationType kDefaultNormalizationType(
     sptk::DataWindowing::NormalizationType::kPower);
-const LocalWindowType kDefaultLocalWindowType(kBlackman);
+const int kDefaultWindowTypeIndex(0);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -56,7 +46,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 0 (none)" << std::endl;
   *stream << "                 1 (power)" << std::endl;
   *stream << "                 2 (magnitude)" << std::endl;
-  *stream << "       -w w  : window type            (   int)[" << std::setw(5) << std::right << kDefaultLocalWindowType   << "][ 0 <= w <= 5 ]" << std::endl;  // NOLINT
+  *stream << "       -w w  : window type            (   int)[" << std::setw(5) << std::right << kDefaultWindowTypeIndex   << "][ 0 <= w <= 5 ]" << std::endl;  // NOLINT
   *stream << "                 0 (Blackman)" << std::endl;
   *stream << "                 1 (Hamming)" << std::endl;
   *stream << "                 2 (Hanning)" << std::endl;
@@ -117,7 +107,7 @@ int main(int argc, char* argv[]) {
   bool is_output_length_specified(false);
   sptk::DataWindowing::NormalizationType normalization_type(
       kDefaultNormalizationType);
-  LocalWindowType local_window_type(kDefaultLocalWindowType);
+  int window_type_index(kDefaultWindowTypeIndex);
 
   for (;;) {
     const int option_char(getopt_long(argc, argv, "l:L:n:w:h", NULL, NULL));
@@ -167,7 +157,7 @@ int main(int argc, char* argv[]) {
       }
       case 'w': {
         const int min(0);
-        const int max(static_cast<int>(kNumWindowTypes) - 1);
+        const int max(sptk::StandardWindow::kNumIndexedWindowTypes - 1);
         int tmp;
         if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
             !sptk::IsInRange(tmp, min, max)) {
@@ -177,7 +167,7 @@ int main(int argc, char* argv[]) {
           sptk::PrintErrorMessage("window", error_message);
           return 1;
         }
-        local_window_type = static_cast<LocalWindowType>(tmp);
+        window_type_index = tmp;
         break;
       }
       case 'h': {
@@ -222,34 +212,9 @@ int main(int argc, char* argv[]) {
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
   sptk::StandardWindow::WindowType window_type;
-  switch (local_window_type) {
-    case kBlackman: {
-      window_type = sptk::StandardWindow::kBlackman;
-      break;
-    }
-    case kHamming: {
-      window_type = sptk::StandardWindow::kHamming;
-      break;
-    }
-    case kHanning: {
-      window_type = sptk::StandardWindow::kHanning;
-      break;
-    }
-    case kBartlett: {
-      window_type = sptk::StandardWindow::kBartlett;
-      break;
-    }
-    case kTrapezoidal: {
-      window_type = sptk::StandardWindow::kTrapezoidal;
-      break;
-    }
-    case kRectangular: {
-      window_type = sptk::StandardWindow::kRectangular;
-      break;
-    }
-    default: {
-      return 1;
-    }
+  if (!sptk::StandardWindow::GetWindowTypeFromIndex(window_type_index,
+                                                    &window_type)) {
+    return 1;
   }
 
   sptk::StandardWindow standard_window(input_length, window_type, false);
@@ -17,7 +17,7 @@
 #include <cfloat>     // DBL_MAX, FLT_MAX
 #include <climits>    // INT_MIN, INT_MAX, SCHAR_MIN, SCHAR_MAX, etc.
 #include <cstdint>    // int8_t, int16_t, int32_t, int64_t, etc.
-#include <cstring>    // std::strncmp
+#include <cstring>    // std::strlen, std::strncmp
 #include <fstream>    // std::ifstream  输入流的头文件，支持输入流
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc. 
@@ -25,10 +25,13 @@
 #include <sstream>    // std::ostringstream
 #include <stdexcept>  // std::invalid_argument
 #include <string>     // std::stold, std::string  为了支持我们读取字符串
+#include <vector>     // std::vector
 
 
 // 这里引用双引号的原因是系统会从当前的目录中寻找头文件，不像<>从系统环境变量中找，这里的头文件是自己编写的，所以用了""，而且要加后缀，原生的头文件<>不需要。
 #include "Getopt/getoptwin.h"
+#include "SPTK/utils/buffered_input_stream.h"
+#include "SPTK/utils/buffered_output_stream.h"
 #include "SPTK/utils/int24_t.h"
 #include "SPTK/utils/sptk_utils.h"
 #include "SPTK/utils/uint24_t.h"
@@ -65,6 +68,7 @@ enum NumericType {
 enum WarningType { kIgnore = 0, kWarn, kExit, kNumWarningTypes };
 
 const int kBufferSize(128);
+const int kBlockSize(4096);
 
 // char字符串类型，能取256种数据
 const char* kDefaultDataTypes("da");
@@ -120,6 +124,34 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
+// Equivalent to snprintf with "%lld" and returns the number of characters.
+int FormatInteger(uint64_t magnitude, bool is_negative, char* buffer) {
+  char digits[20];
+  int num_digit(0);
+  do {
+    digits[num_digit++] = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (0 < magnitude);
+
+  int length(0);
+  if (is_negative) buffer[length++] = '-';
+  while (0 < num_digit) buffer[length++] = digits[--num_digit];
+  buffer[length] = '\0';
+  return length;
+}
+
+int FormatInteger(int64_t value, char* buffer) {
+  // The magnitude is calculated in unsigned type to handle INT64_MIN.
+  return (value < 0) ? FormatInteger(0 - static_cast<uint64_t>(value), true,
+                                     buffer)
+                     : FormatInteger(static_cast<uint64_t>(value), false,
+                                     buffer);
+}
+
+int FormatInteger(uint64_t value, char* buffer) {
+  return FormatInteger(value, false, buffer);
+}
+
 class DataTransformInterface {
  public:
   // public 继承：描述 是一个 的关系
@@ -156,7 +188,15 @@ class DataTransform : public DataTransformInterface {
         is_ascii_input_(is_ascii_input),
         is_ascii_output_(is_ascii_output),
         minimum_value_(minimum_value),
-        maximum_value_(maximum_value) {
+        maximum_value_(maximum_value),
+        use_integer_formatter_(
+            is_ascii_output_ &&
+            ((kSignedInteger == input_numeric_type_ &&
+              (("%d" == print_format_ && sizeof(T2) <= sizeof(int)) ||
+               "%lld" == print_format_)) ||
+             (kUnsignedInteger == input_numeric_type_ &&
+              (("%u" == print_format_ && sizeof(T2) <= sizeof(int)) ||
+               "%llu" == print_format_)))) {
   }
 
   //这里没有分号,表示这是复合语句.
@@ -166,83 +206,136 @@ class DataTransform : public DataTransformInterface {
 
   virtual bool Run(std::istream* input_stream) const {
     char buffer[kBufferSize];
+    sptk::BufferedInputStream buffered_input_stream(input_stream);
+    sptk::BufferedOutputStream buffered_output_stream(&std::cout);
     // char表示基本的字符信息类型, 这里是一串字符串数组长度是kBufferSize：就是128个元素。我们要声明这个叫“char”的变量长度是kBufferSize。这是约定俗成的。
+    std::vector<T1> input_data(kBlockSize);
+    std::vector<T2> output_data(kBlockSize);
     int index(0);
-    // 这里;代表空语句就是什么也不做的意思,通常和循环语句联系在一起.
+    bool is_end(false);
     // 无限循环
-    for (;; ++index) {
-      // this is just a while loop, the break represents when the loop ends.
-      // Read.
-      T1 input_data;
+    while (!is_end) {
+      // Read a block of data.
+      int block_length(0);
       if (is_ascii_input_) {
-        std::string word;
-        *input_stream >> word;
-        if (word.empty()) break;
-        try {
-          // C++ 中的处理方法：通过关键字 try/catch/throw 引入异常处理机制
+        for (; block_length < kBlockSize; ++block_length) {
+          std::string word;
+          *input_stream >> word;
+          if (word.empty()) {
+            is_end = true;
+            break;
+          }
+          try {
+            // C++ 中的处理方法：通过关键字 try/catch/throw 引入异常处理机制
 //          异常触发时的系统行为 栈展开 ——
 //          – 抛出异常后续的代码不会被执行
 //          – 局部对象会按照构造相反的顺序自动销毁
 //          – 系统尝试匹配相应的 catch 代码段
-          input_data = std::stold(word);
-          /*
-           * ●
-              try / catch 语句块
-              – 一个 try 语句块后面可以跟一到多个 catch 语句块
-              – 每个 catch 语句块用于匹配一种类型的异常对象
-              – catch 语句块的匹配按照从上到下进行
-              – 使用 catch(...) 匹配任意异常
-              – 在 catch 中调用 throw 继续抛出相同的异常
-              ● 在一个异常未处理完成时抛出新的异常会导致程序崩溃
-              – 不要在析构函数或 operator delete 函数重载版本中抛出异常
-              – 通常来说， catch 所接收的异常类型为引用类型
-           */
-        } catch (std::invalid_argument&) {
-          return false;
+            input_data[block_length] = std::stold(word);
+            /*
+             * ●
+                try / catch 语句块
+                – 一个 try 语句块后面可以跟一到多个 catch 语句块
+                – 每个 catch 语句块用于匹配一种类型的异常对象
+                – catch 语句块的匹配按照从上到下进行
+                – 使用 catch(...) 匹配任意异常
+                – 在 catch 中调用 throw 继续抛出相同的异常
+                ● 在一个异常未处理完成时抛出新的异常会导致程序崩溃
+                – 不要在析构函数或 operator delete 函数重载版本中抛出异常
+                – 通常来说， catch 所接收的异常类型为引用类型
+             */
+          } catch (std::invalid_argument&) {
+            // Write the data read so far before exiting as in the case of
+            // processing them one by one.
+            const int first_index(index);
+            Write(Convert(block_length, input_data, &index, &output_data),
+                  output_data, first_index, &buffered_output_stream, buffer);
+            return false;
+          }
         }
       } else {
-        if (!sptk::ReadStream(&input_data, input_stream)) {
-          break;
-        }
+        block_length = buffered_input_stream.Read(kBlockSize, &(input_data[0]));
+      }
+      if (0 == block_length) break;
+
+      // Convert.
+      const int first_index(index);
+      const int num_converted_data(
+          Convert(block_length, input_data, &index, &output_data));
+
+      // Write output.
+      if (!Write(num_converted_data, output_data, first_index,
+                 &buffered_output_stream, buffer)) {
+        return false;
+      }
+      if (num_converted_data < block_length) {
+        return false;
+      }
+    }
+
+    if (is_ascii_output_ && 0 != index % num_column_) {
+      if (!buffered_output_stream.Write('\n')) {
+        return false;
+      }
+    }
+
+    return buffered_output_stream.Flush();
+  }
+
+ private:
+  // Convert data in order and return the number of converted data. The
+  // conversion stops at the first clipped data if the warning type is kExit.
+  int Convert(int block_length, const std::vector<T1>& input_data, int* index,
+              std::vector<T2>* output_data) const {
+    const bool is_clipping(minimum_value_ < maximum_value_);
+
+    // Fast path of lossless conversion, which can be vectorized.
+    if (!is_clipping && !rounding_) {
+      for (int i(0); i < block_length; ++i) {
+        (*output_data)[i] = static_cast<T2>(input_data[i]);
       }
+      *index += block_length;
+      return block_length;
+    }
 
+    for (int i(0); i < block_length; ++i, ++*index) {
       // Convert.
-      T2 output_data(input_data);
+      T2 output(input_data[i]);
 
       bool is_clipped(false);
       {
         // Clipping.
-        if (minimum_value_ < maximum_value_) {
+        if (is_clipping) {
           // 一般都是常量在左边。
           if (kSignedInteger == input_numeric_type_) {
-            if (static_cast<int64_t>(input_data) <
+            if (static_cast<int64_t>(input_data[i]) <
                 static_cast<int64_t>(minimum_value_)) {
-              output_data = minimum_value_;
+              output = minimum_value_;
               is_clipped = true;
             } else if (static_cast<int64_t>(maximum_value_) <
-                       static_cast<int64_t>(input_data)) {
-              output_data = maximum_value_;
+                       static_cast<int64_t>(input_data[i])) {
+              output = maximum_value_;
               is_clipped = true;
             }
           } else if (kUnsignedInteger == input_numeric_type_) {
-            if (static_cast<uint64_t>(input_data) <
+            if (static_cast<uint64_t>(input_data[i]) <
                 static_cast<uint64_t>(minimum_value_)) {
-              output_data = minimum_value_;
+              output = minimum_value_;
               is_clipped = true;
             } else if (static_cast<uint64_t>(maximum_value_) <
-                       static_cast<uint64_t>(input_data)) {
-              output_data = maximum_value_;
+                       static_cast<uint64_t>(input_data[i])) {
+              output = maximum_value_;
               is_clipped = true;
             }
           } else if (kFloatingPoint == input_numeric_type_) {
             // 这里static_cast<long double其实是个布尔值
-            if (static_cast<long double>(input_data) <
+            if (static_cast<long double>(input_data[i]) <
                 static_cast<long double>(minimum_value_)) {
-              output_data = minimum_value_;
+              output = minimum_value_;
               is_clipped = true;
             } else if (static_cast<long double>(maximum_value_) <
-                       static_cast<long double>(input_data)) {
-              output_data = maximum_value_;
+                       static_cast<long double>(input_data[i])) {
+              output = maximum_value_;
               is_clipped = true;
             }
           }
@@ -250,50 +343,64 @@ class DataTransform : public DataTransformInterface {
         // if 语句这里
         // Rounding.
         if (rounding_ && !is_clipped) {
-          if (0.0 < input_data) {
-            output_data = static_cast<T2>(input_data + 0.5);
+          if (0.0 < input_data[i]) {
+            output = static_cast<T2>(input_data[i] + 0.5);
           } else {
-            output_data = static_cast<T2>(input_data - 0.5);
+            output = static_cast<T2>(input_data[i] - 0.5);
           }
         }
       }
 
       if (is_clipped && kIgnore != warning_type_) {
         std::ostringstream error_message;
-        error_message << index << "th data is over the range of output type";
+        error_message << *index << "th data is over the range of output type";
         sptk::PrintErrorMessage("x2x", error_message);
-        if (kExit == warning_type_) return false;
+        if (kExit == warning_type_) return i;
       }
 
-      // Write output.
-      if (is_ascii_output_) {
+      (*output_data)[i] = output;
+    }
+
+    return block_length;
+  }
+
+  bool Write(int block_length, const std::vector<T2>& output_data,
+             int first_index, sptk::BufferedOutputStream* output_stream,
+             char* buffer) const {
+    if (!is_ascii_output_) {
+      return 0 == block_length ||
+             output_stream->Write(block_length, &(output_data[0]));
+    }
+
+    for (int i(0); i < block_length; ++i) {
+      // Avoid snprintf for integers as it dominates the time of conversion.
+      int length;
+      if (use_integer_formatter_) {
+        length = (kSignedInteger == input_numeric_type_)
+                     ? FormatInteger(static_cast<int64_t>(output_data[i]),
+                                     buffer)
+                     : FormatInteger(static_cast<uint64_t>(output_data[i]),
+                                     buffer);
+      } else {
         // 存储所需要的尺寸 (sizeof ，标准并没有严格限制), sizeof 不会返回动态分配的内存大小
-        if (!sptk::SnPrintf(output_data, print_format_, sizeof(buffer),
+        if (!sptk::SnPrintf(output_data[i], print_format_, kBufferSize,
                             buffer)) {
           return false;
         }
-        std::cout << buffer;
-        // 我们通常把常量放在左边，如果为了比较逻辑，变量是右值，放在右边。避免变量问题。
-        if (0 == (index + 1) % num_column_) {
-          std::cout << std::endl;
-        } else {
-          std::cout << "\t";
-        }
-      } else {
-        if (!sptk::WriteStream(output_data, &std::cout)) {
-          return false;
-        }
+        length = static_cast<int>(std::strlen(buffer));
+      }
+      // 我们通常把常量放在左边，如果为了比较逻辑，变量是右值，放在右边。避免变量问题。
+      const char delimiter(0 == (first_index + i + 1) % num_column_ ? '\n'
+                                                                   : '\t');
+      if (!output_stream->Write(length, buffer) ||
+          !output_stream->Write(delimiter)) {
+        return false;
       }
-    }
-
-    if (is_ascii_output_ && 0 != index % num_column_) {
-      std::cout << std::endl;
     }
 
     return true;
   }
 
- private:
   //  private 继承：描述 根据基类实现出 的关系
   const std::string print_format_; // 这里定义了一个字符串叫print_format_
   // const在这里限定表示是个常量，表示这个整数是不能被修改的，就是只读的意思,
@@ -305,6 +412,7 @@ class DataTransform : public DataTransformInterface {
   const bool is_ascii_output_;
   const T2 minimum_value_;
   const T2 maximum_value_;
+  const bool use_integer_formatter_;
 
   DataTransform<T1, T2>(const DataTransform<T1, T2>&);
   void operator=(const DataTransform<T1, T2>&);
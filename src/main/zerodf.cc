@@ -25,6 +25,8 @@
 #include "SPTK/input/input_source_from_stream.h"
 #include "SPTK/input/input_source_interpolation.h"
 #include "SPTK/input/input_source_preprocessing_for_filter_gain.h"
+#include "SPTK/utils/buffered_input_stream.h"
+#include "SPTK/utils/buffered_output_stream.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -238,9 +240,11 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  sptk::BufferedInputStream buffered_input_stream(&stream_for_filter_input);
+  sptk::BufferedOutputStream buffered_output_stream(&std::cout);
   double signal;
 
-  while (sptk::ReadStream(&signal, &stream_for_filter_input)) {
+  while (buffered_input_stream.Read(&signal)) {
     if (!preprocessing.Get(&filter_coefficients)) {
       std::ostringstream error_message;
       error_message << "Cannot get filter coefficients";
@@ -255,7 +259,7 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    if (!sptk::WriteStream(signal, &std::cout)) {
+    if (!buffered_output_stream.Write(signal)) {
       std::ostringstream error_message;
       error_message << "Failed to write a filter output";
       sptk::PrintErrorMessage("zerodf", error_message);
@@ -263,5 +267,12 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  if (!buffered_output_stream.Flush()) {
+    std::ostringstream error_message;
+    error_message << "Failed to write a filter output";
+    sptk::PrintErrorMessage("zerodf", error_message);
+    return 1;
+  }
+
   return 0;
 }
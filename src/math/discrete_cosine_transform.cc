@@ -83,7 +83,8 @@ bool DiscreteCosineTransform::Run(
                     buffer->fourier_transform_imag_part_.end() - dct_length_);
 
   if (!fourier_transform_.Run(&buffer->fourier_transform_real_part_,
-                              &buffer->fourier_transform_imag_part_)) {
+                              &buffer->fourier_transform_imag_part_,
+                              &buffer->buffer_for_fourier_transform_)) {
     return false;
   }
 
@@ -16,16 +16,18 @@
 
 #include "SPTK/math/dynamic_time_warping.h"
 
-#include <algorithm>  // std::reverse
+#include <algorithm>  // std::max, std::min, std::reverse
 #include <cfloat>     // DBL_MAX
+#include <cmath>      // std::ceil, std::floor
+#include <cstddef>    // std::size_t
 
 namespace {
 
-struct Cell {
-  double score;
-  int horizontal_back_pointer;
-  int vertical_back_pointer;
-};
+// Tolerance used to compute the band edges.
+const double kEpsilon(1e-9);
+
+// Back pointer of the cell which has no predecessor.
+const signed char kNoBackPointer(-1);
 
 }  // namespace
 
@@ -33,14 +35,22 @@ namespace sptk {
 
 DynamicTimeWarping::DynamicTimeWarping(
     int num_order, LocalPathConstraints local_path_constraint,
-    DistanceCalculation::DistanceMetrics distance_metric)
+    DistanceCalculation::DistanceMetrics distance_metric,
+    GlobalPathConstraints global_path_constraint, int window_width,
+    double maximum_slope)
     : num_order_(num_order),
       local_path_constraint_(local_path_constraint),
       distance_calculation_(num_order_, distance_metric),
+      global_path_constraint_(global_path_constraint),
+      window_width_(window_width),
+      maximum_slope_(maximum_slope),
       includes_skip_transition_((kType4 == local_path_constraint_ ||
                                  kType6 == local_path_constraint_)),
       is_valid_(true) {
-  if (num_order_ < 0 || !distance_calculation_.IsValid()) {
+  if (num_order_ < 0 || !distance_calculation_.IsValid() ||
+      global_path_constraint_ < kUnconstrained ||
+      kNumGlobalPathConstraints <= global_path_constraint_ ||
+      window_width_ < 0 || maximum_slope_ <= 1.0) {
     is_valid_ = false;
     return;
   }
@@ -107,23 +117,106 @@ bool DynamicTimeWarping::Run(
     double* total_score) const {
   // Check inputs.
   if (!is_valid_ || query_vector_sequence.empty() ||
-      reference_vector_sequence.empty() || NULL == viterbi_path ||
+      reference_vector_sequence.empty() || NULL == total_score) {
+    return false;
+  }
+
+  // Compute the range of reference index for each query index.
+  std::vector<int> begins;
+  std::vector<int> ends;
+  CalculateBand(static_cast<int>(query_vector_sequence.size()),
+                static_cast<int>(reference_vector_sequence.size()), &begins,
+                &ends);
+
+  return RunInBand(query_vector_sequence, reference_vector_sequence, begins,
+                   ends, viterbi_path, total_score);
+}
+
+bool DynamicTimeWarping::Run(
+    const std::vector<std::vector<double> >& query_vector_sequence,
+    const std::vector<std::vector<double> >& reference_vector_sequence,
+    const std::vector<int>& begins, const std::vector<int>& ends,
+    std::vector<std::pair<int, int> >* viterbi_path,
+    double* total_score) const {
+  // Check inputs.
+  const int num_query_vector(static_cast<int>(query_vector_sequence.size()));
+  if (!is_valid_ || query_vector_sequence.empty() ||
+      reference_vector_sequence.empty() ||
+      begins.size() != static_cast<std::size_t>(num_query_vector) ||
+      ends.size() != static_cast<std::size_t>(num_query_vector) ||
       NULL == total_score) {
     return false;
   }
 
+  // Intersect the window with the global path constraint.
+  std::vector<int> band_begins;
+  std::vector<int> band_ends;
+  CalculateBand(num_query_vector,
+                static_cast<int>(reference_vector_sequence.size()),
+                &band_begins, &band_ends);
+  for (int i(0); i < num_query_vector; ++i) {
+    band_begins[i] = std::max(band_begins[i], begins[i]);
+    band_ends[i] = std::min(band_ends[i], ends[i]);
+  }
+
+  return RunInBand(query_vector_sequence, reference_vector_sequence,
+                   band_begins, band_ends, viterbi_path, total_score);
+}
+
+bool DynamicTimeWarping::RunInBand(
+    const std::vector<std::vector<double> >& query_vector_sequence,
+    const std::vector<std::vector<double> >& reference_vector_sequence,
+    const std::vector<int>& begins, const std::vector<int>& ends,
+    std::vector<std::pair<int, int> >* viterbi_path,
+    double* total_score) const {
   const int num_candidate(static_cast<int>(local_path_candidates_.size()));
   const int num_query_vector(static_cast<int>(query_vector_sequence.size()));
   const int num_reference_vector(
       static_cast<int>(reference_vector_sequence.size()));
 
-  std::vector<std::vector<Cell> > cell(num_query_vector,
-                                       std::vector<Cell>(num_reference_vector));
-  std::vector<std::vector<Cell> > cell_for_skip_transition(
-      num_query_vector, std::vector<Cell>(num_reference_vector));
+  if (0 != begins[0] ||
+      ends[num_query_vector - 1] != num_reference_vector ||
+      ends[num_query_vector - 1] <= begins[num_query_vector - 1]) {
+    return false;
+  }
+
+  // Only a few rows of scores are kept since the local path candidates refer
+  // to recent rows.
+  int num_row(1);
+  for (int k(0); k < num_candidate; ++k) {
+    num_row = std::max(num_row, local_path_candidates_[k].first + 1);
+  }
+  std::vector<double> scores(num_row * num_reference_vector);
+  std::vector<double> scores_for_skip_transition(
+      includes_skip_transition_ ? num_row * num_reference_vector : 0);
+
+  // Back pointers are stored as indices of local path candidates in the flat
+  // layout containing only the cells inside the band.
+  const bool requires_viterbi_path(NULL != viterbi_path);
+  std::vector<std::size_t> offsets;
+  std::vector<signed char> back_pointers;
+  std::vector<signed char> back_pointers_for_skip_transition;
+  if (requires_viterbi_path) {
+    offsets.resize(num_query_vector + 1);
+    offsets[0] = 0;
+    for (int i(0); i < num_query_vector; ++i) {
+      offsets[i + 1] = offsets[i] + std::max(0, ends[i] - begins[i]);
+    }
+    back_pointers.resize(offsets[num_query_vector]);
+    if (includes_skip_transition_) {
+      back_pointers_for_skip_transition.resize(offsets[num_query_vector]);
+    }
+  }
 
   for (int i(0); i < num_query_vector; ++i) {
-    for (int j(0); j < num_reference_vector; ++j) {
+    double* score_i(&(scores[(i % num_row) * num_reference_vector]));
+    double* score_for_skip_transition_i(
+        includes_skip_transition_
+            ? &(scores_for_skip_transition[(i % num_row) *
+                                           num_reference_vector])
+            : NULL);
+
+    for (int j(begins[i]); j < ends[i]; ++j) {
       double local_distance;
       if (!distance_calculation_.Run(query_vector_sequence[i],
                                      reference_vector_sequence[j],
@@ -133,76 +226,77 @@ bool DynamicTimeWarping::Run(
 
       double best_score_of_all_paths((0 == i && 0 == j) ? local_distance
                                                         : DBL_MAX);
-      int best_i_of_all_paths(-1), best_j_of_all_paths(-1);
+      signed char best_k_of_all_paths(kNoBackPointer);
 
       double best_score_of_diagonal_paths(DBL_MAX);
-      int best_i_of_diagonal_paths(-1), best_j_of_diagonal_paths(-1);
+      signed char best_k_of_diagonal_paths(kNoBackPointer);
 
       for (int k(0); k < num_candidate; ++k) {
         const int i_k(i - local_path_candidates_[k].first);
         const int j_k(j - local_path_candidates_[k].second);
-        if (0 <= i_k && 0 <= j_k) {
+        if (0 <= i_k && begins[i_k] <= j_k && j_k < ends[i_k]) {
+          const int index((i_k % num_row) * num_reference_vector + j_k);
           double score;
           if (includes_skip_transition_ && (i_k == i || j_k == j)) {
             score = local_path_weights_[k] * local_distance +
-                    cell_for_skip_transition[i_k][j_k].score;
+                    scores_for_skip_transition[index];
           } else {
-            score =
-                local_path_weights_[k] * local_distance + cell[i_k][j_k].score;
+            score = local_path_weights_[k] * local_distance + scores[index];
           }
 
           if (includes_skip_transition_ && (i_k != i && j_k != j) &&
               score < best_score_of_diagonal_paths) {
             best_score_of_diagonal_paths = score;
-            best_i_of_diagonal_paths = i_k;
-            best_j_of_diagonal_paths = j_k;
+            best_k_of_diagonal_paths = static_cast<signed char>(k);
           }
           if (score < best_score_of_all_paths) {
             best_score_of_all_paths = score;
-            best_i_of_all_paths = i_k;
-            best_j_of_all_paths = j_k;
+            best_k_of_all_paths = static_cast<signed char>(k);
           }
         }
       }
 
       if (includes_skip_transition_) {
-        cell_for_skip_transition[i][j].score = best_score_of_diagonal_paths;
-        cell_for_skip_transition[i][j].horizontal_back_pointer =
-            best_i_of_diagonal_paths;
-        cell_for_skip_transition[i][j].vertical_back_pointer =
-            best_j_of_diagonal_paths;
+        score_for_skip_transition_i[j] = best_score_of_diagonal_paths;
+      }
+      score_i[j] = best_score_of_all_paths;
+
+      if (requires_viterbi_path) {
+        const std::size_t index(offsets[i] + j - begins[i]);
+        if (includes_skip_transition_) {
+          back_pointers_for_skip_transition[index] = best_k_of_diagonal_paths;
+        }
+        back_pointers[index] = best_k_of_all_paths;
       }
-      cell[i][j].score = best_score_of_all_paths;
-      cell[i][j].horizontal_back_pointer = best_i_of_all_paths;
-      cell[i][j].vertical_back_pointer = best_j_of_all_paths;
     }
   }
 
-  if (DBL_MAX == cell[num_query_vector - 1][num_reference_vector - 1].score) {
+  const double final_score(
+      scores[((num_query_vector - 1) % num_row) * num_reference_vector +
+             num_reference_vector - 1]);
+  if (DBL_MAX == final_score) {
     return false;
   }
 
-  *total_score = cell[num_query_vector - 1][num_reference_vector - 1].score /
-                 (num_query_vector + num_reference_vector);
+  *total_score = final_score / (num_query_vector + num_reference_vector);
 
-  {
+  if (requires_viterbi_path) {
     bool skip_transition(false);
     int i(num_query_vector - 1);
     int j(num_reference_vector - 1);
     viterbi_path->clear();
     viterbi_path->emplace_back(i, j);
     while (0 <= i && 0 <= j) {
-      const int prev_i(
-          (includes_skip_transition_ && skip_transition)
-              ? cell_for_skip_transition[i][j].horizontal_back_pointer
-              : cell[i][j].horizontal_back_pointer);
-      const int prev_j(
-          (includes_skip_transition_ && skip_transition)
-              ? cell_for_skip_transition[i][j].vertical_back_pointer
-              : cell[i][j].vertical_back_pointer);
-      if (0 <= prev_i && 0 <= prev_j) {
-        viterbi_path->emplace_back(prev_i, prev_j);
+      const std::size_t index(offsets[i] + j - begins[i]);
+      const int k((includes_skip_transition_ && skip_transition)
+                      ? back_pointers_for_skip_transition[index]
+                      : back_pointers[index]);
+      if (kNoBackPointer == k) {
+        break;
       }
+      const int prev_i(i - local_path_candidates_[k].first);
+      const int prev_j(j - local_path_candidates_[k].second);
+      viterbi_path->emplace_back(prev_i, prev_j);
       skip_transition = (prev_i == i || prev_j == j) ? true : false;
       i = prev_i;
       j = prev_j;
@@ -213,4 +307,46 @@ bool DynamicTimeWarping::Run(
   return true;
 }
 
+void DynamicTimeWarping::CalculateBand(int num_query_vector,
+                                       int num_reference_vector,
+                                       std::vector<int>* begins,
+                                       std::vector<int>* ends) const {
+  begins->resize(num_query_vector);
+  ends->resize(num_query_vector);
+
+  const int last_i(num_query_vector - 1);
+  const int last_j(num_reference_vector - 1);
+  const double end_of_row(last_j);
+  for (int i(0); i < num_query_vector; ++i) {
+    double begin(0.0);
+    double end(end_of_row);
+    switch (global_path_constraint_) {
+      case kUnconstrained: {
+        break;
+      }
+      case kSakoeChibaBand: {
+        const double center(
+            0 == last_i ? 0.0 : static_cast<double>(i) * last_j / last_i);
+        begin = std::ceil(center - window_width_ - kEpsilon);
+        end = std::floor(center + window_width_ + kEpsilon);
+        break;
+      }
+      case kItakuraParallelogram: {
+        begin = std::max(
+            std::ceil(i / maximum_slope_ - kEpsilon),
+            last_j - std::floor(maximum_slope_ * (last_i - i) + kEpsilon));
+        end = std::min(
+            std::floor(maximum_slope_ * i + kEpsilon),
+            last_j - std::ceil((last_i - i) / maximum_slope_ - kEpsilon));
+        break;
+      }
+      default: {
+        break;
+      }
+    }
+    (*begins)[i] = static_cast<int>(std::max(begin, 0.0));
+    (*ends)[i] = static_cast<int>(std::min(end, end_of_row)) + 1;
+  }
+}
+
 }  // namespace sptk
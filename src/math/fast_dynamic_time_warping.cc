@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/math/fast_dynamic_time_warping.h"
+
+#include <algorithm>  // std::max, std::min
+
+namespace {
+
+// Halve the length of vector sequence by averaging adjacent vectors.
+void Downsample(const std::vector<std::vector<double> >& input_sequence,
+                std::vector<std::vector<double> >* output_sequence) {
+  const int input_length(static_cast<int>(input_sequence.size()));
+  const int output_length((input_length + 1) / 2);
+  output_sequence->resize(output_length);
+  for (int t(0); t < output_length; ++t) {
+    const std::vector<double>& x0(input_sequence[2 * t]);
+    std::vector<double>& y((*output_sequence)[t]);
+    if (2 * t + 1 < input_length) {
+      const std::vector<double>& x1(input_sequence[2 * t + 1]);
+      const int length(static_cast<int>(x0.size()));
+      y.resize(length);
+      for (int m(0); m < length; ++m) {
+        y[m] = 0.5 * (x0[m] + x1[m]);
+      }
+    } else {
+      y = x0;
+    }
+  }
+}
+
+// Expand the coarse Viterbi path by the given radius and project it onto the
+// finer resolution.
+void Project(const std::vector<std::pair<int, int> >& coarse_viterbi_path,
+             int num_query_vector, int num_reference_vector, int radius,
+             std::vector<int>* begins, std::vector<int>* ends) {
+  const int num_coarse_query_vector((num_query_vector + 1) / 2);
+  const int num_coarse_reference_vector((num_reference_vector + 1) / 2);
+
+  std::vector<int> path_begins(num_coarse_query_vector,
+                               num_coarse_reference_vector);
+  std::vector<int> path_ends(num_coarse_query_vector, 0);
+  for (std::vector<std::pair<int, int> >::const_iterator itr(
+           coarse_viterbi_path.begin());
+       itr != coarse_viterbi_path.end(); ++itr) {
+    path_begins[itr->first] = std::min(path_begins[itr->first], itr->second);
+    path_ends[itr->first] = std::max(path_ends[itr->first], itr->second + 1);
+  }
+
+  // Bridge rows skipped by the coarse path.
+  for (int i(1); i < num_coarse_query_vector; ++i) {
+    if (path_ends[i] <= path_begins[i]) {
+      int k(i + 1);
+      while (k < num_coarse_query_vector && path_ends[k] <= path_begins[k]) {
+        ++k;
+      }
+      const int next_begin(k < num_coarse_query_vector
+                               ? path_begins[k]
+                               : num_coarse_reference_vector - 1);
+      path_begins[i] = path_ends[i - 1] - 1;
+      path_ends[i] = std::max(next_begin + 1, path_ends[i - 1]);
+    }
+  }
+
+  begins->resize(num_query_vector);
+  ends->resize(num_query_vector);
+  for (int i(0); i < num_coarse_query_vector; ++i) {
+    int begin(path_begins[i]);
+    int end(path_ends[i]);
+    for (int k(std::max(0, i - radius));
+         k <= std::min(num_coarse_query_vector - 1, i + radius); ++k) {
+      begin = std::min(begin, path_begins[k]);
+      end = std::max(end, path_ends[k]);
+    }
+    begin = std::max(0, begin - radius);
+    end = std::min(num_coarse_reference_vector, end + radius);
+
+    // Each coarse cell covers 2x2 cells at the finer resolution.
+    for (int j(2 * i); j < std::min(2 * i + 2, num_query_vector); ++j) {
+      (*begins)[j] = 2 * begin;
+      (*ends)[j] = std::min(num_reference_vector, 2 * end);
+    }
+  }
+}
+
+}  // namespace
+
+namespace sptk {
+
+FastDynamicTimeWarping::FastDynamicTimeWarping(
+    int num_order,
+    DynamicTimeWarping::LocalPathConstraints local_path_constraint,
+    DistanceCalculation::DistanceMetrics distance_metric, int radius)
+    : num_order_(num_order),
+      radius_(radius),
+      dynamic_time_warping_(num_order_, local_path_constraint,
+                            distance_metric),
+      is_valid_(true) {
+  if (num_order_ < 0 || radius_ < 0 || !dynamic_time_warping_.IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool FastDynamicTimeWarping::Run(
+    const std::vector<std::vector<double> >& query_vector_sequence,
+    const std::vector<std::vector<double> >& reference_vector_sequence,
+    std::vector<std::pair<int, int> >* viterbi_path,
+    double* total_score) const {
+  // Check inputs.
+  if (!is_valid_ || query_vector_sequence.empty() ||
+      reference_vector_sequence.empty() || NULL == total_score) {
+    return false;
+  }
+
+  const int num_query_vector(static_cast<int>(query_vector_sequence.size()));
+  const int num_reference_vector(
+      static_cast<int>(reference_vector_sequence.size()));
+
+  // Perform exact DTW if the sequences are short enough.
+  const int min_length(radius_ + 2);
+  if (num_query_vector <= min_length || num_reference_vector <= min_length) {
+    return dynamic_time_warping_.Run(query_vector_sequence,
+                                     reference_vector_sequence, viterbi_path,
+                                     total_score);
+  }
+
+  // Find Viterbi path at the coarser resolution.
+  std::vector<std::pair<int, int> > coarse_viterbi_path;
+  {
+    std::vector<std::vector<double> > coarse_query_vector_sequence;
+    std::vector<std::vector<double> > coarse_reference_vector_sequence;
+    Downsample(query_vector_sequence, &coarse_query_vector_sequence);
+    Downsample(reference_vector_sequence, &coarse_reference_vector_sequence);
+    double coarse_total_score;
+    if (!Run(coarse_query_vector_sequence, coarse_reference_vector_sequence,
+             &coarse_viterbi_path, &coarse_total_score)) {
+      coarse_viterbi_path.clear();
+    }
+  }
+
+  // Refine the path inside the projected window.
+  if (!coarse_viterbi_path.empty()) {
+    std::vector<int> begins;
+    std::vector<int> ends;
+    Project(coarse_viterbi_path, num_query_vector, num_reference_vector,
+            radius_, &begins, &ends);
+    if (dynamic_time_warping_.Run(query_vector_sequence,
+                                  reference_vector_sequence, begins, ends,
+                                  viterbi_path, total_score)) {
+      return true;
+    }
+  }
+
+  // Fall back to exact DTW if the local path constraint can not be satisfied
+  // inside the window.
+  return dynamic_time_warping_.Run(query_vector_sequence,
+                                   reference_vector_sequence, viterbi_path,
+                                   total_score);
+}
+
+}  // namespace sptk
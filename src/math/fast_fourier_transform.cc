@@ -17,7 +17,7 @@
 #include "SPTK/math/fast_fourier_transform.h"
 
 #include <algorithm>  // std::copy, std::fill
-#include <cmath>      // std::sin
+#include <cmath>      // std::cos, std::sin
 #include <cstddef>    // std::size_t
 
 namespace sptk {
@@ -37,13 +37,34 @@ FastFourierTransform::FastFourierTransform(int num_order, int fft_length)
     return;
   }
 
-  const int table_size(fft_length_ - fft_length_ / 4 + 1);
-  const double argument(sptk::kPi / fft_length_ * 2);
-  sine_table_.resize(table_size);
-  for (int i(0); i < table_size; ++i) {
-    sine_table_[i] = std::sin(argument * i);
+  // Make twiddle factor table. Each radix-4 stage has six contiguous blocks:
+  // cos(w), sin(w), cos(2w), sin(2w), cos(3w), and sin(3w).
+  for (int lmx(half_fft_length_); 2 <= lmx; lmx /= 4) {
+    const int quarter_length(lmx / 2);
+    const double argument(sptk::kPi / lmx);
+    for (int k(1); k <= 3; ++k) {
+      for (int i(0); i < quarter_length; ++i) {
+        twiddle_factor_table_.push_back(std::cos(argument * k * i));
+      }
+      for (int i(0); i < quarter_length; ++i) {
+        twiddle_factor_table_.push_back(std::sin(argument * k * i));
+      }
+    }
+  }
+
+  // Make bit reversal table as pairs of indices to be swapped.
+  for (int i(0), j(0); i < fft_length_ - 1; ++i) {
+    if (i < j) {
+      bit_reversal_table_.push_back(i);
+      bit_reversal_table_.push_back(j);
+    }
+    int k(half_fft_length_);
+    while (k <= j) {
+      j -= k;
+      k /= 2;
+    }
+    j += k;
   }
-  sine_table_[fft_length_ / 2] = 0.0;
 }
 
 bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
@@ -79,36 +100,67 @@ bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
   double* x(&((*real_part_output)[0]));
   double* y(&((*imag_part_output)[0]));
 
+  // Radix-4 butterflies. The inner loop runs over contiguous memory so that
+  // it can be vectorized by compilers.
+  int lmx(half_fft_length_);
   {
-    int lix(fft_length_);
-    int lmx(half_fft_length_);
-    int lf(1);
-    while (1 < lmx) {
-      const double* sinp(&(sine_table_[0]));
-      const double* cosp(&(sine_table_[0]) + fft_length_ / 4);
-      for (int i(0); i < lmx; ++i) {
-        double* xpi(&(x[i]));
-        double* ypi(&(y[i]));
-        for (int li(lix); li <= fft_length_; li += lix) {
-          const double t1(*(xpi) - *(xpi + lmx));
-          const double t2(*(ypi) - *(ypi + lmx));
-          *(xpi) += *(xpi + lmx);
-          *(ypi) += *(ypi + lmx);
-          *(xpi + lmx) = *cosp * t1 + *sinp * t2;
-          *(ypi + lmx) = *cosp * t2 - *sinp * t1;
-          xpi += lix;
-          ypi += lix;
+    const double* table(twiddle_factor_table_.empty()
+                            ? NULL
+                            : &(twiddle_factor_table_[0]));
+    for (; 2 <= lmx; lmx /= 4) {
+      const int lix(2 * lmx);
+      const int quarter_length(lmx / 2);
+      const double* cos1(table);
+      const double* sin1(cos1 + quarter_length);
+      const double* cos2(sin1 + quarter_length);
+      const double* sin2(cos2 + quarter_length);
+      const double* cos3(sin2 + quarter_length);
+      const double* sin3(cos3 + quarter_length);
+      table += 6 * quarter_length;
+
+      for (int li(0); li < fft_length_; li += lix) {
+        double* x0(x + li);
+        double* y0(y + li);
+        double* x1(x0 + quarter_length);
+        double* y1(y0 + quarter_length);
+        double* x2(x1 + quarter_length);
+        double* y2(y1 + quarter_length);
+        double* x3(x2 + quarter_length);
+        double* y3(y2 + quarter_length);
+        for (int i(0); i < quarter_length; ++i) {
+          const double ar(x0[i] + x2[i]);
+          const double ai(y0[i] + y2[i]);
+          const double br(x0[i] - x2[i]);
+          const double bi(y0[i] - y2[i]);
+          const double cr(x1[i] + x3[i]);
+          const double ci(y1[i] + y3[i]);
+          const double dr(x1[i] - x3[i]);
+          const double di(y1[i] - y3[i]);
+
+          x0[i] = ar + cr;
+          y0[i] = ai + ci;
+
+          const double t1(ar - cr);
+          const double t2(ai - ci);
+          x1[i] = cos2[i] * t1 + sin2[i] * t2;
+          y1[i] = cos2[i] * t2 - sin2[i] * t1;
+
+          const double t3(br + di);
+          const double t4(bi - dr);
+          x2[i] = cos1[i] * t3 + sin1[i] * t4;
+          y2[i] = cos1[i] * t4 - sin1[i] * t3;
+
+          const double t5(br - di);
+          const double t6(bi + dr);
+          x3[i] = cos3[i] * t5 + sin3[i] * t6;
+          y3[i] = cos3[i] * t6 - sin3[i] * t5;
         }
-        sinp += lf;
-        cosp += lf;
       }
-      lix = lmx;
-      lmx /= 2;
-      lf *= 2;
     }
   }
 
-  {
+  // Radix-2 butterflies if the FFT length is not a power of four.
+  if (1 == lmx) {
     double* xp(x);
     double* yp(y);
     for (int li(0); li < half_fft_length_; ++li) {
@@ -125,28 +177,16 @@ bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
 
   // Bit reversal.
   {
-    double* xp(x);
-    double* yp(y);
-    const int dec_fft_length(fft_length_ - 1);
-    for (int lmx(0), j(0); lmx < dec_fft_length; ++lmx) {
-      const int lmxj(lmx - j);
-      if (lmxj < 0) {
-        const double t1(*(xp));
-        const double t2(*(yp));
-        *(xp) = *(xp + lmxj);
-        *(yp) = *(yp + lmxj);
-        *(xp + lmxj) = t1;
-        *(yp + lmxj) = t2;
-      }
-
-      int li(half_fft_length_);
-      while (li <= j) {
-        j -= li;
-        li /= 2;
-      }
-      j += li;
-      xp = x + j;
-      yp = y + j;
+    const int table_size(static_cast<int>(bit_reversal_table_.size()));
+    for (int k(0); k < table_size; k += 2) {
+      const int i(bit_reversal_table_[k]);
+      const int j(bit_reversal_table_[k + 1]);
+      const double t1(x[i]);
+      const double t2(y[i]);
+      x[i] = x[j];
+      y[i] = y[j];
+      x[j] = t1;
+      y[j] = t2;
     }
   }
 
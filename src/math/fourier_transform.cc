@@ -16,8 +16,8 @@
 
 #include "SPTK/math/fourier_transform.h"
 
-#include "SPTK/math/discrete_fourier_transform.h"
 #include "SPTK/math/fast_fourier_transform.h"
+#include "SPTK/math/mixed_radix_fast_fourier_transform.h"
 
 namespace {
 
@@ -39,16 +39,20 @@ class FastFourierTransformWrapper
     return fast_fourier_tranform_.IsValid();
   }
 
+  virtual Buffer* CreateBuffer() const {
+    return new Buffer();
+  }
+
   virtual bool Run(const std::vector<double>& real_part_input,
                    const std::vector<double>& imag_part_input,
                    std::vector<double>* real_part_output,
-                   std::vector<double>* imag_part_output) const {
+                   std::vector<double>* imag_part_output, Buffer*) const {
     return fast_fourier_tranform_.Run(real_part_input, imag_part_input,
                                       real_part_output, imag_part_output);
   }
 
   virtual bool Run(std::vector<double>* real_part,
-                   std::vector<double>* imag_part) const {
+                   std::vector<double>* imag_part, Buffer*) const {
     return fast_fourier_tranform_.Run(real_part, imag_part);
   }
 
@@ -58,41 +62,73 @@ class FastFourierTransformWrapper
   DISALLOW_COPY_AND_ASSIGN(FastFourierTransformWrapper);
 };
 
-class DiscreteFourierTransformWrapper
+class MixedRadixFastFourierTransformWrapper
     : public sptk::FourierTransform::FourierTransformInterface {
  public:
-  explicit DiscreteFourierTransformWrapper(int dft_length)
-      : discrete_fourier_tranform_(dft_length) {
+  class MixedRadixBuffer : public Buffer {
+   public:
+    MixedRadixBuffer() {
+    }
+
+    virtual ~MixedRadixBuffer() {
+    }
+
+   private:
+    sptk::MixedRadixFastFourierTransform::Buffer buffer_;
+
+    friend class MixedRadixFastFourierTransformWrapper;
+    DISALLOW_COPY_AND_ASSIGN(MixedRadixBuffer);
+  };
+
+  explicit MixedRadixFastFourierTransformWrapper(int fft_length)
+      : fast_fourier_transform_(fft_length) {
   }
 
-  virtual ~DiscreteFourierTransformWrapper() {
+  virtual ~MixedRadixFastFourierTransformWrapper() {
   }
 
   virtual int GetLength() const {
-    return discrete_fourier_tranform_.GetDftLength();
+    return fast_fourier_transform_.GetFftLength();
   }
 
   virtual bool IsValid() const {
-    return discrete_fourier_tranform_.IsValid();
+    return fast_fourier_transform_.IsValid();
+  }
+
+  virtual Buffer* CreateBuffer() const {
+    return new MixedRadixBuffer();
   }
 
   virtual bool Run(const std::vector<double>& real_part_input,
                    const std::vector<double>& imag_part_input,
                    std::vector<double>* real_part_output,
-                   std::vector<double>* imag_part_output) const {
-    return discrete_fourier_tranform_.Run(real_part_input, imag_part_input,
-                                          real_part_output, imag_part_output);
+                   std::vector<double>* imag_part_output,
+                   Buffer* buffer) const {
+    MixedRadixBuffer* mixed_radix_buffer(
+        dynamic_cast<MixedRadixBuffer*>(buffer));
+    if (NULL == mixed_radix_buffer) {
+      return false;
+    }
+    return fast_fourier_transform_.Run(real_part_input, imag_part_input,
+                                       real_part_output, imag_part_output,
+                                       &mixed_radix_buffer->buffer_);
   }
 
   virtual bool Run(std::vector<double>* real_part,
-                   std::vector<double>* imag_part) const {
-    return discrete_fourier_tranform_.Run(real_part, imag_part);
+                   std::vector<double>* imag_part, Buffer* buffer) const {
+    MixedRadixBuffer* mixed_radix_buffer(
+        dynamic_cast<MixedRadixBuffer*>(buffer));
+    if (NULL == mixed_radix_buffer) {
+      return false;
+    }
+    return fast_fourier_transform_.Run(real_part, imag_part,
+                                       &mixed_radix_buffer->buffer_);
   }
 
  private:
-  const sptk::DiscreteFourierTransform discrete_fourier_tranform_;
+  const sptk::MixedRadixFastFourierTransform fast_fourier_transform_;
 
-  DISALLOW_COPY_AND_ASSIGN(DiscreteFourierTransformWrapper);
+  DISALLOW_COPY_AND_ASSIGN(MixedRadixFastFourierTransformWrapper);
 };
 
 }  // namespace
@@ -103,7 +139,7 @@ FourierTransform::FourierTransform(int length) {
   if (sptk::IsPowerOfTwo(length)) {
     fourier_transform_ = new FastFourierTransformWrapper(length);
   } else {
-    fourier_transform_ = new DiscreteFourierTransformWrapper(length);
+    fourier_transform_ = new MixedRadixFastFourierTransformWrapper(length);
   }
 }
 
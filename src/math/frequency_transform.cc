@@ -16,9 +16,20 @@
 
 #include "SPTK/math/frequency_transform.h"
 
-#include <algorithm>  // std::copy, std::fill
+#include <algorithm>  // std::copy, std::fill, std::min
 #include <cstddef>    // std::size_t
 
+namespace {
+
+// The conversion matrix is not precomputed if the number of its elements is
+// larger than this value.
+const int kMaxConversionMatrixSize(1 << 20);
+
+// The number of sequences transformed with one sweep of the conversion matrix.
+const int kBlockSize(64);
+
+}  // namespace
+
 namespace sptk {
 
 FrequencyTransform::FrequencyTransform(int num_input_order,
@@ -32,6 +43,31 @@ FrequencyTransform::FrequencyTransform(int num_input_order,
     is_valid_ = false;
     return;
   }
+
+  const int input_length(num_input_order_ + 1);
+  const int output_length(num_output_order_ + 1);
+  if (0.0 == alpha_ ||
+      kMaxConversionMatrixSize / output_length < input_length) {
+    return;
+  }
+
+  // Apply the recursion with zero input to the unit vector.
+  const double beta(1.0 - alpha_ * alpha_);
+  conversion_matrix_.resize(input_length);
+  conversion_matrix_[0].resize(output_length, 0.0);
+  conversion_matrix_[0][0] = 1.0;
+  for (int m1(1); m1 < input_length; ++m1) {
+    const double* d(&(conversion_matrix_[m1 - 1][0]));
+    conversion_matrix_[m1].resize(output_length);
+    double* g(&(conversion_matrix_[m1][0]));
+    g[0] = alpha_ * d[0];
+    if (1 <= num_output_order_) {
+      g[1] = beta * d[0] + alpha_ * d[1];
+    }
+    for (int m2(2); m2 <= num_output_order_; ++m2) {
+      g[m2] = d[m2 - 1] + alpha_ * (d[m2] - g[m2 - 1]);
+    }
+  }
 }
 
 bool FrequencyTransform::Run(const std::vector<double>& minimum_phase_sequence,
@@ -71,6 +107,19 @@ bool FrequencyTransform::Run(const std::vector<double>& minimum_phase_sequence,
 
   std::fill(warped_sequence->begin(), warped_sequence->end(), 0.0);
 
+  if (!conversion_matrix_.empty()) {
+    const double* c(&(minimum_phase_sequence[0]));
+    double* g(&((*warped_sequence)[0]));
+    for (int m1(0); m1 <= num_input_order_; ++m1) {
+      const double* a(&(conversion_matrix_[m1][0]));
+      const double x(c[m1]);
+      for (int m2(0); m2 < output_length; ++m2) {
+        g[m2] += x * a[m2];
+      }
+    }
+    return true;
+  }
+
   const double beta(1.0 - alpha_ * alpha_);
   const double* c(&(minimum_phase_sequence[0]));
   double* d(&buffer->d_[0]);
@@ -93,4 +142,62 @@ bool FrequencyTransform::Run(const std::vector<double>& minimum_phase_sequence,
   return true;
 }
 
+bool FrequencyTransform::RunBatch(const Matrix& minimum_phase_sequences,
+                                  Matrix* warped_sequences,
+                                  FrequencyTransform::Buffer* buffer) const {
+  // Check inputs.
+  const int input_length(num_input_order_ + 1);
+  if (!is_valid_ || minimum_phase_sequences.GetNumColumn() != input_length ||
+      NULL == warped_sequences ||
+      &minimum_phase_sequences == warped_sequences || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_sequence(minimum_phase_sequences.GetNumRow());
+  const int output_length(num_output_order_ + 1);
+  if (warped_sequences->GetNumRow() != num_sequence ||
+      warped_sequences->GetNumColumn() != output_length) {
+    warped_sequences->Resize(num_sequence, output_length);
+  }
+
+  if (conversion_matrix_.empty()) {
+    if (buffer->input_.size() != static_cast<std::size_t>(input_length)) {
+      buffer->input_.resize(input_length);
+    }
+    for (int t(0); t < num_sequence; ++t) {
+      std::copy(minimum_phase_sequences[t],
+                minimum_phase_sequences[t] + input_length,
+                buffer->input_.begin());
+      if (!Run(buffer->input_, &buffer->output_, buffer)) {
+        return false;
+      }
+      std::copy(buffer->output_.begin(), buffer->output_.end(),
+                (*warped_sequences)[t]);
+    }
+    return true;
+  }
+
+  // Sweep the conversion matrix once for each block of sequences.
+  for (int begin(0); begin < num_sequence; begin += kBlockSize) {
+    const int end(std::min(begin + kBlockSize, num_sequence));
+    for (int t(begin); t < end; ++t) {
+      std::fill((*warped_sequences)[t], (*warped_sequences)[t] + output_length,
+                0.0);
+    }
+    for (int m1(0); m1 < input_length; ++m1) {
+      const double* a(&(conversion_matrix_[m1][0]));
+      for (int t(begin); t < end; ++t) {
+        const double x(minimum_phase_sequences[t][m1]);
+        double* g((*warped_sequences)[t]);
+        for (int m2(0); m2 < output_length; ++m2) {
+          g[m2] += x * a[m2];
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
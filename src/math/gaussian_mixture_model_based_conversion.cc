@@ -132,25 +132,35 @@ bool GaussianMixtureModelBasedConversion::Run(
 
   // Compute posterior probabilities of source input.
   {
-    std::vector<double> components_of_log_probability(num_mixture_);
-    GaussianMixtureModeling::Buffer buffer;
+    std::vector<int> frame_indices;
+    std::vector<std::vector<double> > valid_source_vectors;
+    frame_indices.reserve(sequence_length);
+    valid_source_vectors.reserve(sequence_length);
     for (int t(0); t < sequence_length; ++t) {
       if (use_magic_number_ && magic_number_ == source_vectors[t][0]) {
         continue;
       }
+      frame_indices.push_back(t);
+      valid_source_vectors.push_back(source_vectors[t]);
+    }
 
-      if (!GaussianMixtureModeling::CalculateLogProbability(
-              source_length_ - 1, num_mixture_, false, 0 == t,
-              source_vectors[t], weights_, source_mean_vectors_,
-              source_covariance_matrices_, &components_of_log_probability, NULL,
-              &buffer)) {
-        return false;
-      }
+    std::vector<std::vector<double> > components_of_log_probability;
+    GaussianMixtureModeling::Buffer buffer;
+    if (!GaussianMixtureModeling::CalculateLogProbability(
+            source_length_ - 1, num_mixture_, false, true,
+            valid_source_vectors, weights_, source_mean_vectors_,
+            source_covariance_matrices_, &components_of_log_probability, NULL,
+            &buffer)) {
+      return false;
+    }
 
+    const int num_valid_frame(static_cast<int>(frame_indices.size()));
+    for (int i(0); i < num_valid_frame; ++i) {
+      const int t(frame_indices[i]);
+      const std::vector<double>& components(components_of_log_probability[i]);
       const int selected_mixture(static_cast<int>(
-          std::max_element(components_of_log_probability.begin(),
-                           components_of_log_probability.end()) -
-          components_of_log_probability.begin()));
+          std::max_element(components.begin(), components.end()) -
+          components.begin()));
 
       // Set E.
       for (int l(0); l < target_length_; ++l) {
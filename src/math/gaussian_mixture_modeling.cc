@@ -16,9 +16,9 @@
 
 #include "SPTK/math/gaussian_mixture_modeling.h"
 
-#include <algorithm>  // std::fill, std::transform
+#include <algorithm>  // std::fill, std::max, std::min, std::transform
 #include <cfloat>     // DBL_MAX
-#include <cmath>      // std::exp, std::log
+#include <cmath>      // std::exp, std::log, std::sqrt
 #include <cstddef>    // std::size_t
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::endl
@@ -26,6 +26,7 @@
 
 #include "SPTK/compression/linde_buzo_gray_algorithm.h"
 #include "SPTK/math/statistics_accumulation.h"
+#include "SPTK/utils/parallel_frame_executor.h"
 
 namespace {
 
@@ -54,6 +55,83 @@ bool CheckGmm(int num_mixture, int length, const std::vector<double>& weights,
   return true;
 }
 
+// Number of input vectors processed at once.
+const int kBlockSize(64);
+
+// Compute weighted log-probabilities of each mixture component. The input
+// vectors are stored as x[l * kBlockSize + t] and the results are stored as
+// p[k * kBlockSize + t].
+void CalculateComponentsOfBlock(
+    int length, int num_mixture, bool is_diagonal, int block_size,
+    const double* x, const std::vector<double>& gconsts,
+    const std::vector<std::vector<double> >& cholesky_factors,
+    const std::vector<std::vector<double> >& transformed_mean_vectors,
+    double* z, double* p) {
+  for (int k(0); k < num_mixture; ++k) {
+    const double* a(&(cholesky_factors[k][0]));
+    const double* b(&(transformed_mean_vectors[k][0]));
+    double* p_k(p + k * kBlockSize);
+    std::fill(p_k, p_k + block_size, 0.0);
+
+    if (is_diagonal) {
+      for (int l(0); l < length; ++l) {
+        const double a_l(a[l]);
+        const double b_l(b[l]);
+        const double* x_l(x + l * kBlockSize);
+        for (int t(0); t < block_size; ++t) {
+          const double d(a_l * x_l[t] - b_l);
+          p_k[t] += d * d;
+        }
+      }
+    } else {
+      // The lower triangular factor is packed in row-major order.
+      for (int l(0), offset(0); l < length; offset += ++l) {
+        std::fill(z, z + block_size, -b[l]);
+        for (int m(0); m <= l; ++m) {
+          const double a_lm(a[offset + m]);
+          const double* x_m(x + m * kBlockSize);
+          for (int t(0); t < block_size; ++t) {
+            z[t] += a_lm * x_m[t];
+          }
+        }
+        for (int t(0); t < block_size; ++t) {
+          p_k[t] += z[t] * z[t];
+        }
+      }
+    }
+
+    const double gconst(gconsts[k]);
+    for (int t(0); t < block_size; ++t) {
+      p_k[t] = gconst - 0.5 * p_k[t];
+    }
+  }
+}
+
+// Compute log-sum-exp over mixture components.
+void CalculateTotalOfBlock(int num_mixture, int block_size, const double* p,
+                           double* total) {
+  for (int t(0); t < block_size; ++t) {
+    total[t] = p[t];
+  }
+  for (int k(1); k < num_mixture; ++k) {
+    const double* p_k(p + k * kBlockSize);
+    for (int t(0); t < block_size; ++t) {
+      total[t] = std::max(total[t], p_k[t]);
+    }
+  }
+  for (int t(0); t < block_size; ++t) {
+    if (total[t] <= sptk::kLogZero) {
+      total[t] = sptk::kLogZero;
+      continue;
+    }
+    double sum(0.0);
+    for (int k(0); k < num_mixture; ++k) {
+      sum += std::exp(p[k * kBlockSize + t] - total[t]);
+    }
+    total[t] += std::log(sum);
+  }
+}
+
 }  // namespace
 
 namespace sptk {
@@ -65,7 +143,8 @@ GaussianMixtureModeling::GaussianMixtureModeling(
     InitializationType initialization_type, int log_interval,
     double smoothing_parameter, const std::vector<double>& ubm_weights,
     const std::vector<std::vector<double> >& ubm_mean_vectors,
-    const std::vector<SymmetricMatrix>& ubm_covariance_matrices)
+    const std::vector<SymmetricMatrix>& ubm_covariance_matrices,
+    int num_thread)
     : num_order_(num_order),
       num_mixture_(num_mixture),
       num_iteration_(num_iteration),
@@ -80,6 +159,7 @@ GaussianMixtureModeling::GaussianMixtureModeling(
       ubm_weights_(ubm_weights),
       ubm_mean_vectors_(ubm_mean_vectors),
       ubm_covariance_matrices_(ubm_covariance_matrices),
+      num_thread_(num_thread),
       is_diagonal_(kDiagonal == covariance_type_ && 1 == block_size_.size()),
       is_valid_(true) {
   if (num_order_ < 0 || num_mixture_ <= 0 ||
@@ -87,7 +167,8 @@ GaussianMixtureModeling::GaussianMixtureModeling(
       num_iteration_ <= 0 || convergence_threshold_ < 0.0 ||
       weight_floor_ < 0.0 || 1.0 / num_mixture_ < weight_floor_ ||
       variance_floor_ < 0.0 || log_interval <= 0 ||
-      smoothing_parameter_ < 0.0 || 1.0 < smoothing_parameter_) {
+      smoothing_parameter_ < 0.0 || 1.0 < smoothing_parameter_ ||
+      num_thread_ <= 0) {
     is_valid_ = false;
     return;
   }
@@ -200,62 +281,55 @@ bool GaussianMixtureModeling::Run(
     }
   }
 
-  // Prepare memories.
-  std::vector<double> buffer0(num_mixture_);
-  std::vector<std::vector<double> > buffer1(num_mixture_);
-  for (int k(0); k < num_mixture_; ++k) {
-    buffer1[k].resize(length);
-  }
-  std::vector<SymmetricMatrix> buffer2(num_mixture_);
-  for (int k(0); k < num_mixture_; ++k) {
-    buffer2[k].Resize(length);
+  // Prepare memories. Each thread has its own statistics.
+  const int num_data(static_cast<int>(input_vectors.size()));
+  const int num_thread(std::min(num_thread_, num_data));
+  std::vector<std::vector<double> > buffers0(num_thread);
+  std::vector<std::vector<std::vector<double> > > buffers1(num_thread);
+  std::vector<std::vector<SymmetricMatrix> > buffers2(num_thread);
+  for (int i(0); i < num_thread; ++i) {
+    buffers0[i].resize(num_mixture_);
+    buffers1[i].resize(num_mixture_);
+    buffers2[i].resize(num_mixture_);
+    for (int k(0); k < num_mixture_; ++k) {
+      buffers1[i][k].resize(length);
+      buffers2[i][k].Resize(length);
+    }
   }
-  GaussianMixtureModeling::Buffer buffer;
-  std::vector<double> numerators(num_mixture_);
+  std::vector<GaussianMixtureModeling::Buffer> buffers(num_thread);
+  std::vector<double> log_likelihoods(num_thread);
+
+  const std::vector<double>& buffer0(buffers0[0]);
+  const std::vector<std::vector<double> >& buffer1(buffers1[0]);
+  const std::vector<SymmetricMatrix>& buffer2(buffers2[0]);
+
+  // Each thread accumulates the statistics of a contiguous chunk of input
+  // vectors.
+  const auto job([&](int i, int begin, int end) {
+    return AccumulateStatistics(input_vectors, begin, end, *weights,
+                                *mean_vectors, *covariance_matrices,
+                                &(buffers0[i]), &(buffers1[i]), &(buffers2[i]),
+                                &(log_likelihoods[i]), &(buffers[i]));
+  });
 
   double prev_log_likelihood(-DBL_MAX);
 
   for (int n(1); n <= num_iteration_; ++n) {
-    // Clear buffers.
-    std::fill(buffer0.begin(), buffer0.end(), 0.0);
-    for (int k(0); k < num_mixture_; ++k) {
-      std::fill(buffer1[k].begin(), buffer1[k].end(), 0.0);
-      buffer2[k].Fill(0.0);
-    }
-    buffer.precomputed_ = false;
-
     // Perform E-step.
-    double log_likelihood(0.0);
-    const int num_data(static_cast<int>(input_vectors.size()));
-    for (int t(0); t < num_data; ++t) {
-      // Compute log-likelihood of data.
-      double denominator;
-      if (!CalculateLogProbability(num_order_, num_mixture_, is_diagonal_,
-                                   false, input_vectors[t], *weights,
-                                   *mean_vectors, *covariance_matrices,
-                                   &numerators, &denominator, &buffer)) {
-        return false;
-      }
-      log_likelihood += denominator;
+    if (!ParallelFrameExecutor::RunInChunks(num_data, num_thread, job)) {
+      return false;
+    }
 
-      const double* x(&(input_vectors[t][0]));
+    // Reduce statistics in a fixed order.
+    double log_likelihood(log_likelihoods[0]);
+    for (int i(1); i < num_thread; ++i) {
+      log_likelihood += log_likelihoods[i];
       for (int k(0); k < num_mixture_; ++k) {
-        const double posterior(std::exp(numerators[k] - denominator));
-
-        // Accumulate zeroth-order statistics.
-        buffer0[k] += posterior;
-
-        // Accumulate first-order statistics.
-        for (int l(0); l <= num_order_; ++l) {
-          buffer1[k][l] += posterior * x[l];
-        }
-
-        // Accumulate second-order statistics.
+        buffers0[0][k] += buffers0[i][k];
         for (int l(0); l <= num_order_; ++l) {
+          buffers1[0][k][l] += buffers1[i][k][l];
           for (int m(is_diagonal_ ? l : 0); m <= l; ++m) {
-            if (0.0 != mask_[l][m]) {
-              buffer2[k][l][m] += posterior * x[l] * x[m];
-            }
+            buffers2[0][k][l][m] += buffers2[i][k][l][m];
           }
         }
       }
@@ -353,6 +427,87 @@ bool GaussianMixtureModeling::Run(
   return true;
 }
 
+bool GaussianMixtureModeling::AccumulateStatistics(
+    const std::vector<std::vector<double> >& input_vectors, int begin, int end,
+    const std::vector<double>& weights,
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    std::vector<double>* buffer0, std::vector<std::vector<double> >* buffer1,
+    std::vector<SymmetricMatrix>* buffer2, double* log_likelihood,
+    GaussianMixtureModeling::Buffer* buffer) const {
+  // Clear buffers.
+  std::fill(buffer0->begin(), buffer0->end(), 0.0);
+  for (int k(0); k < num_mixture_; ++k) {
+    std::fill((*buffer1)[k].begin(), (*buffer1)[k].end(), 0.0);
+    (*buffer2)[k].Fill(0.0);
+  }
+  *log_likelihood = 0.0;
+
+  // Prepare memories.
+  if (!Precompute(num_order_, num_mixture_, is_diagonal_, weights,
+                  mean_vectors, covariance_matrices, buffer)) {
+    return false;
+  }
+  const int length(num_order_ + 1);
+  double* transposed_block(&(buffer->transposed_input_vectors_[0]));
+  double* numerators(&(buffer->components_[0]));
+  std::vector<double> denominators(kBlockSize);
+
+  for (int offset(begin); offset < end; offset += kBlockSize) {
+    const int block_size(std::min(kBlockSize, end - offset));
+
+    // Compute log-likelihood of data directly from the input vectors.
+    for (int t(0); t < block_size; ++t) {
+      const std::vector<double>& input_vector(input_vectors[offset + t]);
+      if (input_vector.size() != static_cast<std::size_t>(length)) {
+        return false;
+      }
+      for (int l(0); l < length; ++l) {
+        transposed_block[l * kBlockSize + t] = input_vector[l];
+      }
+    }
+    CalculateComponentsOfBlock(length, num_mixture_, is_diagonal_, block_size,
+                               transposed_block, buffer->gconsts_,
+                               buffer->cholesky_factors_,
+                               buffer->transformed_mean_vectors_,
+                               &(buffer->transformed_input_vector_[0]),
+                               numerators);
+    CalculateTotalOfBlock(num_mixture_, block_size, numerators,
+                          &(denominators[0]));
+
+    for (int t(0); t < block_size; ++t) {
+      *log_likelihood += denominators[t];
+
+      const double* x(&(input_vectors[offset + t][0]));
+      for (int k(0); k < num_mixture_; ++k) {
+        const double posterior(
+            std::exp(numerators[k * kBlockSize + t] - denominators[t]));
+
+        // Accumulate zeroth-order statistics.
+        (*buffer0)[k] += posterior;
+
+        // Accumulate first-order statistics.
+        double* b1(&((*buffer1)[k][0]));
+        for (int l(0); l <= num_order_; ++l) {
+          b1[l] += posterior * x[l];
+        }
+
+        // Accumulate second-order statistics.
+        SymmetricMatrix& b2((*buffer2)[k]);
+        for (int l(0); l <= num_order_; ++l) {
+          for (int m(is_diagonal_ ? l : 0); m <= l; ++m) {
+            if (0.0 != mask_[l][m]) {
+              b2[l][m] += posterior * x[l] * x[m];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 bool GaussianMixtureModeling::CalculateLogProbability(
     int num_order, int num_mixture, bool is_diagonal, bool check_size,
     const std::vector<double>& input_vector, const std::vector<double>& weights,
@@ -362,7 +517,7 @@ bool GaussianMixtureModeling::CalculateLogProbability(
     GaussianMixtureModeling::Buffer* buffer) {
   // Check inputs.
   const int length(num_order + 1);
-  if (num_mixture < 0 ||
+  if (num_mixture <= 0 ||
       input_vector.size() != static_cast<std::size_t>(length) ||
       NULL == buffer) {
     return false;
@@ -380,88 +535,225 @@ bool GaussianMixtureModeling::CalculateLogProbability(
           static_cast<std::size_t>(num_mixture)) {
     components_of_log_probability->resize(num_mixture);
   }
-  if (buffer->d_.size() != static_cast<std::size_t>(length)) {
-    buffer->d_.resize(length);
+  if (!buffer->precomputed_) {
+    if (!Precompute(num_order, num_mixture, is_diagonal, weights, mean_vectors,
+                    covariance_matrices, buffer)) {
+      return false;
+    }
   }
-  if (buffer->gconsts_.size() != static_cast<std::size_t>(num_mixture)) {
-    buffer->gconsts_.resize(num_mixture);
+
+  // Compute log probability of data as a block of one vector.
+  double* x(&(buffer->transposed_input_vectors_[0]));
+  for (int l(0); l < length; ++l) {
+    x[l * kBlockSize] = input_vector[l];
+  }
+  double* p(&(buffer->components_[0]));
+  CalculateComponentsOfBlock(length, num_mixture, is_diagonal, 1, x,
+                             buffer->gconsts_, buffer->cholesky_factors_,
+                             buffer->transformed_mean_vectors_,
+                             &(buffer->transformed_input_vector_[0]), p);
+
+  if (components_of_log_probability) {
+    for (int k(0); k < num_mixture; ++k) {
+      (*components_of_log_probability)[k] = p[k * kBlockSize];
+    }
+  }
+  if (log_probability) {
+    CalculateTotalOfBlock(num_mixture, 1, p, log_probability);
+  }
+
+  return true;
+}
+
+bool GaussianMixtureModeling::CalculateLogProbability(
+    int num_order, int num_mixture, bool is_diagonal, bool check_size,
+    const std::vector<std::vector<double> >& input_vectors,
+    const std::vector<double>& weights,
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    std::vector<std::vector<double> >* components_of_log_probability,
+    std::vector<double>* log_probability,
+    GaussianMixtureModeling::Buffer* buffer) {
+  // Check inputs.
+  const int length(num_order + 1);
+  if (num_mixture <= 0 || NULL == buffer) {
+    return false;
+  }
+  const int num_data(static_cast<int>(input_vectors.size()));
+  for (int t(0); t < num_data; ++t) {
+    if (input_vectors[t].size() != static_cast<std::size_t>(length)) {
+      return false;
+    }
   }
-  if (buffer->precisions_.size() != static_cast<std::size_t>(num_mixture)) {
-    buffer->precisions_.resize(num_mixture);
+
+  // Check size of GMM.
+  if (check_size && !CheckGmm(num_mixture, length, weights, mean_vectors,
+                              covariance_matrices)) {
+    return false;
   }
 
+  // Prepare memories.
+  if (components_of_log_probability) {
+    if (components_of_log_probability->size() !=
+        static_cast<std::size_t>(num_data)) {
+      components_of_log_probability->resize(num_data);
+    }
+    for (int t(0); t < num_data; ++t) {
+      if ((*components_of_log_probability)[t].size() !=
+          static_cast<std::size_t>(num_mixture)) {
+        (*components_of_log_probability)[t].resize(num_mixture);
+      }
+    }
+  }
+  if (log_probability &&
+      log_probability->size() != static_cast<std::size_t>(num_data)) {
+    log_probability->resize(num_data);
+  }
   if (!buffer->precomputed_) {
-    // Precompute constant of log likelihood without multiplying -0.5.
-    for (int k(0); k < num_mixture; ++k) {
-      double gconst(length * std::log(sptk::kTwoPi));
-      double log_determinant(0.0);
-      if (is_diagonal) {
-        for (int l(0); l <= num_order; ++l) {
-          log_determinant += std::log(covariance_matrices[k][l][l]);
-        }
-        gconst += log_determinant;
-      } else {
-        SymmetricMatrix tmp;
-        std::vector<double> diag;
-        if (!covariance_matrices[k].CholeskyDecomposition(&tmp, &diag)) {
-          return false;
-        }
-        log_determinant += std::accumulate(
-            diag.begin(), diag.end(), 0.0,
-            [](double acc, double x) { return acc + std::log(x); });
-        gconst += log_determinant;
+    if (!Precompute(num_order, num_mixture, is_diagonal, weights, mean_vectors,
+                    covariance_matrices, buffer)) {
+      return false;
+    }
+  }
+
+  double* x(&(buffer->transposed_input_vectors_[0]));
+  double* p(&(buffer->components_[0]));
+  for (int begin(0); begin < num_data; begin += kBlockSize) {
+    const int block_size(std::min(kBlockSize, num_data - begin));
+
+    // Transpose input vectors so that the inner loop runs over them.
+    for (int t(0); t < block_size; ++t) {
+      const double* input_vector(&(input_vectors[begin + t][0]));
+      for (int l(0); l < length; ++l) {
+        x[l * kBlockSize + t] = input_vector[l];
       }
-      buffer->gconsts_[k] = gconst;
     }
 
-    // Precompute inverse of covariance matrix.
-    if (!is_diagonal) {
-      for (int k(0); k < num_mixture; ++k) {
-        if (!covariance_matrices[k].Invert(&(buffer->precisions_[k]))) {
-          return false;
+    CalculateComponentsOfBlock(length, num_mixture, is_diagonal, block_size, x,
+                               buffer->gconsts_, buffer->cholesky_factors_,
+                               buffer->transformed_mean_vectors_,
+                               &(buffer->transformed_input_vector_[0]), p);
+
+    if (components_of_log_probability) {
+      for (int t(0); t < block_size; ++t) {
+        double* output(&((*components_of_log_probability)[begin + t][0]));
+        for (int k(0); k < num_mixture; ++k) {
+          output[k] = p[k * kBlockSize + t];
         }
       }
     }
-
-    buffer->precomputed_ = true;
+    if (log_probability) {
+      CalculateTotalOfBlock(num_mixture, block_size, p,
+                            &((*log_probability)[begin]));
+    }
   }
 
-  const double* x(&(input_vector[0]));
-  double total(sptk::kLogZero);
+  return true;
+}
+
+bool GaussianMixtureModeling::Precompute(
+    int num_order, int num_mixture, bool is_diagonal,
+    const std::vector<double>& weights,
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    GaussianMixtureModeling::Buffer* buffer) {
+  // Prepare memories.
+  const int length(num_order + 1);
+  const int factor_size(is_diagonal ? length : length * (length + 1) / 2);
+  if (buffer->gconsts_.size() != static_cast<std::size_t>(num_mixture)) {
+    buffer->gconsts_.resize(num_mixture);
+  }
+  if (buffer->cholesky_factors_.size() !=
+      static_cast<std::size_t>(num_mixture)) {
+    buffer->cholesky_factors_.resize(num_mixture);
+  }
+  if (buffer->transformed_mean_vectors_.size() !=
+      static_cast<std::size_t>(num_mixture)) {
+    buffer->transformed_mean_vectors_.resize(num_mixture);
+  }
+  for (int k(0); k < num_mixture; ++k) {
+    if (buffer->cholesky_factors_[k].size() !=
+        static_cast<std::size_t>(factor_size)) {
+      buffer->cholesky_factors_[k].resize(factor_size);
+    }
+    if (buffer->transformed_mean_vectors_[k].size() !=
+        static_cast<std::size_t>(length)) {
+      buffer->transformed_mean_vectors_[k].resize(length);
+    }
+  }
+  if (buffer->transposed_input_vectors_.size() !=
+      static_cast<std::size_t>(length * kBlockSize)) {
+    buffer->transposed_input_vectors_.resize(length * kBlockSize);
+  }
+  if (buffer->transformed_input_vector_.size() !=
+      static_cast<std::size_t>(kBlockSize)) {
+    buffer->transformed_input_vector_.resize(kBlockSize);
+  }
+  if (buffer->components_.size() !=
+      static_cast<std::size_t>(num_mixture * kBlockSize)) {
+    buffer->components_.resize(num_mixture * kBlockSize);
+  }
 
-  // Compute log probability of data.
+  // Factorize precision matrices as A^T A, where A is lower triangular, so
+  // that the Mahalanobis distance is given by |Ax - A mu|^2.
+  SymmetricMatrix lower_triangular_matrix;
+  std::vector<double> diagonal_elements;
   for (int k(0); k < num_mixture; ++k) {
-    double sum(buffer->gconsts_[k]);
+    double* a(&(buffer->cholesky_factors_[k][0]));
+    double* b(&(buffer->transformed_mean_vectors_[k][0]));
     const double* mu(&(mean_vectors[k][0]));
+    double log_determinant(0.0);
+
     if (is_diagonal) {
-      for (int l(0); l <= num_order; ++l) {
-        const double diff(x[l] - mu[l]);
-        sum += diff * diff / covariance_matrices[k][l][l];
+      for (int l(0); l < length; ++l) {
+        const double variance(covariance_matrices[k][l][l]);
+        if (variance <= 0.0) {
+          return false;
+        }
+        log_determinant += std::log(variance);
+        a[l] = 1.0 / std::sqrt(variance);
+        b[l] = a[l] * mu[l];
       }
     } else {
-      double* d(&(buffer->d_[0]));
-      for (int l(0); l <= num_order; ++l) {
-        d[l] = x[l] - mu[l];
+      // Decompose covariance matrix as L D L^T.
+      if (!covariance_matrices[k].CholeskyDecomposition(
+              &lower_triangular_matrix, &diagonal_elements)) {
+        return false;
       }
-      for (int l(0); l <= num_order; ++l) {
-        double tmp(0.0);
-        for (int m(0); m <= num_order; ++m) {
-          tmp += d[m] * buffer->precisions_[k][l][m];
+
+      // Compute A = D^(-1/2) L^(-1) row by row.
+      for (int l(0), offset(0); l < length; offset += ++l) {
+        if (diagonal_elements[l] <= 0.0) {
+          return false;
+        }
+        log_determinant += std::log(diagonal_elements[l]);
+
+        a[offset + l] = 1.0;
+        for (int m(l - 1); 0 <= m; --m) {
+          double sum(0.0);
+          for (int n(m + 1); n <= l; ++n) {
+            sum -= a[offset + n] * lower_triangular_matrix[n][m];
+          }
+          a[offset + m] = sum;
         }
-        sum += tmp * d[l];
+      }
+      for (int l(0), offset(0); l < length; offset += ++l) {
+        const double z(1.0 / std::sqrt(diagonal_elements[l]));
+        double sum(0.0);
+        for (int m(0); m <= l; ++m) {
+          a[offset + m] *= z;
+          sum += a[offset + m] * mu[m];
+        }
+        b[l] = sum;
       }
     }
 
-    const double p(std::log(weights[k]) - 0.5 * sum);
-    if (components_of_log_probability) {
-      (*components_of_log_probability)[k] = p;
-    }
-    total = AddInLogSpace(total, p);
+    buffer->gconsts_[k] =
+        std::log(weights[k]) -
+        0.5 * (length * std::log(sptk::kTwoPi) + log_determinant);
   }
 
-  if (log_probability) {
-    *log_probability = total;
-  }
+  buffer->precomputed_ = true;
 
   return true;
 }
@@ -530,7 +822,8 @@ bool GaussianMixtureModeling::Initialize(
     const double splitting_factor(1e-5);
     const int seed(1);
     LindeBuzoGrayAlgorithm lbg(num_order_, 1, num_mixture_, 1, num_iteration,
-                               convergence_threshold, splitting_factor, seed);
+                               convergence_threshold, splitting_factor, seed,
+                               num_thread_);
     if (!lbg.Run(input_vectors, mean_vectors, &codebook_indices)) {
       return false;
     }
@@ -103,7 +103,8 @@ bool InverseDiscreteCosineTransform::Run(
 
   if (!fourier_transform_.Run(buffer->fourier_transform_real_part_,
                               buffer->fourier_transform_imag_part_,
-                              real_part_output, imag_part_output)) {
+                              real_part_output, imag_part_output,
+                              &buffer->buffer_for_fourier_transform_)) {
     return false;
   }
 
@@ -0,0 +1,104 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/math/median_accumulation.h"
+
+#include <cmath>    // std::isnan
+#include <cstddef>  // std::size_t
+
+namespace sptk {
+
+bool MedianAccumulation::GetNumData(const MedianAccumulation::Buffer& buffer,
+                                    int* num_data) const {
+  if (NULL == num_data) {
+    return false;
+  }
+  *num_data =
+      static_cast<int>(buffer.lower_half_.size() + buffer.upper_half_.size());
+  return true;
+}
+
+bool MedianAccumulation::GetMedian(const MedianAccumulation::Buffer& buffer,
+                                   double* median) const {
+  if (buffer.lower_half_.empty() || NULL == median) {
+    return false;
+  }
+  if (buffer.lower_half_.size() == buffer.upper_half_.size()) {
+    *median =
+        0.5 * (*buffer.lower_half_.rbegin() + *buffer.upper_half_.begin());
+  } else {
+    *median = *buffer.lower_half_.rbegin();
+  }
+  return true;
+}
+
+void MedianAccumulation::Clear(MedianAccumulation::Buffer* buffer) const {
+  if (NULL != buffer) {
+    buffer->Clear();
+  }
+}
+
+bool MedianAccumulation::Run(double data,
+                             MedianAccumulation::Buffer* buffer) const {
+  if (std::isnan(data) || NULL == buffer) {
+    return false;
+  }
+  if (buffer->lower_half_.empty() || data <= *buffer->lower_half_.rbegin()) {
+    buffer->lower_half_.insert(data);
+  } else {
+    buffer->upper_half_.insert(data);
+  }
+  Rebalance(buffer);
+  return true;
+}
+
+bool MedianAccumulation::Remove(double data,
+                                MedianAccumulation::Buffer* buffer) const {
+  if (NULL == buffer) {
+    return false;
+  }
+  std::multiset<double>::iterator itr(buffer->lower_half_.find(data));
+  if (buffer->lower_half_.end() != itr) {
+    buffer->lower_half_.erase(itr);
+  } else {
+    itr = buffer->upper_half_.find(data);
+    if (buffer->upper_half_.end() == itr) {
+      return false;
+    }
+    buffer->upper_half_.erase(itr);
+  }
+  Rebalance(buffer);
+  return true;
+}
+
+void MedianAccumulation::Rebalance(MedianAccumulation::Buffer* buffer) const {
+  // Keep the size of the lower half equal to or one greater than that of the
+  // upper half.
+  std::multiset<double>& lower_half(buffer->lower_half_);
+  std::multiset<double>& upper_half(buffer->upper_half_);
+  while (upper_half.size() + 1 < lower_half.size()) {
+    std::multiset<double>::iterator itr(--lower_half.end());
+    upper_half.insert(upper_half.begin(), *itr);
+    lower_half.erase(itr);
+  }
+  while (lower_half.size() < upper_half.size()) {
+    std::multiset<double>::iterator itr(upper_half.begin());
+    lower_half.insert(lower_half.end(), *itr);
+    upper_half.erase(itr);
+  }
+}
+
+}  // namespace sptk
@@ -0,0 +1,307 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/math/mixed_radix_fast_fourier_transform.h"
+
+#include <algorithm>  // std::copy, std::fill
+#include <cmath>      // std::cos, std::sin
+#include <cstddef>    // std::size_t
+#include <utility>    // std::swap
+
+namespace sptk {
+
+MixedRadixFastFourierTransform::MixedRadixFastFourierTransform(int fft_length)
+    : fft_length_(fft_length), is_valid_(true), fast_fourier_transform_(NULL) {
+  if (fft_length_ <= 0) {
+    is_valid_ = false;
+    return;
+  }
+
+  // Factorize FFT length. Radix-4 is preferred to radix-2.
+  {
+    const int candidates[] = {4, 2, 3, 5, 7};
+    int remainder(fft_length_);
+    for (int radix : candidates) {
+      while (0 == remainder % radix) {
+        radices_.push_back(radix);
+        remainder /= radix;
+      }
+    }
+    if (1 != remainder) {
+      radices_.clear();
+    }
+  }
+
+  if (!radices_.empty() || 1 == fft_length_) {
+    // Make twiddle factor table.
+    const double argument(sptk::kTwoPi / fft_length_);
+    cosine_table_.resize(fft_length_);
+    sine_table_.resize(fft_length_);
+    for (int i(0); i < fft_length_; ++i) {
+      cosine_table_[i] = std::cos(argument * i);
+      sine_table_[i] = std::sin(argument * i);
+    }
+    return;
+  }
+
+  // Make chirp. The square of index is reduced modulo 2L to keep accuracy.
+  const int convolution_length(NextPowTwo(2 * fft_length_ - 1));
+  const int modulus(2 * fft_length_);
+  const double argument(sptk::kPi / fft_length_);
+  cosine_table_.resize(fft_length_);
+  sine_table_.resize(fft_length_);
+  for (int i(0), ii(0); i < fft_length_; ++i) {
+    cosine_table_[i] = std::cos(argument * ii);
+    sine_table_[i] = std::sin(argument * ii);
+    // (i + 1)^2 = i^2 + 2i + 1.
+    ii += 2 * i + 1;
+    while (modulus <= ii) ii -= modulus;
+  }
+
+  // Calculate spectrum of the chirp.
+  fast_fourier_transform_ = new FastFourierTransform(convolution_length);
+  if (!fast_fourier_transform_->IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+  chirp_real_part_spectrum_.resize(convolution_length, 0.0);
+  chirp_imag_part_spectrum_.resize(convolution_length, 0.0);
+  chirp_real_part_spectrum_[0] = cosine_table_[0];
+  chirp_imag_part_spectrum_[0] = sine_table_[0];
+  for (int i(1); i < fft_length_; ++i) {
+    chirp_real_part_spectrum_[i] = cosine_table_[i];
+    chirp_imag_part_spectrum_[i] = sine_table_[i];
+    chirp_real_part_spectrum_[convolution_length - i] = cosine_table_[i];
+    chirp_imag_part_spectrum_[convolution_length - i] = sine_table_[i];
+  }
+  if (!fast_fourier_transform_->Run(&chirp_real_part_spectrum_,
+                                    &chirp_imag_part_spectrum_)) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool MixedRadixFastFourierTransform::Run(
+    const std::vector<double>& real_part_input,
+    const std::vector<double>& imag_part_input,
+    std::vector<double>* real_part_output,
+    std::vector<double>* imag_part_output,
+    MixedRadixFastFourierTransform::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ ||
+      real_part_input.size() != static_cast<std::size_t>(fft_length_) ||
+      imag_part_input.size() != static_cast<std::size_t>(fft_length_) ||
+      NULL == real_part_output || NULL == imag_part_output ||
+      NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (real_part_output->size() != static_cast<std::size_t>(fft_length_)) {
+    real_part_output->resize(fft_length_);
+  }
+  if (imag_part_output->size() != static_cast<std::size_t>(fft_length_)) {
+    imag_part_output->resize(fft_length_);
+  }
+
+  // Copy inputs.
+  if (&real_part_input != real_part_output) {
+    std::copy(real_part_input.begin(), real_part_input.end(),
+              real_part_output->begin());
+  }
+  if (&imag_part_input != imag_part_output) {
+    std::copy(imag_part_input.begin(), imag_part_input.end(),
+              imag_part_output->begin());
+  }
+
+  if (IsBluestein()) {
+    return RunBluestein(&((*real_part_output)[0]), &((*imag_part_output)[0]),
+                        buffer);
+  }
+  return RunStockham(&((*real_part_output)[0]), &((*imag_part_output)[0]),
+                     buffer);
+}
+
+bool MixedRadixFastFourierTransform::Run(
+    std::vector<double>* real_part, std::vector<double>* imag_part,
+    MixedRadixFastFourierTransform::Buffer* buffer) const {
+  if (NULL == real_part || NULL == imag_part) return false;
+  return Run(*real_part, *imag_part, real_part, imag_part, buffer);
+}
+
+bool MixedRadixFastFourierTransform::RunStockham(
+    double* real_part, double* imag_part,
+    MixedRadixFastFourierTransform::Buffer* buffer) const {
+  // Prepare memories.
+  if (buffer->work_real_part_.size() != static_cast<std::size_t>(fft_length_)) {
+    buffer->work_real_part_.resize(fft_length_);
+  }
+  if (buffer->work_imag_part_.size() != static_cast<std::size_t>(fft_length_)) {
+    buffer->work_imag_part_.resize(fft_length_);
+  }
+
+  const double* cosine_table(&(cosine_table_[0]));
+  const double* sine_table(&(sine_table_[0]));
+
+  double* x(real_part);
+  double* y(imag_part);
+  double* xo(&(buffer->work_real_part_[0]));
+  double* yo(&(buffer->work_imag_part_[0]));
+
+  // Let n be the length of the current sub-transform and s be the stride.
+  // The input x[q + s * (p + m * t)], where m = n / r, is transformed into
+  // the output x[q + s * (r * p + u)] with the twiddle factor W_N^{p*u*s}.
+  int stride(1);
+  int n(fft_length_);
+  for (int radix : radices_) {
+    const int m(n / radix);
+    const int step(fft_length_ / radix);
+    for (int p(0); p < m; ++p) {
+      for (int q(0); q < stride; ++q) {
+        const int in(q + stride * p);
+        const int out(q + stride * radix * p);
+        if (2 == radix) {
+          const int i0(in);
+          const int i1(in + stride * m);
+          const double ar(x[i0] + x[i1]);
+          const double ai(y[i0] + y[i1]);
+          const double br(x[i0] - x[i1]);
+          const double bi(y[i0] - y[i1]);
+          const int w1(p * stride);
+          xo[out] = ar;
+          yo[out] = ai;
+          xo[out + stride] = cosine_table[w1] * br + sine_table[w1] * bi;
+          yo[out + stride] = cosine_table[w1] * bi - sine_table[w1] * br;
+        } else if (4 == radix) {
+          const int i0(in);
+          const int i1(in + stride * m);
+          const int i2(i1 + stride * m);
+          const int i3(i2 + stride * m);
+          const double ar(x[i0] + x[i2]);
+          const double ai(y[i0] + y[i2]);
+          const double br(x[i0] - x[i2]);
+          const double bi(y[i0] - y[i2]);
+          const double cr(x[i1] + x[i3]);
+          const double ci(y[i1] + y[i3]);
+          const double dr(x[i1] - x[i3]);
+          const double di(y[i1] - y[i3]);
+          const double t1(br + di);
+          const double t2(bi - dr);
+          const double t3(ar - cr);
+          const double t4(ai - ci);
+          const double t5(br - di);
+          const double t6(bi + dr);
+          const int w1(p * stride);
+          const int w2(2 * w1);
+          const int w3(3 * w1);
+          xo[out] = ar + cr;
+          yo[out] = ai + ci;
+          xo[out + stride] = cosine_table[w1] * t1 + sine_table[w1] * t2;
+          yo[out + stride] = cosine_table[w1] * t2 - sine_table[w1] * t1;
+          xo[out + 2 * stride] = cosine_table[w2] * t3 + sine_table[w2] * t4;
+          yo[out + 2 * stride] = cosine_table[w2] * t4 - sine_table[w2] * t3;
+          xo[out + 3 * stride] = cosine_table[w3] * t5 + sine_table[w3] * t6;
+          yo[out + 3 * stride] = cosine_table[w3] * t6 - sine_table[w3] * t5;
+        } else {
+          for (int u(0); u < radix; ++u) {
+            double sum_x(0.0);
+            double sum_y(0.0);
+            for (int t(0), k(0); t < radix; ++t) {
+              const int i(in + stride * m * t);
+              sum_x += x[i] * cosine_table[k] + y[i] * sine_table[k];
+              sum_y += y[i] * cosine_table[k] - x[i] * sine_table[k];
+              k += u * step;
+              if (fft_length_ <= k) k -= fft_length_;
+            }
+            const int w(p * u * stride);
+            xo[out + stride * u] =
+                cosine_table[w] * sum_x + sine_table[w] * sum_y;
+            yo[out + stride * u] =
+                cosine_table[w] * sum_y - sine_table[w] * sum_x;
+          }
+        }
+      }
+    }
+    std::swap(x, xo);
+    std::swap(y, yo);
+    stride *= radix;
+    n = m;
+  }
+
+  if (x != real_part) {
+    std::copy(x, x + fft_length_, real_part);
+    std::copy(y, y + fft_length_, imag_part);
+  }
+
+  return true;
+}
+
+bool MixedRadixFastFourierTransform::RunBluestein(
+    double* real_part, double* imag_part,
+    MixedRadixFastFourierTransform::Buffer* buffer) const {
+  // Prepare memories.
+  const int convolution_length(fast_fourier_transform_->GetFftLength());
+  if (buffer->work_real_part_.size() !=
+      static_cast<std::size_t>(convolution_length)) {
+    buffer->work_real_part_.resize(convolution_length);
+  }
+  if (buffer->work_imag_part_.size() !=
+      static_cast<std::size_t>(convolution_length)) {
+    buffer->work_imag_part_.resize(convolution_length);
+  }
+  std::vector<double>& work_real_part(buffer->work_real_part_);
+  std::vector<double>& work_imag_part(buffer->work_imag_part_);
+
+  // Multiply input by conjugate chirp.
+  for (int i(0); i < fft_length_; ++i) {
+    work_real_part[i] =
+        real_part[i] * cosine_table_[i] + imag_part[i] * sine_table_[i];
+    work_imag_part[i] =
+        imag_part[i] * cosine_table_[i] - real_part[i] * sine_table_[i];
+  }
+  std::fill(work_real_part.begin() + fft_length_, work_real_part.end(), 0.0);
+  std::fill(work_imag_part.begin() + fft_length_, work_imag_part.end(), 0.0);
+
+  // Convolve with chirp in frequency domain.
+  if (!fast_fourier_transform_->Run(&work_real_part, &work_imag_part)) {
+    return false;
+  }
+  for (int i(0); i < convolution_length; ++i) {
+    const double xr(work_real_part[i]);
+    const double xi(work_imag_part[i]);
+    const double hr(chirp_real_part_spectrum_[i]);
+    const double hi(chirp_imag_part_spectrum_[i]);
+    // Take conjugate to perform inverse FFT by forward FFT.
+    work_real_part[i] = xr * hr - xi * hi;
+    work_imag_part[i] = -(xr * hi + xi * hr);
+  }
+  if (!fast_fourier_transform_->Run(&work_real_part, &work_imag_part)) {
+    return false;
+  }
+
+  // Multiply by conjugate chirp and normalize.
+  const double z(1.0 / convolution_length);
+  for (int i(0); i < fft_length_; ++i) {
+    const double xr(work_real_part[i] * z);
+    const double xi(-work_imag_part[i] * z);
+    real_part[i] = xr * cosine_table_[i] + xi * sine_table_[i];
+    imag_part[i] = xi * cosine_table_[i] - xr * sine_table_[i];
+  }
+
+  return true;
+}
+
+}  // namespace sptk
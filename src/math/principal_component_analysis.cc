@@ -25,15 +25,22 @@ namespace sptk {
 
 PrincipalComponentAnalysis::PrincipalComponentAnalysis(
     int num_order, int num_iteration, double convergence_threshold,
-    CovarianceType covariance_type)
+    CovarianceType covariance_type, Algorithms algorithm,
+    int num_principal_component)
     : num_order_(num_order),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
       covariance_type_(covariance_type),
+      algorithm_(algorithm),
+      num_principal_component_(0 == num_principal_component
+                                   ? num_order + 1
+                                   : num_principal_component),
       accumulation_(num_order, 2),
       is_valid_(true) {
   if (num_order_ < 0 || num_iteration_ <= 0 || convergence_threshold_ < 0.0 ||
-      kNumCovarianceTypes == covariance_type_ || !accumulation_.IsValid()) {
+      kNumCovarianceTypes == covariance_type_ || kNumAlgorithms == algorithm_ ||
+      num_principal_component_ <= 0 ||
+      num_order_ + 1 < num_principal_component_ || !accumulation_.IsValid()) {
     is_valid_ = false;
     return;
   }
@@ -44,31 +51,47 @@ bool PrincipalComponentAnalysis::Run(
     std::vector<double>* mean_vector, std::vector<double>* eigenvalues,
     Matrix* eigenvectors, PrincipalComponentAnalysis::Buffer* buffer) const {
   // Check inputs.
-  if (!is_valid_ || NULL == mean_vector || NULL == eigenvalues ||
-      NULL == eigenvectors || NULL == buffer) {
+  if (!is_valid_ || NULL == buffer) {
     return false;
   }
 
-  // Prepare memories.
-  const int length(num_order_ + 1);
-  if (eigenvalues->size() != static_cast<std::size_t>(length)) {
-    eigenvalues->resize(length);
+  Clear(buffer);
+  for (const std::vector<double>& input_vector : input_vectors) {
+    if (!Accumulate(input_vector, buffer)) {
+      return false;
+    }
   }
-  if (eigenvectors->GetNumRow() != length ||
-      eigenvectors->GetNumColumn() != length) {
-    eigenvectors->Resize(length, length);
+  return Run(mean_vector, eigenvalues, eigenvectors, buffer);
+}
+
+void PrincipalComponentAnalysis::Clear(
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  if (NULL != buffer) {
+    accumulation_.Clear(&buffer->buffer_for_accumulation);
   }
-  if (buffer->order_of_eigenvalue_.size() != static_cast<std::size_t>(length)) {
-    buffer->order_of_eigenvalue_.resize(length);
+}
+
+bool PrincipalComponentAnalysis::Accumulate(
+    const std::vector<double>& input_vector,
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == buffer) {
+    return false;
   }
 
-  // Calculate statistics.
-  accumulation_.Clear(&buffer->buffer_for_accumulation);
-  for (const std::vector<double>& input_vector : input_vectors) {
-    if (!accumulation_.Run(input_vector, &buffer->buffer_for_accumulation)) {
-      return false;
-    }
+  return accumulation_.Run(input_vector, &buffer->buffer_for_accumulation);
+}
+
+bool PrincipalComponentAnalysis::Run(
+    std::vector<double>* mean_vector, std::vector<double>* eigenvalues,
+    Matrix* eigenvectors, PrincipalComponentAnalysis::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == mean_vector || NULL == eigenvalues ||
+      NULL == eigenvectors || NULL == buffer) {
+    return false;
   }
+
+  // Calculate statistics.
   if (!accumulation_.GetMean(buffer->buffer_for_accumulation, mean_vector)) {
     return false;
   }
@@ -99,6 +122,59 @@ bool PrincipalComponentAnalysis::Run(
     }
   }
 
+  const int length(num_order_ + 1);
+  buffer->total_variance_ = 0.0;
+  for (int i(0); i < length; ++i) {
+    buffer->total_variance_ += buffer->a_[i][i];
+  }
+
+  // Solve eigenvalue problem.
+  switch (algorithm_) {
+    case kJacobi: {
+      return RunJacobiMethod(eigenvalues, eigenvectors, buffer);
+    }
+    case kHouseholderQl: {
+      return buffer->a_.EigenvalueDecomposition(eigenvalues, eigenvectors);
+    }
+    case kLanczos: {
+      return buffer->a_.PartialEigenvalueDecomposition(
+          num_principal_component_, convergence_threshold_, eigenvalues,
+          eigenvectors);
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+bool PrincipalComponentAnalysis::GetTotalVariance(
+    const PrincipalComponentAnalysis::Buffer& buffer,
+    double* total_variance) const {
+  if (!is_valid_ || NULL == total_variance) {
+    return false;
+  }
+
+  *total_variance = buffer.total_variance_;
+
+  return true;
+}
+
+bool PrincipalComponentAnalysis::RunJacobiMethod(
+    std::vector<double>* eigenvalues, Matrix* eigenvectors,
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  // Prepare memories.
+  const int length(num_order_ + 1);
+  if (eigenvalues->size() != static_cast<std::size_t>(length)) {
+    eigenvalues->resize(length);
+  }
+  if (eigenvectors->GetNumRow() != length ||
+      eigenvectors->GetNumColumn() != length) {
+    eigenvectors->Resize(length, length);
+  }
+  if (buffer->order_of_eigenvalue_.size() != static_cast<std::size_t>(length)) {
+    buffer->order_of_eigenvalue_.resize(length);
+  }
+
   // Initialize eigenvector matrix with identity matrix.
   eigenvectors->FillDiagonal(1.0);
 
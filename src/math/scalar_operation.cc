@@ -16,7 +16,8 @@
 
 #include "SPTK/math/scalar_operation.h"
 
-#include <cmath>  // std::atan, std::atanh, std::ceil, std::cos, std::exp, std::fabs, std::floor, std::fmod, std::log, std::pow, std::round, std::sin, std::sqrt, std::tan, std::tanh, std::trunc
+#include <algorithm>  // std::fill
+#include <cmath>      // std::atan, std::atanh, std::ceil, std::cos, std::exp, std::fabs, std::floor, std::fmod, std::log, std::pow, std::round, std::signbit, std::sin, std::sqrt, std::tan, std::tanh, std::trunc
 
 namespace {
 
@@ -25,7 +26,7 @@ class OperationInterface {
   virtual ~OperationInterface() {
   }
 
-  virtual bool Run(double* number) const = 0;
+  virtual bool Run(int length, double* numbers) const = 0;
 };
 
 /**
@@ -46,72 +47,18 @@ class OperationPerformer : public sptk::ScalarOperation::ModuleInterface {
     if (*is_magic_number) {
       return true;
     }
-    return operation_->Run(number);
+    return operation_->Run(1, number);
   }
 
- private:
-  const OperationInterface* operation_;
-  DISALLOW_COPY_AND_ASSIGN(OperationPerformer);
-};
-
-class Addition : public OperationInterface {
- public:
-  explicit Addition(double addend) : addend_(addend) {
-  }
-
-  virtual bool Run(double* number) const {
-    *number += addend_;
-    return true;
-  }
-
- private:
-  const double addend_;
-  DISALLOW_COPY_AND_ASSIGN(Addition);
-};
-
-class Subtraction : public OperationInterface {
- public:
-  explicit Subtraction(double subtrahend) : subtrahend_(subtrahend) {
-  }
-
-  virtual bool Run(double* number) const {
-    *number -= subtrahend_;
-    return true;
-  }
-
- private:
-  const double subtrahend_;
-  DISALLOW_COPY_AND_ASSIGN(Subtraction);
-};
-
-class Multiplication : public OperationInterface {
- public:
-  explicit Multiplication(double multiplier) : multiplier_(multiplier) {
-  }
-
-  virtual bool Run(double* number) const {
-    *number *= multiplier_;
-    return true;
-  }
-
- private:
-  const double multiplier_;
-  DISALLOW_COPY_AND_ASSIGN(Multiplication);
-};
-
-class Division : public OperationInterface {
- public:
-  explicit Division(double divisor) : multiplier_(1.0 / divisor) {
-  }
-
-  virtual bool Run(double* number) const {
-    *number *= multiplier_;
-    return true;
+  virtual bool Run(int length, double* numbers, bool*) const {
+    // The magic numbers are also operated because their values are discarded
+    // or replaced later. This keeps the loop of the operation simple.
+    return operation_->Run(length, numbers);
   }
 
  private:
-  const double multiplier_;
-  DISALLOW_COPY_AND_ASSIGN(Division);
+  const OperationInterface* operation_;
+  DISALLOW_COPY_AND_ASSIGN(OperationPerformer);
 };
 
 class Modulo : public OperationInterface {
@@ -119,8 +66,10 @@ class Modulo : public OperationInterface {
   explicit Modulo(double divisor) : divisor_(divisor) {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::fmod(*number, divisor_);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::fmod(numbers[i], divisor_);
+    }
     return true;
   }
 
@@ -134,8 +83,10 @@ class Power : public OperationInterface {
   explicit Power(double exponent) : exponent_(exponent) {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::pow(*number, exponent_);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::pow(numbers[i], exponent_);
+    }
     return true;
   }
 
@@ -149,8 +100,10 @@ class LowerBounding : public OperationInterface {
   explicit LowerBounding(double lower_bound) : lower_bound_(lower_bound) {
   }
 
-  virtual bool Run(double* number) const {
-    if (*number < lower_bound_) *number = lower_bound_;
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      if (numbers[i] < lower_bound_) numbers[i] = lower_bound_;
+    }
     return true;
   }
 
@@ -164,8 +117,10 @@ class UpperBounding : public OperationInterface {
   explicit UpperBounding(double upper_bound) : upper_bound_(upper_bound) {
   }
 
-  virtual bool Run(double* number) const {
-    if (upper_bound_ < *number) *number = upper_bound_;
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      if (upper_bound_ < numbers[i]) numbers[i] = upper_bound_;
+    }
     return true;
   }
 
@@ -179,8 +134,10 @@ class Absolute : public OperationInterface {
   Absolute() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::fabs(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::fabs(numbers[i]);
+    }
     return true;
   }
 
@@ -193,8 +150,10 @@ class Reciprocal : public OperationInterface {
   Reciprocal() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = 1.0 / *number;
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = 1.0 / numbers[i];
+    }
     return true;
   }
 
@@ -207,8 +166,10 @@ class Square : public OperationInterface {
   Square() {
   }
 
-  virtual bool Run(double* number) const {
-    *number *= *number;
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] *= numbers[i];
+    }
     return true;
   }
 
@@ -221,8 +182,10 @@ class SquareRoot : public OperationInterface {
   SquareRoot() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::sqrt(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::sqrt(numbers[i]);
+    }
     return true;
   }
 
@@ -235,8 +198,10 @@ class NaturalLogarithm : public OperationInterface {
   NaturalLogarithm() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::log(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::log(numbers[i]);
+    }
     return true;
   }
 
@@ -249,8 +214,10 @@ class Logarithm : public OperationInterface {
   explicit Logarithm(double base) : multiplier_(1.0 / std::log(base)) {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::log(*number) * multiplier_;
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::log(numbers[i]) * multiplier_;
+    }
     return true;
   }
 
@@ -264,8 +231,10 @@ class NaturalExponential : public OperationInterface {
   NaturalExponential() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::exp(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::exp(numbers[i]);
+    }
     return true;
   }
 
@@ -278,8 +247,10 @@ class Exponential : public OperationInterface {
   explicit Exponential(double base) : base_(base) {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::pow(base_, *number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::pow(base_, numbers[i]);
+    }
     return true;
   }
 
@@ -293,8 +264,10 @@ class Flooring : public OperationInterface {
   Flooring() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::floor(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::floor(numbers[i]);
+    }
     return true;
   }
 
@@ -307,8 +280,10 @@ class Ceiling : public OperationInterface {
   Ceiling() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::ceil(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::ceil(numbers[i]);
+    }
     return true;
   }
 
@@ -321,8 +296,10 @@ class Rounding : public OperationInterface {
   Rounding() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::round(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::round(numbers[i]);
+    }
     return true;
   }
 
@@ -335,8 +312,11 @@ class RoundingUp : public OperationInterface {
   RoundingUp() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = (*number < 0.0) ? std::floor(*number) : std::ceil(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] =
+          (numbers[i] < 0.0) ? std::floor(numbers[i]) : std::ceil(numbers[i]);
+    }
     return true;
   }
 
@@ -349,8 +329,10 @@ class RoundingDown : public OperationInterface {
   RoundingDown() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::trunc(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::trunc(numbers[i]);
+    }
     return true;
   }
 
@@ -363,8 +345,10 @@ class UnitStep : public OperationInterface {
   UnitStep() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = (*number < 0.0) ? 0.0 : 1.0;
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = (numbers[i] < 0.0) ? 0.0 : 1.0;
+    }
     return true;
   }
 
@@ -377,8 +361,10 @@ class Sign : public OperationInterface {
   Sign() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = sptk::ExtractSign(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = sptk::ExtractSign(numbers[i]);
+    }
     return true;
   }
 
@@ -391,8 +377,10 @@ class Sine : public OperationInterface {
   Sine() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::sin(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::sin(numbers[i]);
+    }
     return true;
   }
 
@@ -405,8 +393,10 @@ class Cosine : public OperationInterface {
   Cosine() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::cos(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::cos(numbers[i]);
+    }
     return true;
   }
 
@@ -419,8 +409,10 @@ class Tangent : public OperationInterface {
   Tangent() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::tan(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::tan(numbers[i]);
+    }
     return true;
   }
 
@@ -433,8 +425,10 @@ class Arctangent : public OperationInterface {
   Arctangent() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::atan(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::atan(numbers[i]);
+    }
     return true;
   }
 
@@ -447,8 +441,10 @@ class HyperbolicTangent : public OperationInterface {
   HyperbolicTangent() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::tanh(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::tanh(numbers[i]);
+    }
     return true;
   }
 
@@ -461,8 +457,10 @@ class HyperbolicArctangent : public OperationInterface {
   HyperbolicArctangent() {
   }
 
-  virtual bool Run(double* number) const {
-    *number = std::atanh(*number);
+  virtual bool Run(int length, double* numbers) const {
+    for (int i(0); i < length; ++i) {
+      numbers[i] = std::atanh(numbers[i]);
+    }
     return true;
   }
 
@@ -486,6 +484,16 @@ class MagicNumberRemover : public sptk::ScalarOperation::ModuleInterface {
     return true;
   }
 
+  virtual bool Run(int length, double* numbers, bool* is_magic_numbers) const {
+    for (int i(0); i < length; ++i) {
+      if (is_magic_numbers[i]) {
+        return false;
+      }
+      is_magic_numbers[i] = (magic_number_ == numbers[i]);
+    }
+    return true;
+  }
+
  private:
   const double magic_number_;
   DISALLOW_COPY_AND_ASSIGN(MagicNumberRemover);
@@ -505,6 +513,16 @@ class MagicNumberReplacer : public sptk::ScalarOperation::ModuleInterface {
     return true;
   }
 
+  virtual bool Run(int length, double* numbers, bool* is_magic_numbers) const {
+    for (int i(0); i < length; ++i) {
+      if (is_magic_numbers[i]) {
+        numbers[i] = replacement_number_;
+        is_magic_numbers[i] = false;
+      }
+    }
+    return true;
+  }
+
  private:
   const double replacement_number_;
   DISALLOW_COPY_AND_ASSIGN(MagicNumberReplacer);
@@ -514,24 +532,101 @@ class MagicNumberReplacer : public sptk::ScalarOperation::ModuleInterface {
 
 namespace sptk {
 
+/**
+ * Sequence of affine transformations, @f$ax + b@f$, into which adjacent
+ * addition, subtraction, multiplication, and division are fused. The
+ * transformations are applied one by one in a single pass over the numbers,
+ * so that the result is exactly the same as that of the individual operations.
+ */
+class ScalarOperation::AffineTransformation
+    : public ScalarOperation::ModuleInterface {
+ public:
+  AffineTransformation() {
+  }
+
+  void Multiply(double multiplier) {
+    // Adding negative zero does not change any number including zeros.
+    steps_.push_back(Step(multiplier, -0.0));
+  }
+
+  void Add(double addend) {
+    if (steps_.empty() || !IsNeutralAddend(steps_.back().addend)) {
+      steps_.push_back(Step(1.0, addend));
+    } else {
+      steps_.back().addend = addend;
+    }
+  }
+
+  virtual bool Run(double* number, bool* is_magic_number) const {
+    if (*is_magic_number) {
+      return true;
+    }
+    return Run(1, number, is_magic_number);
+  }
+
+  virtual bool Run(int length, double* numbers, bool*) const {
+    const int num_step(static_cast<int>(steps_.size()));
+    if (1 == num_step) {
+      const double multiplier(steps_[0].multiplier);
+      const double addend(steps_[0].addend);
+      for (int i(0); i < length; ++i) {
+        numbers[i] = numbers[i] * multiplier + addend;
+      }
+    } else {
+      for (int i(0); i < length; ++i) {
+        double x(numbers[i]);
+        for (int j(0); j < num_step; ++j) {
+          x = x * steps_[j].multiplier + steps_[j].addend;
+        }
+        numbers[i] = x;
+      }
+    }
+    return true;
+  }
+
+ private:
+  struct Step {
+    Step(double m, double a) : multiplier(m), addend(a) {
+    }
+    double multiplier;
+    double addend;
+  };
+
+  static bool IsNeutralAddend(double addend) {
+    return 0.0 == addend && std::signbit(addend);
+  }
+
+  std::vector<Step> steps_;
+
+  DISALLOW_COPY_AND_ASSIGN(AffineTransformation);
+};
+
+ScalarOperation::~ScalarOperation() {
+  for (std::vector<ScalarOperation::ModuleInterface*>::iterator itr(
+           modules_.begin());
+       itr != modules_.end(); ++itr) {
+    delete (*itr);
+  }
+}
+
 bool ScalarOperation::AddAdditionOperation(double addend) {
-  modules_.push_back(new OperationPerformer(new Addition(addend)));
+  GetAffineTransformation()->Add(addend);
   return true;
 }
 
 bool ScalarOperation::AddSubtractionOperation(double subtrahend) {
-  modules_.push_back(new OperationPerformer(new Subtraction(subtrahend)));
+  GetAffineTransformation()->Add(-subtrahend);
   return true;
 }
 
 bool ScalarOperation::AddMultiplicationOperation(double multiplier) {
-  modules_.push_back(new OperationPerformer(new Multiplication(multiplier)));
+  GetAffineTransformation()->Multiply(multiplier);
   return true;
 }
 
 bool ScalarOperation::AddDivisionOperation(double divisor) {
   if (0.0 == divisor) return false;
-  modules_.push_back(new OperationPerformer(new Division(divisor)));
+  GetAffineTransformation()->Multiply(1.0 / divisor);
   return true;
 }
 
@@ -693,4 +788,31 @@ bool ScalarOperation::Run(double* number, bool* is_magic_number) const {
   return true;
 }
 
+bool ScalarOperation::Run(int length, double* numbers,
+                          bool* is_magic_numbers) const {
+  if (length < 0 || NULL == numbers || NULL == is_magic_numbers) {
+    return false;
+  }
+
+  std::fill(is_magic_numbers, is_magic_numbers + length, false);
+  for (std::vector<ScalarOperation::ModuleInterface*>::const_iterator itr(
+           modules_.begin());
+       itr != modules_.end(); ++itr) {
+    if (!(*itr)->Run(length, numbers, is_magic_numbers)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+ScalarOperation::AffineTransformation*
+ScalarOperation::GetAffineTransformation() {
+  if (modules_.empty() || modules_.back() != last_affine_transformation_) {
+    last_affine_transformation_ = new AffineTransformation();
+    modules_.push_back(last_affine_transformation_);
+  }
+  return last_affine_transformation_;
+}
+
 }  // namespace sptk
@@ -16,9 +16,10 @@
 
 #include "SPTK/math/symmetric_matrix.h"
 
-#include <algorithm>  // std::fill, std::swap
-#include <cmath>      // std::fabs
+#include <algorithm>  // std::copy, std::fill, std::max, std::stable_sort, etc.
+#include <cmath>      // std::fabs, std::hypot, std::sqrt
 #include <cstddef>    // std::size_t
+#include <limits>     // std::numeric_limits
 #include <stdexcept>  // std::out_of_range
 
 #include "SPTK/math/matrix.h"
@@ -27,6 +28,136 @@ namespace {
 
 const char* kErrorMessageForOutOfRange("SymmetricMatrix: Out of range");
 const double kMinimumValueOfDiagonalElement(1e-12);
+const int kMaxNumIterationOfQlMethod(30);
+const int kIntervalOfConvergenceCheck(8);
+
+// Compute the eigenvalues and eigenvectors of a symmetric tridiagonal matrix by
+// the implicit QL method. The diagonal elements d are overwritten by the
+// eigenvalues. The off-diagonal elements are given as e[i] = T(i, i+1), and
+// e[n-1] is used as a work area. The rows of z are rotated along with T, so
+// that the i-th row of z holds the eigenvector of d[i] on exit if z is
+// initialized to the identity matrix.
+bool SolveTridiagonalEigenproblem(int n, double* d, double* e,
+                                  sptk::Matrix* z) {
+  const double epsilon(std::numeric_limits<double>::epsilon());
+  const int num_column(z->GetNumColumn());
+
+  e[n - 1] = 0.0;
+  double shift(0.0);
+  double max_norm(0.0);
+  for (int l(0); l < n; ++l) {
+    // Find small off-diagonal element.
+    max_norm = std::max(max_norm, std::fabs(d[l]) + std::fabs(e[l]));
+    int m(l);
+    while (m < n - 1 && epsilon * max_norm < std::fabs(e[m])) {
+      ++m;
+    }
+
+    if (l < m) {
+      int num_iteration(0);
+      do {
+        if (kMaxNumIterationOfQlMethod <= num_iteration++) {
+          return false;
+        }
+
+        // Compute implicit shift.
+        double g(d[l]);
+        double p((d[l + 1] - g) / (2.0 * e[l]));
+        double r(std::hypot(p, 1.0));
+        if (p < 0.0) r = -r;
+        d[l] = e[l] / (p + r);
+        d[l + 1] = e[l] * (p + r);
+        const double dl1(d[l + 1]);
+        double h(g - d[l]);
+        for (int i(l + 2); i < n; ++i) {
+          d[i] -= h;
+        }
+        shift += h;
+
+        // Perform implicit QL transformation.
+        p = d[m];
+        double c(1.0), c2(1.0), c3(1.0);
+        double s(0.0), s2(0.0);
+        const double el1(e[l + 1]);
+        for (int i(m - 1); l <= i; --i) {
+          c3 = c2;
+          c2 = c;
+          s2 = s;
+          g = c * e[i];
+          h = c * p;
+          r = std::hypot(p, e[i]);
+          e[i + 1] = s * r;
+          s = e[i] / r;
+          c = p / r;
+          p = c * d[i] - s * g;
+          d[i + 1] = h + s * (c * g + s * d[i]);
+
+          double* z0((*z)[i]);
+          double* z1((*z)[i + 1]);
+          for (int k(0); k < num_column; ++k) {
+            const double tmp(z1[k]);
+            z1[k] = s * z0[k] + c * tmp;
+            z0[k] = c * z0[k] - s * tmp;
+          }
+        }
+        p = -s * s2 * c3 * el1 * e[l] / dl1;
+        e[l] = s * p;
+        d[l] = c * p;
+      } while (epsilon * max_norm < std::fabs(e[l]));
+    }
+    d[l] += shift;
+    e[l] = 0.0;
+  }
+
+  return true;
+}
+
+// Get the indices of the values in descending order.
+void SortInDescendingOrder(int n, const double* values,
+                           std::vector<int>* indices) {
+  indices->resize(n);
+  for (int i(0); i < n; ++i) {
+    (*indices)[i] = i;
+  }
+  std::stable_sort(indices->begin(), indices->end(),
+                   [values](int a, int b) { return values[b] < values[a]; });
+}
+
+// Normalize the vector to unit length and make its largest element positive.
+void NormalizeEigenvector(int n, double* vector) {
+  double norm(0.0);
+  int max_index(0);
+  for (int i(0); i < n; ++i) {
+    norm += vector[i] * vector[i];
+    if (std::fabs(vector[max_index]) < std::fabs(vector[i])) {
+      max_index = i;
+    }
+  }
+  const double z(vector[max_index] < 0.0 ? -1.0 / std::sqrt(norm)
+                                         : 1.0 / std::sqrt(norm));
+  for (int i(0); i < n; ++i) {
+    vector[i] *= z;
+  }
+}
+
+// Orthogonalize the vector against the first n rows of the orthonormal basis.
+// The Gram-Schmidt process is applied twice, which is enough to keep
+// the orthogonality in floating-point arithmetic.
+void Orthogonalize(int n, int length, const sptk::Matrix& basis,
+                   double* vector) {
+  for (int pass(0); pass < 2; ++pass) {
+    for (int i(0); i < n; ++i) {
+      const double* q(basis[i]);
+      double dot(0.0);
+      for (int k(0); k < length; ++k) {
+        dot += q[k] * vector[k];
+      }
+      for (int k(0); k < length; ++k) {
+        vector[k] -= dot * q[k];
+      }
+    }
+  }
+}
 
 }  // namespace
 
@@ -229,4 +360,286 @@ bool SymmetricMatrix::Invert(SymmetricMatrix* inverse_matrix) const {
   return true;
 }
 
+bool SymmetricMatrix::EigenvalueDecomposition(std::vector<double>* eigenvalues,
+                                              Matrix* eigenvectors) const {
+  if (num_dimension_ <= 0 || NULL == eigenvalues || NULL == eigenvectors) {
+    return false;
+  }
+
+  const int n(num_dimension_);
+  Matrix v(n, n);
+  for (int i(0); i < n; ++i) {
+    for (int j(0); j <= i; ++j) {
+      v[i][j] = v[j][i] = index_[i][j];
+    }
+  }
+  std::vector<double> d(n);
+  std::vector<double> e(n);
+
+  // Reduce to tridiagonal form by Householder transformations.
+  for (int j(0); j < n; ++j) {
+    d[j] = v[n - 1][j];
+  }
+  for (int i(n - 1); 0 < i; --i) {
+    double scale(0.0);
+    double h(0.0);
+    for (int k(0); k < i; ++k) {
+      scale += std::fabs(d[k]);
+    }
+    if (0.0 == scale) {
+      e[i] = d[i - 1];
+      for (int j(0); j < i; ++j) {
+        d[j] = v[i - 1][j];
+        v[i][j] = 0.0;
+        v[j][i] = 0.0;
+      }
+    } else {
+      // Generate Householder vector.
+      for (int k(0); k < i; ++k) {
+        d[k] /= scale;
+        h += d[k] * d[k];
+      }
+      double f(d[i - 1]);
+      double g(0.0 < f ? -std::sqrt(h) : std::sqrt(h));
+      e[i] = scale * g;
+      h -= f * g;
+      d[i - 1] = f - g;
+      for (int j(0); j < i; ++j) {
+        e[j] = 0.0;
+      }
+
+      // Apply similarity transformation to remaining columns.
+      for (int j(0); j < i; ++j) {
+        f = d[j];
+        v[j][i] = f;
+        g = e[j] + v[j][j] * f;
+        for (int k(j + 1); k < i; ++k) {
+          g += v[k][j] * d[k];
+          e[k] += v[k][j] * f;
+        }
+        e[j] = g;
+      }
+      f = 0.0;
+      for (int j(0); j < i; ++j) {
+        e[j] /= h;
+        f += e[j] * d[j];
+      }
+      const double hh(f / (h + h));
+      for (int j(0); j < i; ++j) {
+        e[j] -= hh * d[j];
+      }
+      for (int j(0); j < i; ++j) {
+        f = d[j];
+        g = e[j];
+        for (int k(j); k < i; ++k) {
+          v[k][j] -= (f * e[k] + g * d[k]);
+        }
+        d[j] = v[i - 1][j];
+        v[i][j] = 0.0;
+      }
+    }
+    d[i] = h;
+  }
+
+  // Accumulate transformations.
+  for (int i(0); i < n - 1; ++i) {
+    v[n - 1][i] = v[i][i];
+    v[i][i] = 1.0;
+    const double h(d[i + 1]);
+    if (0.0 != h) {
+      for (int k(0); k <= i; ++k) {
+        d[k] = v[k][i + 1] / h;
+      }
+      for (int j(0); j <= i; ++j) {
+        double g(0.0);
+        for (int k(0); k <= i; ++k) {
+          g += v[k][i + 1] * v[k][j];
+        }
+        for (int k(0); k <= i; ++k) {
+          v[k][j] -= g * d[k];
+        }
+      }
+    }
+    for (int k(0); k <= i; ++k) {
+      v[k][i + 1] = 0.0;
+    }
+  }
+  for (int j(0); j < n; ++j) {
+    d[j] = v[n - 1][j];
+    v[n - 1][j] = 0.0;
+  }
+  v[n - 1][n - 1] = 1.0;
+
+  // The columns of v are the basis of the tridiagonal matrix, and e[i] holds
+  // T(i-1, i). Make them fit the QL method, which rotates rows.
+  Matrix z;
+  if (!v.Transpose(&z)) {
+    return false;
+  }
+  for (int i(1); i < n; ++i) {
+    e[i - 1] = e[i];
+  }
+  if (!SolveTridiagonalEigenproblem(n, &(d[0]), &(e[0]), &z)) {
+    return false;
+  }
+
+  std::vector<int> indices;
+  SortInDescendingOrder(n, &(d[0]), &indices);
+  eigenvalues->resize(n);
+  eigenvectors->Resize(n, n);
+  for (int i(0); i < n; ++i) {
+    (*eigenvalues)[i] = d[indices[i]];
+    std::copy(z[indices[i]], z[indices[i]] + n, (*eigenvectors)[i]);
+    NormalizeEigenvector(n, (*eigenvectors)[i]);
+  }
+
+  return true;
+}
+
+bool SymmetricMatrix::PartialEigenvalueDecomposition(
+    int num_eigenvalue, double convergence_threshold,
+    std::vector<double>* eigenvalues, Matrix* eigenvectors) const {
+  if (num_eigenvalue <= 0 || num_dimension_ < num_eigenvalue ||
+      convergence_threshold < 0.0 || NULL == eigenvalues ||
+      NULL == eigenvectors) {
+    return false;
+  }
+
+  const int n(num_dimension_);
+
+  // An invariant subspace is regarded as found if the norm of the residual
+  // vector is negligible compared with the norm of the matrix.
+  double squared_norm(0.0);
+  for (int i(0); i < n; ++i) {
+    for (int j(0); j < i; ++j) {
+      squared_norm += 2.0 * index_[i][j] * index_[i][j];
+    }
+    squared_norm += index_[i][i] * index_[i][i];
+  }
+  const double breakdown_threshold(std::numeric_limits<double>::epsilon() *
+                                   std::sqrt(squared_norm));
+
+  // The rows of q are the Lanczos vectors.
+  Matrix q(n, n);
+  std::vector<double> alpha(n);
+  std::vector<double> beta(n);
+  std::vector<double> w(n);
+  std::vector<double> d(n);
+  std::vector<double> e(n);
+  std::vector<int> indices;
+  Matrix z;
+
+  std::fill(q[0], q[0] + n, 1.0 / std::sqrt(static_cast<double>(n)));
+  for (int j(0); j < n; ++j) {
+    // Multiply the matrix by the current Lanczos vector.
+    const double* q_j(q[j]);
+    std::fill(w.begin(), w.end(), 0.0);
+    for (int i(0); i < n; ++i) {
+      const double* a(index_[i]);
+      double sum(0.0);
+      for (int k(0); k < i; ++k) {
+        sum += a[k] * q_j[k];
+        w[k] += a[k] * q_j[i];
+      }
+      w[i] += sum + a[i] * q_j[i];
+    }
+
+    alpha[j] = 0.0;
+    for (int k(0); k < n; ++k) {
+      alpha[j] += q_j[k] * w[k];
+    }
+
+    // The three-term recurrence is included in the full reorthogonalization.
+    Orthogonalize(j + 1, n, q, &(w[0]));
+    beta[j] = 0.0;
+    for (int k(0); k < n; ++k) {
+      beta[j] += w[k] * w[k];
+    }
+    beta[j] = std::sqrt(beta[j]);
+
+    const int num_step(j + 1);
+    const bool is_breakdown(beta[j] <= breakdown_threshold);
+    if (is_breakdown) {
+      beta[j] = 0.0;
+    }
+
+    // Check the convergence of the required Ritz pairs.
+    if (n == num_step ||
+        (num_eigenvalue <= num_step && !is_breakdown &&
+         0 == (num_step - num_eigenvalue) % kIntervalOfConvergenceCheck)) {
+      std::copy(alpha.begin(), alpha.begin() + num_step, d.begin());
+      std::copy(beta.begin(), beta.begin() + num_step, e.begin());
+      z.Resize(num_step, num_step);
+      z.FillDiagonal(1.0);
+      if (!SolveTridiagonalEigenproblem(num_step, &(d[0]), &(e[0]), &z)) {
+        return false;
+      }
+      SortInDescendingOrder(num_step, &(d[0]), &indices);
+
+      bool is_converged(true);
+      for (int i(0); i < num_eigenvalue; ++i) {
+        if (convergence_threshold <
+            beta[j] * std::fabs(z[indices[i]][num_step - 1])) {
+          is_converged = false;
+          break;
+        }
+      }
+
+      if (is_converged || n == num_step) {
+        eigenvalues->resize(num_eigenvalue);
+        eigenvectors->Resize(num_eigenvalue, n);
+        for (int i(0); i < num_eigenvalue; ++i) {
+          (*eigenvalues)[i] = d[indices[i]];
+          const double* s(z[indices[i]]);
+          double* x((*eigenvectors)[i]);
+          for (int l(0); l < num_step; ++l) {
+            const double* q_l(q[l]);
+            for (int k(0); k < n; ++k) {
+              x[k] += s[l] * q_l[k];
+            }
+          }
+          NormalizeEigenvector(n, x);
+        }
+        return true;
+      }
+    }
+
+    // Compute the next Lanczos vector. On breakdown, the iteration is
+    // restarted from the unit vector that is the farthest from the subspace.
+    double* q_next(q[j + 1]);
+    if (is_breakdown) {
+      int farthest_index(0);
+      double min_squared_projection(std::numeric_limits<double>::max());
+      for (int k(0); k < n; ++k) {
+        double squared_projection(0.0);
+        for (int l(0); l <= j; ++l) {
+          squared_projection += q[l][k] * q[l][k];
+        }
+        if (squared_projection < min_squared_projection) {
+          min_squared_projection = squared_projection;
+          farthest_index = k;
+        }
+      }
+      std::fill(q_next, q_next + n, 0.0);
+      q_next[farthest_index] = 1.0;
+      Orthogonalize(j + 1, n, q, q_next);
+      double norm(0.0);
+      for (int k(0); k < n; ++k) {
+        norm += q_next[k] * q_next[k];
+      }
+      const double inverse_norm(1.0 / std::sqrt(norm));
+      for (int k(0); k < n; ++k) {
+        q_next[k] *= inverse_norm;
+      }
+    } else {
+      const double inverse_beta(1.0 / beta[j]);
+      for (int k(0); k < n; ++k) {
+        q_next[k] = w[k] * inverse_beta;
+      }
+    }
+  }
+
+  return false;
+}
+
 }  // namespace sptk
@@ -16,13 +16,61 @@
 
 #include "SPTK/math/toeplitz_plus_hankel_system_solver.h"
 
+#include <cmath>    // std::fabs
 #include <cstddef>  // std::size_t
 
 namespace {
 
-void PutBar(int i, const std::vector<double>& x, std::vector<double>* y) {
-  (*y)[0] = x[i];
-  (*y)[1] = x[x.size() - 1 - i];
+// The same threshold as Matrix2D::Invert.
+const double kMinimumValueOfDeterminant(1e-6);
+
+// In the following functions, a 2x2 matrix is represented as four elements in
+// row-major order, and a 2-dimensional vector as two elements. They are
+// written without function calls or branches in the loops over the order so
+// that the compiler can keep the elements in registers.
+
+// c += a b
+inline void MultiplyAdd(const double* a, const double* b, double* c) {
+  c[0] += a[0] * b[0] + a[1] * b[2];
+  c[1] += a[0] * b[1] + a[1] * b[3];
+  c[2] += a[2] * b[0] + a[3] * b[2];
+  c[3] += a[2] * b[1] + a[3] * b[3];
+}
+
+// c += a b, where b is a vector.
+inline void MultiplyAddVector(const double* a, const double* b, double* c) {
+  c[0] += a[0] * b[0] + a[1] * b[1];
+  c[1] += a[2] * b[0] + a[3] * b[1];
+}
+
+// c -= J a^T J b, where J is the exchange matrix.
+inline void CrossTransposeMultiplySubtract(const double* a, const double* b,
+                                           double* c) {
+  c[0] -= a[3] * b[0] + a[2] * b[2];
+  c[1] -= a[3] * b[1] + a[2] * b[3];
+  c[2] -= a[1] * b[0] + a[0] * b[2];
+  c[3] -= a[1] * b[1] + a[0] * b[3];
+}
+
+// c += J a^T J b, where b is a vector.
+inline void CrossTransposeMultiplyAddVector(const double* a, const double* b,
+                                            double* c) {
+  c[0] += a[3] * b[0] + a[2] * b[1];
+  c[1] += a[1] * b[0] + a[0] * b[1];
+}
+
+// b = (J a^T J)^{-1}
+inline bool CrossTransposeInvert(const double* a, double* b) {
+  const double determinant(a[3] * a[0] - a[2] * a[1]);
+  if (std::fabs(determinant) < kMinimumValueOfDeterminant) {
+    return false;
+  }
+  const double inverse_of_determinant(1.0 / determinant);
+  b[0] = a[0] * inverse_of_determinant;
+  b[1] = -a[2] * inverse_of_determinant;
+  b[2] = -a[1] * inverse_of_determinant;
+  b[3] = a[3] * inverse_of_determinant;
+  return true;
 }
 
 }  // namespace
@@ -62,43 +110,48 @@ bool ToeplitzPlusHankelSystemSolver::Run(
   if (solution_vector->size() != static_cast<std::size_t>(length)) {
     solution_vector->resize(length);
   }
-  if (buffer->r_.size() != static_cast<std::size_t>(length)) {
-    buffer->r_.resize(length);
+  if (buffer->r_.size() != static_cast<std::size_t>(4 * length)) {
+    buffer->r_.resize(4 * length);
   }
-  if (buffer->x_.size() != static_cast<std::size_t>(length)) {
-    buffer->x_.resize(length);
+  if (buffer->x_.size() != static_cast<std::size_t>(4 * length)) {
+    buffer->x_.resize(4 * length);
   }
-  if (buffer->prev_x_.size() != static_cast<std::size_t>(length)) {
-    buffer->prev_x_.resize(length);
-  }
-  if (buffer->p_.size() != static_cast<std::size_t>(length)) {
-    buffer->p_.resize(length);
-    for (int i(0); i < length; ++i) {
-      buffer->p_[i].resize(2);
-    }
+  if (buffer->p_.size() != static_cast<std::size_t>(2 * length)) {
+    buffer->p_.resize(2 * length);
   }
 
+  const double* b(&(constant_vector[0]));
+  double* r(&(buffer->r_[0]));
+  double* x(&(buffer->x_[0]));
+  double* p(&(buffer->p_[0]));
+  double vx[4];
+  double ex[4];
+  double bx[4];
+  double inv[4];
+  double ep[2];
+  double g[2];
+
   // Step 0)
   {
     // Set R.
     const double* t(&(toeplitz_coefficient_vector[0]));
     const double* h(&(hankel_coefficient_vector[0]));
     for (int i(0); i < length; ++i) {
-      buffer->r_[i][0][0] = t[num_order_ + i];
-      buffer->r_[i][1][1] = t[num_order_ - i];
-      buffer->r_[i][0][1] = h[num_order_ + i];
-      buffer->r_[i][1][0] = h[num_order_ - i];
+      r[4 * i + 0] = t[num_order_ + i];
+      r[4 * i + 3] = t[num_order_ - i];
+      r[4 * i + 1] = h[num_order_ + i];
+      r[4 * i + 2] = h[num_order_ - i];
     }
 
     if (coefficients_modification_) {
       const double d0(t[num_order_]);
       for (int i(0); i < length; i += 2) {
-        buffer->r_[i][0][0] += d0;
-        buffer->r_[i][1][1] += d0;
+        r[4 * i + 0] += d0;
+        r[4 * i + 3] += d0;
       }
       for (int i((0 == num_order_ % 2) ? 0 : 1); i < length; i += 2) {
-        buffer->r_[i][0][1] -= d0;
-        buffer->r_[i][1][0] -= d0;
+        r[4 * i + 1] -= d0;
+        r[4 * i + 2] -= d0;
       }
     }
   }
@@ -106,103 +159,93 @@ bool ToeplitzPlusHankelSystemSolver::Run(
   // Step 1)
   {
     // Set X_0.
-    buffer->x_[0].FillDiagonal(1.0);
+    x[0] = 1.0;
+    x[1] = 0.0;
+    x[2] = 0.0;
+    x[3] = 1.0;
 
     // Set p_0.
-    PutBar(0, constant_vector, &buffer->bar_);
-    if (!buffer->r_[0].Invert(&buffer->inv_) ||
-        !sptk::Matrix2D::Multiply(buffer->inv_, buffer->bar_, &buffer->p_[0])) {
-      return false;
+    {
+      const double determinant(r[0] * r[3] - r[1] * r[2]);
+      if (std::fabs(determinant) < kMinimumValueOfDeterminant) {
+        return false;
+      }
+      const double inverse_of_determinant(1.0 / determinant);
+      inv[0] = r[3] * inverse_of_determinant;
+      inv[1] = -r[1] * inverse_of_determinant;
+      inv[2] = -r[2] * inverse_of_determinant;
+      inv[3] = r[0] * inverse_of_determinant;
     }
+    const double bar[2] = {b[0], b[num_order_]};
+    p[0] = inv[0] * bar[0] + inv[1] * bar[1];
+    p[1] = inv[2] * bar[0] + inv[3] * bar[1];
 
     // Set V_x.
-    buffer->vx_ = buffer->r_[0];
+    for (int k(0); k < 4; ++k) {
+      vx[k] = r[k];
+    }
   }
 
   // Step 2)
   for (int i(1); i < length; ++i) {
-    // a) Calculate E_x.
-    buffer->ex_.Fill(0.0);
+    // a) Calculate E_x and b) calculate \bar{e}_p.
+    ex[0] = ex[1] = ex[2] = ex[3] = 0.0;
+    ep[0] = ep[1] = 0.0;
     for (int j(0); j < i; ++j) {
-      if (!sptk::Matrix2D::Multiply(buffer->r_[i - j], buffer->x_[j],
-                                    &buffer->tmp_matrix_) ||
-          !sptk::Matrix2D::Add(buffer->tmp_matrix_, &buffer->ex_)) {
-        return false;
-      }
-    }
-
-    // b) Calculate \bar{e}_p.
-    buffer->ep_[0] = 0.0;
-    buffer->ep_[1] = 0.0;
-    for (int j(0); j < i; ++j) {
-      if (!sptk::Matrix2D::Multiply(buffer->r_[i - j], buffer->p_[j],
-                                    &buffer->tmp_vector_)) {
-        return false;
-      }
-      buffer->ep_[0] += buffer->tmp_vector_[0];
-      buffer->ep_[1] += buffer->tmp_vector_[1];
+      const double* rij(r + 4 * (i - j));
+      MultiplyAdd(rij, x + 4 * j, ex);
+      MultiplyAddVector(rij, p + 2 * j, ep);
     }
 
     // c) Calculate B_x.
-    if (!buffer->vx_.CrossTranspose(&buffer->tau_) ||
-        !buffer->tau_.Invert(&buffer->inv_) ||
-        !sptk::Matrix2D::Multiply(buffer->inv_, buffer->ex_, &buffer->bx_)) {
+    if (!CrossTransposeInvert(vx, inv)) {
       return false;
     }
-
-    // d) Update X.
-    for (int j(1); j < i; ++j) {
-      if (!buffer->prev_x_[i - j].CrossTranspose(&buffer->tau_) ||
-          !sptk::Matrix2D::Multiply(buffer->tau_, buffer->bx_,
-                                    &buffer->tmp_matrix_) ||
-          !sptk::Matrix2D::Subtract(buffer->tmp_matrix_, &buffer->x_[j])) {
-        return false;
+    bx[0] = bx[1] = bx[2] = bx[3] = 0.0;
+    MultiplyAdd(inv, ex, bx);
+
+    // d) Update X. X_j and X_{i-j} are updated at the same time so that the
+    // previous values are not overwritten before being used.
+    for (int j(1), k(i - 1); j <= k; ++j, --k) {
+      double* xj(x + 4 * j);
+      double* xk(x + 4 * k);
+      const double prev_xj[4] = {xj[0], xj[1], xj[2], xj[3]};
+      if (j != k) {
+        CrossTransposeMultiplySubtract(xk, bx, xj);
+      } else {
+        CrossTransposeMultiplySubtract(prev_xj, bx, xj);
+        break;
       }
+      CrossTransposeMultiplySubtract(prev_xj, bx, xk);
     }
-    buffer->x_[i].Negate(buffer->bx_);
-    for (int j(1); j <= i; ++j) {
-      buffer->prev_x_[j] = buffer->x_[j];
+    for (int k(0); k < 4; ++k) {
+      x[4 * i + k] = -bx[k];
     }
 
     // d) Update V_x.
-    if (!buffer->ex_.CrossTranspose(&buffer->tau_) ||
-        !sptk::Matrix2D::Multiply(buffer->tau_, buffer->bx_,
-                                  &buffer->tmp_matrix_) ||
-        !sptk::Matrix2D::Subtract(buffer->tmp_matrix_, &buffer->vx_)) {
-      return false;
-    }
+    CrossTransposeMultiplySubtract(ex, bx, vx);
 
     // e) Calculate \bar{g}.
-    if (!buffer->vx_.CrossTranspose(&buffer->tau_) ||
-        !buffer->tau_.Invert(&buffer->inv_)) {
-      return false;
-    }
-    PutBar(i, constant_vector, &buffer->bar_);
-    buffer->tmp_vector_[0] = buffer->bar_[0] - buffer->ep_[0];
-    buffer->tmp_vector_[1] = buffer->bar_[1] - buffer->ep_[1];
-    if (!sptk::Matrix2D::Multiply(buffer->inv_, buffer->tmp_vector_,
-                                  &buffer->g_)) {
+    if (!CrossTransposeInvert(vx, inv)) {
       return false;
     }
+    const double bar[2] = {b[i] - ep[0], b[num_order_ - i] - ep[1]};
+    g[0] = inv[0] * bar[0] + inv[1] * bar[1];
+    g[1] = inv[2] * bar[0] + inv[3] * bar[1];
 
     // f) Update \bar{p}.
     for (int j(0); j < i; ++j) {
-      if (!buffer->x_[i - j].CrossTranspose(&buffer->tau_) ||
-          !sptk::Matrix2D::Multiply(buffer->tau_, buffer->g_,
-                                    &buffer->tmp_vector_)) {
-        return false;
-      }
-      buffer->p_[j][0] += buffer->tmp_vector_[0];
-      buffer->p_[j][1] += buffer->tmp_vector_[1];
+      CrossTransposeMultiplyAddVector(x + 4 * (i - j), g, p + 2 * j);
     }
-    buffer->p_[i] = buffer->g_;
+    p[2 * i + 0] = g[0];
+    p[2 * i + 1] = g[1];
   }
 
   // Step 3)
   {
     double* a(&((*solution_vector)[0]));
     for (int i(0); i < length; ++i) {
-      a[i] = buffer->p_[i][0];
+      a[i] = p[2 * i];
     }
   }
 
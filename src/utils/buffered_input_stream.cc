@@ -0,0 +1,89 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/utils/buffered_input_stream.h"
+
+#include <algorithm>  // std::copy
+
+namespace {
+
+// 64 KiB is large enough to amortize the cost of std::istream::read.
+const int kDefaultBufferSize(65536);
+
+}  // namespace
+
+namespace sptk {
+
+BufferedInputStream::BufferedInputStream(std::istream* input_stream)
+    : BufferedInputStream(input_stream, kDefaultBufferSize) {
+}
+
+BufferedInputStream::BufferedInputStream(std::istream* input_stream,
+                                         int buffer_size)
+    : input_stream_(input_stream), is_valid_(true), position_(0), end_(0) {
+  if (NULL == input_stream_ || buffer_size <= 0) {
+    is_valid_ = false;
+    return;
+  }
+  buffer_.resize(buffer_size);
+}
+
+bool BufferedInputStream::Fill(std::size_t num_required_bytes) {
+  if (!is_valid_ || buffer_.size() < num_required_bytes) {
+    return false;
+  }
+
+  // Move remaining data to the head of buffer.
+  const std::size_t num_remaining_bytes(end_ - position_);
+  if (0 < num_remaining_bytes && 0 < position_) {
+    std::copy(buffer_.begin() + position_, buffer_.begin() + end_,
+              buffer_.begin());
+  }
+  position_ = 0;
+  end_ = num_remaining_bytes;
+
+  // Fill the whole free space so that a pipe is read in large blocks too.
+  // std::istream::readsome is not used since it returns nothing for
+  // std::cin synchronized with stdio.
+  if (!input_stream_->eof()) {
+    input_stream_->read(&(buffer_[end_]), buffer_.size() - end_);
+    end_ += static_cast<std::size_t>(input_stream_->gcount());
+  }
+
+  return num_required_bytes <= end_;
+}
+
+int BufferedInputStream::ReadBytes(std::size_t num_bytes,
+                                   std::size_t unit_size, char* data_to_read) {
+  if (!is_valid_) {
+    return 0;
+  }
+
+  // Wait for at least one unit and return what is buffered.
+  if (end_ - position_ < unit_size && !Fill(unit_size)) {
+    return 0;
+  }
+  const std::size_t num_available_bytes(end_ - position_);
+  const std::size_t num_read_bytes(std::min(
+      num_bytes, num_available_bytes - num_available_bytes % unit_size));
+  std::copy(buffer_.begin() + position_,
+            buffer_.begin() + position_ + num_read_bytes, data_to_read);
+  position_ += num_read_bytes;
+
+  return static_cast<int>(num_read_bytes);
+}
+
+}  // namespace sptk
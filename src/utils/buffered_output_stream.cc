@@ -0,0 +1,82 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/utils/buffered_output_stream.h"
+
+#include <algorithm>  // std::copy
+
+namespace {
+
+// 64 KiB is large enough to amortize the cost of std::ostream::write.
+const int kDefaultBufferSize(65536);
+
+}  // namespace
+
+namespace sptk {
+
+BufferedOutputStream::BufferedOutputStream(std::ostream* output_stream)
+    : BufferedOutputStream(output_stream, kDefaultBufferSize) {
+}
+
+BufferedOutputStream::BufferedOutputStream(std::ostream* output_stream,
+                                           int buffer_size)
+    : output_stream_(output_stream), is_valid_(true), position_(0) {
+  if (NULL == output_stream_ || buffer_size <= 0) {
+    is_valid_ = false;
+    return;
+  }
+  buffer_.resize(buffer_size);
+}
+
+bool BufferedOutputStream::Flush() {
+  if (!is_valid_) {
+    return false;
+  }
+
+  if (0 < position_) {
+    output_stream_->write(&(buffer_[0]), position_);
+    position_ = 0;
+  }
+
+  // Also flush the underlying stream to detect write errors here.
+  output_stream_->flush();
+
+  return !output_stream_->fail();
+}
+
+bool BufferedOutputStream::WriteBytes(std::size_t num_bytes,
+                                      const char* data_to_write) {
+  if (!is_valid_) {
+    return false;
+  }
+
+  if (num_bytes <= buffer_.size() - position_) {
+    std::copy(data_to_write, data_to_write + num_bytes,
+              buffer_.begin() + position_);
+    position_ += num_bytes;
+    return true;
+  }
+
+  // Write large data directly to the stream to avoid extra copy.
+  if (!Flush()) {
+    return false;
+  }
+  output_stream_->write(data_to_write, num_bytes);
+
+  return !output_stream_->fail();
+}
+
+}  // namespace sptk
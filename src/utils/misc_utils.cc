@@ -147,7 +147,8 @@ bool ComputePercentagePointOfTDistribution(double probability,
 bool MakePseudoQuadratureMirrorFilterBanks(
     bool inverse, int num_subband, int num_filter_order, double attenuation,
     int num_iteration, double convergence_threshold, double initial_step_size,
-    std::vector<std::vector<double> >* filter_banks, bool* is_converged) {
+    std::vector<std::vector<double> >* filter_banks, bool* is_converged,
+    std::vector<double>* prototype_filter) {
   if (0 == num_subband || num_filter_order <= 1 || attenuation <= 0.0 ||
       0 == num_iteration || convergence_threshold < 0.0 ||
       initial_step_size <= 0.0 || NULL == filter_banks) {
@@ -158,7 +159,7 @@ bool MakePseudoQuadratureMirrorFilterBanks(
 
   // Design prototype filter.
   const int filter_size(num_filter_order + 1);
-  std::vector<double> prototype_filter(filter_size);
+  std::vector<double> prototype(filter_size);
   {
     // Make Kaiser window.
     const sptk::KaiserWindow kaiser_window(
@@ -198,11 +199,11 @@ bool MakePseudoQuadratureMirrorFilterBanks(
 
       // Make prototype filter.
       std::transform(ideal_filter.begin(), ideal_filter.end(), window.begin(),
-                     prototype_filter.begin(),
+                     prototype.begin(),
                      [](double h, double w) { return h * w; });
 
       // Get frequency response of the prototype filter.
-      if (!fft.Run(prototype_filter, &real, &imag, &buffer_for_fft)) {
+      if (!fft.Run(prototype, &real, &imag, &buffer_for_fft)) {
         return false;
       }
 
@@ -233,7 +234,7 @@ bool MakePseudoQuadratureMirrorFilterBanks(
     int sign(inverse ? -1 : 1);
     for (int k(0); k < num_subband; ++k) {
       (*filter_banks)[k].resize(filter_size);
-      double* p(&(prototype_filter[0]));
+      double* p(&(prototype[0]));
       double* h(&((*filter_banks)[k][0]));
       for (int n(0); n < filter_size; ++n) {
         const double a((2 * k + 1) * sptk::kPi / (2 * num_subband) *
@@ -245,6 +246,11 @@ bool MakePseudoQuadratureMirrorFilterBanks(
       sign *= -1;
     }
   }
+
+  if (NULL != prototype_filter) {
+    *prototype_filter = prototype;
+  }
+
   return true;
 }
 
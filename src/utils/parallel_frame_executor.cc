@@ -0,0 +1,259 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/utils/parallel_frame_executor.h"
+
+#include <algorithm>           // std::min
+#include <condition_variable>  // std::condition_variable
+#include <iostream>            // std::cerr
+#include <mutex>               // std::mutex, std::unique_lock
+#include <sstream>             // std::ostringstream
+#include <thread>              // std::thread
+
+namespace {
+
+// Number of consecutive frames processed by a thread at once.
+const int kNumFrameInJob(16);
+
+// Number of jobs in flight per thread, which bounds the memory usage.
+const int kNumJobPerThread(4);
+
+struct Job {
+  std::vector<std::vector<double> > inputs;
+  std::vector<std::vector<double> > outputs;
+  std::ostringstream log;
+  int num_frame;
+  int num_processed_frame;
+  bool is_ready;
+};
+
+}  // namespace
+
+namespace sptk {
+
+ParallelFrameExecutor::ParallelFrameExecutor(
+    const std::vector<FrameProcessorInterface*>& frame_processors)
+    : frame_processors_(frame_processors), is_valid_(true) {
+  if (frame_processors_.empty()) {
+    is_valid_ = false;
+    return;
+  }
+  for (FrameProcessorInterface* frame_processor : frame_processors_) {
+    if (NULL == frame_processor) {
+      is_valid_ = false;
+      return;
+    }
+  }
+}
+
+bool ParallelFrameExecutor::Run(InputSourceInterface* input_source,
+                                std::ostream* output_stream,
+                                bool* is_processed) {
+  // Check inputs.
+  if (!is_valid_ || NULL == input_source || NULL == output_stream) {
+    return false;
+  }
+
+  if (1 == GetNumThread()) {
+    return RunSequentially(input_source, output_stream, is_processed);
+  }
+
+  // The jobs in flight have consecutive IDs, so that the job of ID n is held
+  // in the (n % num_job)-th slot. The slots also work as the reorder buffer.
+  const int num_job(kNumJobPerThread * GetNumThread());
+  std::vector<Job> jobs(num_job);
+  for (Job& job : jobs) {
+    job.inputs.resize(kNumFrameInJob);
+    job.outputs.resize(kNumFrameInJob);
+    job.is_ready = false;
+  }
+
+  std::mutex input_mutex;
+  std::mutex mutex;
+  std::condition_variable condition;
+  int next_read_id(0);
+  int next_write_id(0);
+  bool is_end(false);
+  bool is_failed(false);
+
+  const auto work([&](FrameProcessorInterface* frame_processor) {
+    for (;;) {
+      // Read frames in turn.
+      std::unique_lock<std::mutex> input_lock(input_mutex);
+      int id;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&] {
+          return is_end || is_failed || next_read_id - next_write_id < num_job;
+        });
+        if (is_end || is_failed) return;
+        id = next_read_id;
+      }
+      Job& job(jobs[id % num_job]);
+      int num_frame(0);
+      while (num_frame < kNumFrameInJob &&
+             input_source->Get(&job.inputs[num_frame])) {
+        ++num_frame;
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (num_frame < kNumFrameInJob) is_end = true;
+        if (0 < num_frame) ++next_read_id;
+      }
+      condition.notify_all();
+      input_lock.unlock();
+      if (0 == num_frame) return;
+
+      // Process frames.
+      job.log.str("");
+      int num_processed_frame(0);
+      while (num_processed_frame < num_frame &&
+             frame_processor->Run(id * kNumFrameInJob + num_processed_frame,
+                                  job.inputs[num_processed_frame],
+                                  &job.outputs[num_processed_frame],
+                                  &job.log)) {
+        ++num_processed_frame;
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        job.num_frame = num_frame;
+        job.num_processed_frame = num_processed_frame;
+        job.is_ready = true;
+        if (num_processed_frame < num_frame) is_failed = true;
+      }
+      condition.notify_all();
+    }
+  });
+
+  std::vector<std::thread> threads;
+  for (FrameProcessorInterface* frame_processor : frame_processors_) {
+    threads.emplace_back(work, frame_processor);
+  }
+
+  // Write the results in order.
+  bool is_success(true);
+  bool is_processed_successfully(true);
+  for (;;) {
+    Job* job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&] {
+        return jobs[next_write_id % num_job].is_ready ||
+               ((is_end || is_failed) && next_write_id == next_read_id);
+      });
+      job = &jobs[next_write_id % num_job];
+      if (!job->is_ready) break;
+    }
+
+    // The messages of the frames after a failure are not generated because
+    // the job stops there, and those of the later jobs are not written.
+    std::cerr << job->log.str();
+    for (int i(0); i < job->num_processed_frame; ++i) {
+      const std::vector<double>& output(job->outputs[i]);
+      if (!WriteStream(0, static_cast<int>(output.size()), output,
+                       output_stream, NULL)) {
+        is_success = false;
+        break;
+      }
+    }
+    if (job->num_processed_frame < job->num_frame) {
+      is_success = false;
+      is_processed_successfully = false;
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      job->is_ready = false;
+      ++next_write_id;
+      if (!is_success) is_failed = true;
+    }
+    condition.notify_all();
+    if (!is_success) break;
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (NULL != is_processed) {
+    *is_processed = is_processed_successfully;
+  }
+
+  return is_success;
+}
+
+bool ParallelFrameExecutor::RunSequentially(InputSourceInterface* input_source,
+                                            std::ostream* output_stream,
+                                            bool* is_processed) {
+  if (NULL != is_processed) {
+    *is_processed = true;
+  }
+
+  FrameProcessorInterface* frame_processor(frame_processors_[0]);
+  std::vector<double> input;
+  std::vector<double> output;
+  for (int frame_index(0); input_source->Get(&input); ++frame_index) {
+    if (!frame_processor->Run(frame_index, input, &output, &std::cerr)) {
+      if (NULL != is_processed) {
+        *is_processed = false;
+      }
+      return false;
+    }
+    if (!WriteStream(0, static_cast<int>(output.size()), output, output_stream,
+                     NULL)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool ParallelFrameExecutor::RunInChunks(
+    int num_item, int num_chunk,
+    const std::function<bool(int, int, int)>& job) {
+  if (num_item < 0 || num_chunk <= 0) {
+    return false;
+  }
+
+  std::vector<int> is_success(num_chunk);
+  const auto work([&](int i) {
+    const int begin(num_item / num_chunk * i +
+                    std::min(i, num_item % num_chunk));
+    const int end(num_item / num_chunk * (i + 1) +
+                  std::min(i + 1, num_item % num_chunk));
+    is_success[i] = job(i, begin, end);
+  });
+
+  // The last chunk is processed by the calling thread.
+  std::vector<std::thread> threads;
+  for (int i(0); i < num_chunk - 1; ++i) {
+    threads.emplace_back(work, i);
+  }
+  work(num_chunk - 1);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (int i(0); i < num_chunk; ++i) {
+    if (!is_success[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace sptk
@@ -68,6 +68,39 @@ bool ReadStream(sptk::Matrix* matrix_to_read, std::istream* input_stream) {
                                                     : false;
 }
 
+bool ReadStream(sptk::Matrix* matrix_to_read, std::istream* input_stream,
+                int* actual_num_row) {
+  if (NULL == matrix_to_read || 0 == matrix_to_read->GetNumRow() ||
+      0 == matrix_to_read->GetNumColumn() || NULL == input_stream ||
+      input_stream->eof()) {
+    return false;
+  }
+
+  const int num_column(matrix_to_read->GetNumColumn());
+  const int row_bytes(sizeof((*matrix_to_read)[0][0]) * num_column);
+  input_stream->read(reinterpret_cast<char*>(&((*matrix_to_read)[0][0])),
+                     row_bytes * matrix_to_read->GetNumRow());
+
+  const int num_read_row(static_cast<int>(input_stream->gcount()) / row_bytes);
+  if (NULL != actual_num_row) {
+    *actual_num_row = num_read_row;
+  }
+  if (0 == num_read_row) {
+    return false;
+  }
+
+  if (num_read_row < matrix_to_read->GetNumRow()) {
+    sptk::Matrix read_rows;
+    if (!matrix_to_read->GetSubmatrix(0, num_read_row, 0, num_column,
+                                      &read_rows)) {
+      return false;
+    }
+    *matrix_to_read = read_rows;
+  }
+
+  return true;
+}
+
 bool ReadStream(sptk::SymmetricMatrix* matrix_to_read,
                 std::istream* input_stream) {
   if (NULL == matrix_to_read) {
@@ -505,9 +538,15 @@ void PrintDataType(const std::string& symbol, std::ostream* stream) {
 
 void PrintErrorMessage(const std::string& program_name,
                        const std::ostringstream& message) {
-  std::ostringstream stream;
-  stream << program_name << ": " << message.str() << "!" << std::endl;
-  std::cerr << stream.str();
+  PrintErrorMessage(program_name, message, &std::cerr);
+}
+
+void PrintErrorMessage(const std::string& program_name,
+                       const std::ostringstream& message,
+                       std::ostream* stream) {
+  std::ostringstream tmp;
+  tmp << program_name << ": " << message.str() << "!" << std::endl;
+  *stream << tmp.str();
 }
 
 // clang-format off
@@ -104,6 +104,8 @@ void MakeTrapezoidal(bool periodic, std::vector<double>* window) {
 
 namespace sptk {
 
+const int StandardWindow::kNumIndexedWindowTypes;
+
 StandardWindow::StandardWindow(int window_length, WindowType window_type,
                                bool periodic)
     : window_length_(window_length),
@@ -165,4 +167,43 @@ StandardWindow::StandardWindow(int window_length, WindowType window_type,
   }
 }
 
+bool StandardWindow::GetWindowTypeFromIndex(int index,
+                                            WindowType* window_type) {
+  if (NULL == window_type) {
+    return false;
+  }
+
+  switch (index) {
+    case 0: {
+      *window_type = kBlackman;
+      break;
+    }
+    case 1: {
+      *window_type = kHamming;
+      break;
+    }
+    case 2: {
+      *window_type = kHanning;
+      break;
+    }
+    case 3: {
+      *window_type = kBartlett;
+      break;
+    }
+    case 4: {
+      *window_type = kTrapezoidal;
+      break;
+    }
+    case 5: {
+      *window_type = kRectangular;
+      break;
+    }
+    default: {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
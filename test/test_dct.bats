@@ -40,11 +40,17 @@ teardown() {
     run $sptk4/aeq $tmp/1 $tmp/2
     [ "$status" -eq 0 ]
 
-    # DFT instead of FFT
+    # Mixed-radix FFT
     $sptk3/nrand -l 20 | $sptk3/dct -l 10 > $tmp/1
     $sptk3/nrand -l 20 | $sptk4/dct -l 10 > $tmp/2
     run $sptk4/aeq $tmp/1 $tmp/2
     [ "$status" -eq 0 ]
+
+    # Bluestein's FFT
+    $sptk3/nrand -l 22 | $sptk3/dct -l 11 > $tmp/1
+    $sptk3/nrand -l 22 | $sptk4/dct -l 11 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
 }
 
 @test "dct: reversibility" {
@@ -52,6 +58,11 @@ teardown() {
     $sptk4/dct -l 8 $tmp/1 | $sptk4/idct -l 8 > $tmp/2
     run $sptk4/aeq $tmp/1 $tmp/2
     [ "$status" -eq 0 ]
+
+    $sptk3/nrand -l 26 > $tmp/1
+    $sptk4/dct -l 13 $tmp/1 | $sptk4/idct -l 13 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
 }
 
 @test "dct: valgrind" {
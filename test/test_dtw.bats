@@ -45,6 +45,74 @@ teardown() {
     done
 }
 
+@test "dtw: global path constraint" {
+    $sptk3/nrand -s 1 -l 100 > $tmp/0_q
+    $sptk3/nrand -s 2 -l 80 > $tmp/0_r
+
+    for p in $(seq 0 6); do
+        $sptk4/dtw -l 2 -p "$p" $tmp/0_r $tmp/0_q -S $tmp/1_s > $tmp/1
+        $sptk4/dtw -l 2 -p "$p" -g 1 -w 100 \
+                   $tmp/0_r $tmp/0_q -S $tmp/2_s > $tmp/2
+        run $sptk4/aeq $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+        run $sptk4/aeq $tmp/1_s $tmp/2_s
+        [ "$status" -eq 0 ]
+        $sptk4/dtw -l 2 -p "$p" -s $tmp/0_r $tmp/0_q > $tmp/3_s
+        run $sptk4/aeq $tmp/1_s $tmp/3_s
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "dtw: narrow global path constraint" {
+    # Only the first frame of the reference is zero, so the band keeps the
+    # zeros of the query from being aligned with it.
+    echo 0 1 1 1 1 1 1 1 | $sptk3/x2x +ad > $tmp/0_r
+    echo 0 0 0 0 1 1 1 1 | $sptk3/x2x +ad > $tmp/0_q
+
+    # The scores are normalized by the sum of the lengths.
+    ary1=("-g 0" "-g 1 -w 3" "-g 1 -w 1" "-g 2 -x 2")
+    ary2=(0 0 4 5)
+    for i in $(seq 0 $((${#ary1[@]} - 1))); do
+        # shellcheck disable=SC2086
+        $sptk4/dtw -l 1 -p 1 -d 0 ${ary1[$i]} -s $tmp/0_r $tmp/0_q > $tmp/1
+        echo "${ary2[$i]}" | $sptk3/x2x +ad | $sptk3/sopr -d 16 > $tmp/2
+        run $sptk4/aeq $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+
+    # The Viterbi path is in the band.
+    $sptk4/dtw -l 1 -p 1 -d 0 -g 1 -w 1 $tmp/0_r $tmp/0_q -P $tmp/3 > /dev/null
+    $sptk3/x2x +ia -c 2 $tmp/3 | awk '{ d = $1 - $2; if (1 < d * d) exit 1 }'
+}
+
+@test "dtw: FastDTW" {
+    # Compare the Viterbi path of FastDTW with that of exact DTW. The query is
+    # longer than the reference because -p 2 cannot skip reference vectors.
+    $sptk3/sin -p 50 -l 500 | $sptk3/sopr -m 0.9 > $tmp/0_q
+    $sptk3/sin -p 40 -l 400 > $tmp/0_r
+
+    for p in $(seq 0 6); do
+        $sptk4/dtw -l 1 -p "$p" $tmp/0_r $tmp/0_q \
+                   -P $tmp/1_p -S $tmp/1_s > $tmp/1
+        $sptk4/dtw -l 1 -p "$p" -r 10 $tmp/0_r $tmp/0_q \
+                   -P $tmp/2_p -S $tmp/2_s > $tmp/2
+        $sptk3/x2x +id $tmp/1_p > $tmp/1_pd
+        $sptk3/x2x +id $tmp/2_p > $tmp/2_pd
+        run $sptk4/aeq $tmp/1_pd $tmp/2_pd
+        [ "$status" -eq 0 ]
+        run $sptk4/aeq $tmp/1_s $tmp/2_s
+        [ "$status" -eq 0 ]
+    done
+
+    # The global path constraint is not supported by FastDTW.
+    ary=("-g 1" "-g 2" "-w 3" "-x 2")
+    for i in $(seq 0 $((${#ary[@]} - 1))); do
+        # shellcheck disable=SC2086
+        run $sptk4/dtw -l 1 -r 10 ${ary[$i]} $tmp/0_r $tmp/0_q
+        [ "$status" -eq 1 ]
+    done
+}
+
 @test "dtw: valgrind" {
     $sptk3/nrand -l 20 > $tmp/0
     run valgrind $sptk4/dtw -l 2 -p 4 $tmp/0 $tmp/0
@@ -45,6 +45,30 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "fft: odd powers of two" {
+    # Compare the radix-4 path with a final radix-2 stage with naive DFT.
+    for l in 8 32 512 2048; do
+        $sptk3/nrand -l $((2 * l)) > $tmp/1
+        $sptk4/x2x +da -f %.17g $tmp/1 |
+            awk -v l="$l" '{ x[NR - 1] = $1 } END {
+                pi = atan2(0, -1)
+                for (k = 0; k < l; k++) {
+                    re[k] = 0; im[k] = 0
+                    for (n = 0; n < l; n++) {
+                        w = -2 * pi * ((k * n) % l) / l
+                        re[k] += x[n] * cos(w) - x[n + l] * sin(w)
+                        im[k] += x[n] * sin(w) + x[n + l] * cos(w)
+                    }
+                }
+                for (k = 0; k < l; k++) printf "%.17g\n", re[k]
+                for (k = 0; k < l; k++) printf "%.17g\n", im[k]
+            }' | $sptk4/x2x +ad > $tmp/2
+        $sptk4/fft -l "$l" $tmp/1 > $tmp/3
+        run $sptk4/aeq -t 1e-8 $tmp/2 $tmp/3
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "fft: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/fft -m 4 -l 8 $tmp/1
@@ -36,6 +36,15 @@ teardown() {
     done
 }
 
+@test "fftcep: threads" {
+    $sptk3/x2x +sd asset/data.short |
+        $sptk3/frame -l 400 -p 80 | $sptk3/window -l 400 -L 512 > $tmp/0
+    $sptk4/fftcep -l 512 -m 24 -j 1 $tmp/0 > $tmp/1
+    $sptk4/fftcep -l 512 -m 24 -j 4 $tmp/0 > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "fftcep: valgrind" {
     $sptk3/nrand -l 32 > $tmp/1
     run valgrind $sptk4/fftcep -l 16 -m 4 -i 3 $tmp/1
@@ -34,6 +34,13 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "freqt: compatibility (multiple blocks)" {
+    $sptk3/nrand -l 6000 | $sptk3/freqt -m 9 -M 19 -a 0.1 -A 0.3 > $tmp/1
+    $sptk3/nrand -l 6000 | $sptk4/freqt -m 9 -M 19 -a 0.1 -A 0.3 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "freqt: identity" {
     $sptk3/nrand -l 20 > $tmp/1
     $sptk4/freqt -m 9 -M 9 -a 0.0 -A 0.0 $tmp/1 > $tmp/2
@@ -58,3 +58,11 @@ teardown() {
     run valgrind $sptk4/gmm -l 2 -k 2 $tmp/1
     [ "$(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/')" -eq 0 ]
 }
+
+@test "gmm: multithreading" {
+    $sptk3/nrand -s 3 -l 1024 > $tmp/0
+    $sptk4/gmm -l 4 -k 4 -f $tmp/0 > $tmp/1
+    $sptk4/gmm -l 4 -k 4 -f -j 3 $tmp/0 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
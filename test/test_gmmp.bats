@@ -40,6 +40,26 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "gmmp: block processing" {
+    # Frames are scored 64 at a time. Compare with scoring one by one.
+    $sptk3/nrand -s 1 -l 1024 > $tmp/1
+    $sptk3/nrand -s 2 -l 400 > $tmp/2
+    for f in "" "-f"; do
+        # shellcheck disable=SC2086
+        $sptk4/gmm -l 4 -k 4 $f $tmp/1 > $tmp/3
+        # shellcheck disable=SC2086
+        $sptk4/gmmp -l 4 -k 4 $f $tmp/3 $tmp/2 > $tmp/4
+        rm -f $tmp/5
+        for t in $(seq 0 99); do
+            # shellcheck disable=SC2086
+            $sptk3/bcut +d -l 4 -s "$t" -e "$t" $tmp/2 |
+                $sptk4/gmmp -l 4 -k 4 $f $tmp/3 >> $tmp/5
+        done
+        run $sptk4/aeq $tmp/4 $tmp/5
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "gmmp: valgrind" {
     $sptk3/nrand -s 1 -l 32 | $sptk4/gmm -l 2 -k 2 > $tmp/1
     $sptk3/nrand -s 2 -l 16 > $tmp/2
@@ -27,6 +27,25 @@ teardown() {
     rm -rf $tmp
 }
 
+@test "huffman: default codes" {
+    echo 0.1 0.4 0.2 0.2 0.1 | $sptk3/x2x +ad > $tmp/1
+    $sptk4/huffman $tmp/1 > $tmp/2
+    printf "0 100\n1 11\n2 00\n3 01\n4 101\n" > $tmp/3
+    run diff $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
+@test "huffman: canonical codes" {
+    echo 0.1 0.4 0.2 0.2 0.1 | $sptk3/x2x +ad > $tmp/1
+    $sptk4/huffman -c -L $tmp/2 $tmp/1 > $tmp/3
+    printf "0 110\n1 00\n2 01\n3 10\n4 111\n" > $tmp/4
+    run diff $tmp/3 $tmp/4
+    [ "$status" -eq 0 ]
+    $sptk4/huffman -L $tmp/5 $tmp/1 > /dev/null
+    run cmp $tmp/2 $tmp/5
+    [ "$status" -eq 0 ]
+}
+
 @test "huffman: valgrind" {
     $sptk3/nrand -l 16 > $tmp/1
     run valgrind $sptk4/huffman $tmp/1
@@ -36,6 +36,16 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "huffman_decode: bool-type format" {
+    $sptk3/nrand -l 8 | $sptk4/huffman > $tmp/1
+    $sptk3/nrand -l 100 | $sptk4/sopr -ABS -m 3 -FLOOR |
+        $sptk4/clip -l 0 -u 7 > $tmp/2
+    $sptk3/x2x +di $tmp/2 | $sptk4/huffman_encode -b $tmp/1 |
+        $sptk4/huffman_decode -b $tmp/1 | $sptk3/x2x +id > $tmp/3
+    run $sptk4/aeq $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
 @test "huffman_decode: valgrind" {
     $sptk3/nrand -l 8 | $sptk4/huffman > $tmp/1
     $sptk3/ramp -l 8 | $sptk3/x2x +di | $sptk4/huffman_encode $tmp/1 > $tmp/2
@@ -50,6 +50,16 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "lbg: multithreading" {
+    $sptk3/nrand -s 1 -l 2000 > $tmp/0
+    $sptk4/lbg -l 2 -e 16 $tmp/0 -I $tmp/1.idx > $tmp/1
+    $sptk4/lbg -l 2 -e 16 -j 3 $tmp/0 -I $tmp/2.idx > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+    run cmp $tmp/1.idx $tmp/2.idx
+    [ "$status" -eq 0 ]
+}
+
 @test "lbg: valgrind" {
     $sptk3/nrand -l 512 > $tmp/1
     run valgrind $sptk4/lbg -l 4 -e 8 -i 10 $tmp/1
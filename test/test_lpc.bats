@@ -34,6 +34,28 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "lpc: threads" {
+    $sptk3/x2x +sd asset/data.short |
+        $sptk3/frame -l 400 -p 80 | $sptk3/window -l 400 > $tmp/0
+    $sptk4/lpc -l 400 -m 24 -j 1 $tmp/0 > $tmp/1
+    $sptk4/lpc -l 400 -m 24 -j 4 $tmp/0 > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+
+    # Only the first unstable frame is reported as in the serial processing.
+    $sptk3/nrand -s 1 -l 9000 | $sptk3/sopr -ABS > $tmp/3
+    $sptk3/nrand -s 2 -l 9000 >> $tmp/3
+    run bash -c "$sptk4/lpc -l 16 -m 8 -q 3 -e 2 -j 1 $tmp/3 > $tmp/4"
+    [ "$status" -eq 1 ]
+    [ "${#lines[@]}" -eq 1 ]
+    expected="$output"
+    run bash -c "$sptk4/lpc -l 16 -m 8 -q 3 -e 2 -j 4 $tmp/3 > $tmp/5"
+    [ "$status" -eq 1 ]
+    [ "$output" = "$expected" ]
+    run cmp $tmp/4 $tmp/5
+    [ "$status" -eq 0 ]
+}
+
 @test "lpc: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/lpc -l 10 -m 4 $tmp/1
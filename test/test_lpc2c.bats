@@ -36,6 +36,13 @@ teardown() {
     done
 }
 
+@test "lpc2c: compatibility (multiple blocks)" {
+    $sptk3/nrand -l 5000 | $sptk3/lpc2c -m 9 -M 12 > $tmp/1
+    $sptk3/nrand -l 5000 | $sptk4/lpc2c -m 9 -M 12 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "lpc2c: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/lpc2c -m 9 $tmp/1
@@ -57,6 +57,36 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "lpc2lsp: Newton method" {
+    $sptk3/nrand -l 4000 | $sptk3/lpc -l 400 -m 24 > $tmp/1
+    $sptk4/lpc2lsp -m 24 -n 4096 -i 40 -d 0 $tmp/1 > $tmp/2
+    $sptk4/lpc2lsp -m 24 -a 1 $tmp/1 > $tmp/3
+    run $sptk4/aeq $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
+@test "lpc2lsp: Newton method fallback" {
+    $sptk3/nrand -l 4000 | $sptk3/lpc -l 400 -m 24 > $tmp/1
+    $sptk4/lpc2lsp -m 24 -n 4096 -i 40 -d 0 $tmp/1 > $tmp/2
+    $sptk4/lpc2lsp -m 24 -n 4096 -a 1 -i 1 $tmp/1 > $tmp/3
+    run $sptk4/aeq -t 1e-4 $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
+@test "lpc2lsp: multiple blocks" {
+    $sptk3/nrand -l 30000 | $sptk3/lpc -l 100 -m 9 > $tmp/1
+    for a in 0 1; do
+        $sptk4/lpc2lsp -m 9 -a $a $tmp/1 > $tmp/2
+        rm -f $tmp/3
+        for t in $(seq 0 299); do
+            $sptk4/bcut -s $((t * 10)) -e $((t * 10 + 9)) $tmp/1 |
+                $sptk4/lpc2lsp -m 9 -a $a >> $tmp/3
+        done
+        run cmp $tmp/2 $tmp/3
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "lpc2lsp: valgrind" {
     $sptk3/nrand -l 800 | $sptk3/lpc -l 400 -m 12 > $tmp/1
     run valgrind $sptk4/lpc2lsp -m 12 $tmp/1
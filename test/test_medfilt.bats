@@ -38,6 +38,25 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "medfilt: wide window" {
+    $sptk3/nrand -l 400 -s 2 > $tmp/1
+    cmd="import numpy as np; "
+    cmd+="x = np.fromfile('$tmp/1').reshape(-1, 2); "
+    cmd+="y = [np.median(x[max(0, t - 15):t + 16], axis=0) "
+    cmd+="for t in range(len(x))]; "
+    cmd+="np.array(y).tofile('$tmp/2')"
+    tools/venv/bin/python -c "${cmd}"
+    $sptk4/medfilt -l 2 -k 30 $tmp/1 > $tmp/3
+    run $sptk4/aeq $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
+@test "medfilt: NaN input" {
+    echo 1 2 nan 3 4 | $sptk4/x2x +ad > $tmp/1
+    run $sptk4/medfilt $tmp/1
+    [ "$status" -eq 1 ]
+}
+
 @test "medfilt: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/histogram -l 2 -k 2 $tmp/1
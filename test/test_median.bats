@@ -40,6 +40,12 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "median: NaN input" {
+    echo 1 2 nan 3 4 | $sptk4/x2x +ad > $tmp/1
+    run $sptk4/median $tmp/1
+    [ "$status" -eq 1 ]
+}
+
 @test "median: valgrind" {
     $sptk3/nrand -l 10 > $tmp/1
     run valgrind $sptk4/median $tmp/1
@@ -39,6 +39,15 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "mfcc: threads" {
+    $sptk3/x2x +sd asset/data.short |
+        $sptk3/frame -l 400 -p 80 | $sptk3/window -l 400 -L 512 > $tmp/0
+    $sptk4/mfcc -l 512 -n 20 -m 12 -o 3 -j 1 $tmp/0 > $tmp/1
+    $sptk4/mfcc -l 512 -n 20 -m 12 -o 3 -j 4 $tmp/0 > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "mfcc: valgrind" {
     $sptk3/nrand -l 16 > $tmp/1
     run valgrind $sptk4/mfcc -l 8 -n 4 -m 3 $tmp/1
@@ -42,6 +42,16 @@ teardown() {
     done
 }
 
+@test "mgc2sp: threads" {
+    $sptk3/x2x +sd asset/data.short |
+        $sptk3/frame -l 400 -p 80 | $sptk3/window -l 400 -L 512 > $tmp/0
+    $sptk4/mgcep -l 512 -m 24 -a 0.42 $tmp/0 > $tmp/1
+    $sptk4/mgc2sp -m 24 -a 0.42 -l 512 -j 1 $tmp/1 > $tmp/2
+    $sptk4/mgc2sp -m 24 -a 0.42 -l 512 -j 4 $tmp/1 > $tmp/3
+    run cmp $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
 @test "mgc2sp: valgrind" {
     $sptk3/nrand -l 32 > $tmp/1
     run valgrind $sptk4/mgc2sp -m 15 $tmp/1
@@ -41,6 +41,39 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "mgcep: warm start" {
+    $sptk3/x2x +sd asset/data.short |
+        $sptk3/frame -l 400 -p 80 | $sptk3/window -l 400 -L 512 > $tmp/0
+    $sptk4/mgcep -l 512 -m 24 -a 0.42 $tmp/0 |
+        $sptk4/mgc2sp -l 512 -m 24 -a 0.42 > $tmp/1
+    $sptk4/mgcep -l 512 -m 24 -a 0.42 -w $tmp/0 |
+        $sptk4/mgc2sp -l 512 -m 24 -a 0.42 > $tmp/2
+    run $sptk4/aeq -t 0.1 $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
+@test "mgcep: warm start (g < 0)" {
+    # Both initial guesses converge to the same solution with a small
+    # threshold.
+    $sptk3/x2x +sd asset/data.short |
+        $sptk3/frame -l 400 -p 80 | $sptk3/window -l 400 -L 512 > $tmp/0
+    $sptk4/mgcep -l 512 -m 24 -a 0.42 -g -0.5 -i 100 -d 1e-6 $tmp/0 |
+        $sptk4/mgc2sp -l 512 -m 24 -a 0.42 -g -0.5 > $tmp/1
+    $sptk4/mgcep -l 512 -m 24 -a 0.42 -g -0.5 -i 100 -d 1e-6 -w $tmp/0 |
+        $sptk4/mgc2sp -l 512 -m 24 -a 0.42 -g -0.5 > $tmp/2
+    run $sptk4/aeq -t 0.1 $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
+@test "mgcep: threads" {
+    $sptk3/x2x +sd asset/data.short |
+        $sptk3/frame -l 400 -p 80 | $sptk3/window -l 400 -L 512 > $tmp/0
+    $sptk4/mgcep -l 512 -m 24 -a 0.42 $tmp/0 > $tmp/1
+    $sptk4/mgcep -l 512 -m 24 -a 0.42 --threads 4 $tmp/0 > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "mgcep: valgrind" {
     $sptk3/nrand -l 32 > $tmp/1
     run valgrind $sptk4/mgcep -l 16 -m 4 -i 3 $tmp/1
@@ -55,6 +55,41 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "mlpg: number of past frames" {
+    $sptk3/nrand -s 1 -l 200 > $tmp/1
+    $sptk3/nrand -s 2 -l 200 | $sptk3/sopr -ABS -m 0.01 > $tmp/2
+    $sptk3/merge +d -l 10 -L 10 $tmp/1 $tmp/2 > $tmp/3
+
+    # The output is the same as SPTK3 for any delay. Remove zeros because
+    # SPTK3 does not consider delay.
+    for s in 1 2 5 30 100; do
+        $sptk3/mlpg -l 5 -d -0.5 0 0.5 -s $s $tmp/3 | $sptk3/x2x +da |
+            grep -v ^0$ | $sptk3/x2x +ad > $tmp/4
+        $sptk4/mlpg -l 5 -d -0.5 0 0.5 -s $s $tmp/3 > $tmp/5
+        [ "$($sptk3/x2x +da $tmp/5 | wc -l)" -eq 100 ]
+        run $sptk4/aeq -t 1e-5 -L -e 1 $tmp/4 $tmp/5
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "mlpg: magic number" {
+    $sptk3/nrand -s 1 -l 200 > $tmp/1
+    $sptk3/nrand -s 2 -l 200 | $sptk3/sopr -ABS -m 0.01 > $tmp/2
+    $sptk3/merge +d -l 10 -L 10 $tmp/1 $tmp/2 > $tmp/3
+    $sptk3/bcut +d -l 20 -s 0 -e 4 $tmp/3 > $tmp/3a
+    $sptk3/bcut +d -l 20 -s 5 $tmp/3 > $tmp/3b
+    echo -1e10 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 | $sptk3/x2x +ad > $tmp/4
+
+    # Generate each segment separated by a magic number independently.
+    cat $tmp/3a $tmp/4 $tmp/3b |
+        $sptk4/mlpg -l 5 -d -0.5 0 0.5 -R 1 -magic -1e10 > $tmp/5
+    $sptk4/mlpg -l 5 -d -0.5 0 0.5 -R 1 $tmp/3a > $tmp/6
+    echo -1e10 -1e10 -1e10 -1e10 -1e10 | $sptk3/x2x +ad >> $tmp/6
+    $sptk4/mlpg -l 5 -d -0.5 0 0.5 -R 1 $tmp/3b >> $tmp/6
+    run $sptk4/aeq $tmp/5 $tmp/6
+    [ "$status" -eq 0 ]
+}
+
 @test "mlpg: valgrind" {
     $sptk3/nrand -l 20 | $sptk3/sopr -ABS > $tmp/1
     run valgrind $sptk4/mlpg -l 2 -R 0 $tmp/1
@@ -39,6 +39,26 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "pca: algorithms" {
+    $sptk3/nrand -l 1024 > $tmp/0
+    for a in $(seq 0 2); do
+        $sptk4/pca -l 16 -n 4 -a $a -i 100000 -d 1e-10 -v $tmp/0_$a $tmp/0 |
+            $sptk4/sopr -ABS > $tmp/1_$a
+    done
+    for a in $(seq 1 2); do
+        run $sptk4/aeq $tmp/0_0 $tmp/0_$a
+        [ "$status" -eq 0 ]
+        run $sptk4/aeq $tmp/1_0 $tmp/1_$a
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "pca: empty input" {
+    run $sptk4/pca -l 4 -n 2 /dev/null
+    [ "$status" -eq 0 ]
+    [ -z "$output" ]
+}
+
 @test "pca: valgrind" {
     $sptk3/nrand -l 32 > $tmp/1
     run valgrind $sptk4/pca -l 4 -n 2 $tmp/1
@@ -40,6 +40,47 @@ teardown() {
     done
 }
 
+@test "pitch: long input" {
+    # RAPT processes long input chunk by chunk.
+    $sptk3/x2x +sd $data > $tmp/0
+    cat $tmp/0 $tmp/0 $tmp/0 $tmp/0 > $tmp/1
+    $sptk3/pitch -a 0 $tmp/1 > $tmp/2
+    $sptk4/pitch -a 0 $tmp/1 > $tmp/3
+    run $sptk4/aeq -e 1 -L $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
+@test "pitch: streaming" {
+    # The length of input is not a multiple of the chunk size (16384), and the
+    # last chunk may give no new frames.
+    $sptk3/x2x +sd $data > $tmp/0
+    cat $tmp/0 $tmp/0 $tmp/0 > $tmp/1
+    for e in 32768 32849 50000; do
+        $sptk3/bcut -e "$e" $tmp/1 > $tmp/2
+        $sptk3/pitch -a 0 $tmp/2 > $tmp/3
+        $sptk4/pitch -a 0 $tmp/2 > $tmp/4
+        [ "$(wc -c < $tmp/4)" -eq $(((e + 80) / 80 * 8)) ]
+        run $sptk4/aeq -e 1 -L $tmp/3 $tmp/4
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "pitch: voting" {
+    $sptk3/x2x +sd $data > $tmp/0
+    for a in $(seq 0 3); do
+        $sptk4/pitch -a "$a" -o 2 $tmp/0 > $tmp/0."$a"
+    done
+    for v in 0 2; do
+        $sptk4/merge -l 1 -L 1 $tmp/0.1 < $tmp/0.0 |
+            $sptk4/merge -l 2 -L 1 $tmp/0.2 |
+            $sptk4/merge -l 3 -L 1 $tmp/0.3 |
+            $sptk4/medfilt -l 4 -k "$v" -magic -1e+10 -w 1 > $tmp/1
+        $sptk4/pitch -o 2 -v "$v" -j 2 $tmp/0 > $tmp/2
+        run $sptk4/aeq $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "pitch: valgrind" {
     $sptk3/x2x +sd $data > $tmp/1
     for a in $(seq 0 3); do
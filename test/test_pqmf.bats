@@ -44,6 +44,26 @@ teardown() {
     done
 }
 
+@test "pqmf: compatibility of decimated mode" {
+    $sptk3/x2x +sd $data > $tmp/1
+    for k in 3 4 11; do
+        for m in 49 50; do
+            $sptk4/pqmf -k $k -m $m $tmp/1 |
+                $sptk4/decimate -l $k -p $k > $tmp/2
+            $sptk4/pqmf -k $k -m $m -c $tmp/1 > $tmp/3
+            run $sptk4/aeq $tmp/2 $tmp/3
+            [ "$status" -eq 0 ]
+
+            $sptk4/interpolate -l $k -p $k $tmp/2 |
+                $sptk4/sopr -m $k |
+                $sptk4/ipqmf -k $k -m $m > $tmp/4
+            $sptk4/ipqmf -k $k -m $m -c $tmp/2 > $tmp/5
+            run $sptk4/aeq $tmp/4 $tmp/5
+            [ "$status" -eq 0 ]
+        done
+    done
+}
+
 @test "pqmf: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/pqmf -k 2 -m 10 $tmp/1
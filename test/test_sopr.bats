@@ -74,6 +74,25 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "sopr: fused operations" {
+    $sptk3/nrand -l 10000 > $tmp/0
+    $sptk4/sopr -m 2 -a 1 -s 3 -d 4 -ABS -magic 0 -a 1 -MAGIC 5 $tmp/0 > $tmp/1
+    $sptk4/sopr -m 2 $tmp/0 | $sptk4/sopr -a 1 | $sptk4/sopr -s 3 |
+        $sptk4/sopr -d 4 | $sptk4/sopr -ABS -magic 0 -a 1 -MAGIC 5 > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
+@test "sopr: short reads" {
+    $sptk3/nrand -l 10000 > $tmp/0
+    head -c 1004 $tmp/0 > $tmp/1
+    tail -c +1005 $tmp/0 > $tmp/2
+    { cat $tmp/1; sleep 1; cat $tmp/2; } | $sptk4/sopr -m 2 > $tmp/3
+    $sptk4/sopr -m 2 $tmp/0 > $tmp/4
+    run cmp $tmp/3 $tmp/4
+    [ "$status" -eq 0 ]
+}
+
 @test "sopr: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/sopr -m 2 $tmp/1
@@ -0,0 +1,49 @@
+#!/usr/bin/env bats
+# ------------------------------------------------------------------------ #
+# Copyright 2021 SPTK Working Group                                        #
+#                                                                          #
+# Licensed under the Apache License, Version 2.0 (the "License");          #
+# you may not use this file except in compliance with the License.         #
+# You may obtain a copy of the License at                                  #
+#                                                                          #
+#     http://www.apache.org/licenses/LICENSE-2.0                           #
+#                                                                          #
+# Unless required by applicable law or agreed to in writing, software      #
+# distributed under the License is distributed on an "AS IS" BASIS,        #
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. #
+# See the License for the specific language governing permissions and      #
+# limitations under the License.                                           #
+# ------------------------------------------------------------------------ #
+
+sptk3=tools/sptk/bin
+sptk4=bin
+tmp=test_wav2mgc
+
+setup() {
+    mkdir -p $tmp
+}
+
+teardown() {
+    rm -rf $tmp
+}
+
+@test "wav2mgc: identity" {
+    $sptk3/nrand -l 2000 > $tmp/0
+    for t in 0 1; do
+        for o in 0 3; do
+            $sptk4/frame -l 60 -p 20 -n $t $tmp/0 |
+                $sptk4/window -l 60 -L 64 -w 1 |
+                $sptk4/mgcep -l 64 -m 8 -g -0.5 -o $o > $tmp/1
+            $sptk4/wav2mgc -l 60 -p 20 -t $t -w 1 -L 64 -m 8 -g -0.5 -o $o \
+                -j 3 $tmp/0 > $tmp/2
+            run cmp $tmp/1 $tmp/2
+            [ "$status" -eq 0 ]
+        done
+    done
+}
+
+@test "wav2mgc: valgrind" {
+    $sptk3/nrand -l 200 > $tmp/1
+    run valgrind $sptk4/wav2mgc -l 16 -p 8 -m 4 -i 3 -j 2 $tmp/1
+    [ "$(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/')" -eq 0 ]
+}
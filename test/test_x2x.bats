@@ -44,6 +44,44 @@ teardown() {
     done
 }
 
+@test "x2x: multiple blocks" {
+    $sptk3/nrand -l 10000 | $sptk3/sopr -m 1000 > $tmp/0
+    $sptk4/x2x +di -r $tmp/0 | $sptk4/x2x +ia -c 3 > $tmp/1
+    $sptk4/x2x +di -r $tmp/0 | $sptk4/x2x +ia -c 3 -f %i > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+    $sptk4/x2x +ai $tmp/1 | $sptk4/x2x +id > $tmp/3
+    $sptk4/x2x +di -r $tmp/0 | $sptk4/x2x +id > $tmp/4
+    run cmp $tmp/3 $tmp/4
+    [ "$status" -eq 0 ]
+}
+
+@test "x2x: short reads" {
+    $sptk3/nrand -l 10000 > $tmp/0
+    head -c 1004 $tmp/0 > $tmp/1
+    tail -c +1005 $tmp/0 > $tmp/2
+    { cat $tmp/1; sleep 1; cat $tmp/2; } | $sptk4/x2x +df > $tmp/3
+    $sptk4/x2x +df $tmp/0 > $tmp/4
+    run cmp $tmp/3 $tmp/4
+    [ "$status" -eq 0 ]
+}
+
+@test "x2x: end of stream" {
+    $sptk3/nrand -l 10000 > $tmp/0
+    { cat $tmp/0; printf "abc"; } | $sptk4/x2x +da > $tmp/1
+    $sptk4/x2x +da $tmp/0 > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+    printf "" | $sptk4/x2x +da > $tmp/3
+    [ ! -s $tmp/3 ]
+}
+
+@test "x2x: write error" {
+    $sptk3/nrand -l 10 > $tmp/0
+    run bash -c "$sptk4/x2x +da $tmp/0 > /dev/full"
+    [ "$status" -ne 0 ]
+}
+
 @test "x2x: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/x2x +da $tmp/1
@@ -2416,12 +2416,19 @@ void free_dp_f0(Buffer *buffer)
   buffer->headF = NULL;
   buffer->tailF = NULL;
   
+#if 1
+  /* The statistics are allocated at the first call of dp_f0. */
+  if (buffer->stat != NULL) {
+#endif
   ckfree((void *)buffer->stat->stat);
   ckfree((void *)buffer->stat->rms);
   ckfree((void *)buffer->stat->rms_ratio);
 
   ckfree((void *)buffer->stat);
   buffer->stat = NULL;
+#if 1
+  }
+#endif
 
   ckfree((void *)buffer->mem);
   buffer->mem = NULL;
@@ -2452,6 +2459,31 @@ void free_dp_f0(Buffer *buffer)
 }
 #endif
 
+#if 1
+static void
+set_f0_params(F0_params *par, int frame_shift, double sample_freq,
+              double min_f0, double max_f0, double voice_bias)
+{
+  par->cand_thresh = 0.3f;
+  par->lag_weight = 0.3f;
+  par->freq_weight = 0.02f;
+  par->trans_cost = 0.005f;
+  par->trans_amp = 0.5f;
+  par->trans_spec = 0.5f;
+  par->voice_bias = 0.0f;
+  par->double_cost = 0.35f;
+  par->min_f0 = min_f0;
+  par->max_f0 = max_f0;
+  par->frame_step = (double) frame_shift / sample_freq;
+  par->wind_dur = 0.0075f;
+  par->n_cands = 20;
+  par->mean_f0 = 200;          /* unused */
+  par->mean_f0_weight = 0.0f;  /* unused */
+  par->conditioning = 0;       /* unused */
+  par->voice_bias = voice_bias;
+}
+#endif
+
 int
 #if 0
 cGet_f0(Sound *sound, Tcl_Interp *interp, float **outlist, int *length)
@@ -2533,6 +2565,7 @@ cGet_f0(const std::vector<double> &waveform, int frame_shift,
 #endif
 
   par = (F0_params *) ckalloc(sizeof(F0_params));
+#if 0
   par->cand_thresh = 0.3f;
   par->lag_weight = 0.3f;
   par->freq_weight = 0.02f;
@@ -2541,22 +2574,16 @@ cGet_f0(const std::vector<double> &waveform, int frame_shift,
   par->trans_spec = 0.5f;
   par->voice_bias = 0.0f;
   par->double_cost = 0.35f;
-#if 0
   par->min_f0 = 50;
   par->max_f0 = 550;
   par->frame_step = 0.01f;
-#else
-  par->min_f0 = min_f0;
-  par->max_f0 = max_f0;
-  par->frame_step = (double) frame_shift / sample_freq;
-#endif
   par->wind_dur = 0.0075f;
   par->n_cands = 20;
   par->mean_f0 = 200;          /* unused */
   par->mean_f0_weight = 0.0f;  /* unused */
   par->conditioning = 0;       /* unused */
-#if 1
-  par->voice_bias = voice_bias;
+#else
+  set_f0_params(par, frame_shift, sample_freq, min_f0, max_f0, voice_bias);
 #endif
 
   if (startpos < 0) startpos = 0;
@@ -2702,6 +2729,129 @@ cGet_f0(const std::vector<double> &waveform, int frame_shift,
 #endif
 }
 
+#if 1
+/*
+ * Streaming version of cGet_f0. The input samples are given chunk by chunk,
+ * and only the samples which have not been consumed by dp_f0 yet are kept.
+ * The consumed samples are skipped by an offset and dropped at once when
+ * they exceed the buffer size, so that each sample is moved only a few times.
+ * The frames are output as soon as dp_f0 finalizes them. The result is the
+ * same as that of cGet_f0.
+ */
+struct f0_stream {
+  f0_stream() : generator(1) {
+  }
+
+  sptk::NormalDistributedRandomValueGeneration generator;
+  F0_params par;
+  Buffer buffer;
+  double sf;
+  long buff_size, sdstep, total_samps, start;
+  int done;
+  std::vector<float> samples;
+  std::vector<float> fdata;
+};
+
+F0_stream *
+cGet_f0_open(int frame_shift, double sample_freq, double min_f0,
+             double max_f0, double voice_bias)
+{
+  F0_stream *stream = new F0_stream;
+  memset(&stream->buffer, 0, sizeof(Buffer));
+  stream->buffer.first_time = 1;
+  stream->buffer.ncoeff = 127;
+  stream->sf = sample_freq;
+  stream->total_samps = 0;
+  stream->start = 0;
+  stream->done = 0;
+
+  set_f0_params(&stream->par, frame_shift, sample_freq, min_f0, max_f0,
+                voice_bias);
+  if (check_f0_params(&stream->par, stream->sf) ||
+      init_dp_f0(stream->sf, &stream->par, &stream->buff_size,
+                 &stream->sdstep, &stream->buffer) ||
+      stream->buff_size > INT_MAX || stream->sdstep > INT_MAX) {
+    cGet_f0_close(stream);
+    return NULL;
+  }
+  stream->fdata.resize(std::max(stream->buff_size, stream->sdstep));
+
+  return stream;
+}
+
+int
+cGet_f0_write(F0_stream *stream, const std::vector<double> &waveform,
+              int last_time, std::vector<float> *f0)
+{
+  float *f0p, *vuvp, *rms_speech, *acpkp;
+  double noise, noise_sdev = 50.0;
+  int i, vecsize;
+  long actsize, num_samps;
+
+  if (stream == NULL || f0 == NULL || stream->done) {
+    return 1;
+  }
+  f0->clear();
+
+  /* Add noise to robustly estimate F0 values. */
+  for (i = 0; i < (int) waveform.size(); i++) {
+    if (!stream->generator.Get(&noise)) return 1;
+    stream->samples.push_back(waveform[i] + noise * noise_sdev);
+  }
+  stream->total_samps += (long) waveform.size();
+
+  if (last_time) {
+    if (stream->total_samps == 0) {
+      stream->done = 1;
+      return 0;
+    }
+    if (stream->total_samps <
+        ((stream->par.frame_step * 2.0) + stream->par.wind_dur) * stream->sf) {
+      return 1;
+    }
+  }
+
+  /* Wait for the next chunk unless the frames can be finalized. */
+  num_samps = (long) stream->samples.size() - stream->start;
+  while (last_time || num_samps > stream->buff_size) {
+    actsize = std::min(stream->buff_size, num_samps);
+    stream->done = (num_samps <= stream->buff_size);
+    for (i = 0; i < actsize; i++) {
+      stream->fdata[i] = stream->samples[stream->start + i];
+    }
+    if (dp_f0(&(stream->fdata[0]), (int) actsize, (int) stream->sdstep,
+              stream->sf, &stream->par, &f0p, &vuvp, &rms_speech, &acpkp,
+              &vecsize, stream->done, &stream->buffer)) {
+      return 1;
+    }
+    for (i = vecsize - 1; i >= 0; i--) {
+      f0->push_back(f0p[i]);
+    }
+
+    if (stream->done) break;
+
+    stream->start += stream->sdstep;
+    num_samps -= stream->sdstep;
+  }
+
+  if (stream->start > stream->buff_size) {
+    stream->samples.erase(stream->samples.begin(),
+                          stream->samples.begin() + stream->start);
+    stream->start = 0;
+  }
+
+  return 0;
+}
+
+void
+cGet_f0_close(F0_stream *stream)
+{
+  if (stream == NULL) return;
+  free_dp_f0(&stream->buffer);
+  delete stream;
+}
+#endif
+
 #if 1
 }  /* namespace snack */
 }  /* namespace sptk */
@@ -142,6 +142,12 @@ void ckfree(void* ptr);
 int cGet_f0(const std::vector<double> &waveform, int frame_shift,
             double sample_freq, double min_f0, double max_f0, double voice_bias,
             float **outlist, int *length);
+typedef struct f0_stream F0_stream;
+F0_stream *cGet_f0_open(int frame_shift, double sample_freq, double min_f0,
+                        double max_f0, double voice_bias);
+int cGet_f0_write(F0_stream *stream, const std::vector<double> &waveform,
+                  int last_time, std::vector<float> *f0);
+void cGet_f0_close(F0_stream *stream);
 #endif
 
 #if 1
@@ -0,0 +1,90 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <chrono>    // std::chrono
+#include <cmath>     // std::log2
+#include <cstdlib>   // std::atoi, std::rand, std::srand
+#include <iomanip>   // std::setprecision
+#include <iostream>  // std::cerr, std::cout, std::endl
+#include <vector>    // std::vector
+
+#include "SPTK/math/fourier_transform.h"
+
+/**
+ * Measure the throughput of the complex Fourier transform for one length.
+ *
+ * Usage: fft_throughput fft_length [num_iteration]
+ *
+ * A power of two is transformed by the radix-4 FFT and the other lengths by
+ * the mixed-radix FFT. The output is the length, the average time in
+ * microseconds per transform, and the speed in MFLOPS estimated by
+ * 5 L log2(L).
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "usage: fft_throughput fft_length [num_iteration]"
+              << std::endl;
+    return 1;
+  }
+  const int fft_length(std::atoi(argv[1]));
+  const int num_iteration(3 <= argc ? std::atoi(argv[2]) : 10000);
+
+  sptk::FourierTransform fourier_transform(fft_length);
+  sptk::FourierTransform::Buffer buffer;
+  if (!fourier_transform.IsValid() || num_iteration <= 0) {
+    std::cerr << "Failed to initialize" << std::endl;
+    return 1;
+  }
+
+  std::vector<double> real_part_input(fft_length);
+  std::vector<double> imag_part_input(fft_length);
+  std::srand(1);
+  for (int i(0); i < fft_length; ++i) {
+    real_part_input[i] = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+    imag_part_input[i] = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+
+  // Warm up and allocate the buffer.
+  std::vector<double> real_part_output(fft_length);
+  std::vector<double> imag_part_output(fft_length);
+  if (!fourier_transform.Run(real_part_input, imag_part_input,
+                             &real_part_output, &imag_part_output, &buffer)) {
+    std::cerr << "Failed to run" << std::endl;
+    return 1;
+  }
+
+  double sum(0.0);
+  const std::chrono::steady_clock::time_point start(
+      std::chrono::steady_clock::now());
+  for (int n(0); n < num_iteration; ++n) {
+    fourier_transform.Run(real_part_input, imag_part_input, &real_part_output,
+                          &imag_part_output, &buffer);
+    sum += real_part_output[0];
+  }
+  const std::chrono::steady_clock::time_point end(
+      std::chrono::steady_clock::now());
+
+  const double elapsed_us(
+      std::chrono::duration<double, std::micro>(end - start).count() /
+      num_iteration);
+  const double mflops(5.0 * fft_length * std::log2(fft_length) / elapsed_us);
+  std::cout << fft_length << " " << std::fixed << std::setprecision(3)
+            << elapsed_us << " " << std::setprecision(1) << mflops
+            << std::endl;
+
+  // Keep the output from being optimized away.
+  return (sum != sum) ? 1 : 0;
+}
@@ -0,0 +1,41 @@
+#!/bin/bash
+# ------------------------------------------------------------------------ #
+# Copyright 2021 SPTK Working Group                                        #
+#                                                                          #
+# Licensed under the Apache License, Version 2.0 (the "License");          #
+# you may not use this file except in compliance with the License.         #
+# You may obtain a copy of the License at                                  #
+#                                                                          #
+#     http://www.apache.org/licenses/LICENSE-2.0                           #
+#                                                                          #
+# Unless required by applicable law or agreed to in writing, software      #
+# distributed under the License is distributed on an "AS IS" BASIS,        #
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. #
+# See the License for the specific language governing permissions and      #
+# limitations under the License.                                           #
+# ------------------------------------------------------------------------ #
+
+# Print the time per transform and the speed of the complex FFT for powers of
+# two and mixed-radix lengths. Run this after "make" in the top directory, or
+# give the directory containing libsptk.a. To compare two versions, run this
+# on each checkout.
+
+set -euo pipefail
+
+cd "$(dirname "$0")"
+
+root=../..
+libdir=${1:-$root/lib}
+work=$(mktemp -d)
+trap 'rm -rf $work' EXIT
+
+${CXX:-g++} -std=c++11 -O2 -I$root/include fft_throughput.cc \
+    "$libdir"/libsptk.a -lpthread -o "$work"/fft_throughput
+
+echo "fft_length time_per_transform_us mflops"
+for l in 8 16 32 64 128 256 512 1024 2048 4096 8192; do
+    "$work"/fft_throughput "$l" $((4000000 / l))
+done
+for l in 12 60 100 240 480 1000 1536 3000 6000; do
+    "$work"/fft_throughput "$l" $((4000000 / l))
+done
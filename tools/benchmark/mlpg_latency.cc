@@ -0,0 +1,89 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <chrono>    // std::chrono
+#include <cstdlib>   // std::atoi, std::rand, std::srand
+#include <iomanip>   // std::setprecision
+#include <iostream>  // std::cerr, std::cout, std::endl
+#include <vector>    // std::vector
+
+#include "SPTK/generation/recursive_maximum_likelihood_parameter_generation.h"
+#include "SPTK/input/input_source_from_vector.h"
+
+/**
+ * Measure the average time to generate one frame by recursive MLPG.
+ *
+ * Usage: mlpg_latency num_past_frame [num_order [num_frame]]
+ *
+ * The input is random static, delta and delta-delta parameters. The frames
+ * are read through an input source, which is supported by both the old and
+ * the new implementations.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "usage: mlpg_latency num_past_frame [num_order [num_frame]]"
+              << std::endl;
+    return 1;
+  }
+  const int num_past_frame(std::atoi(argv[1]));
+  const int num_order(3 <= argc ? std::atoi(argv[2]) : 24);
+  const int num_frame(4 <= argc ? std::atoi(argv[3]) : 20000);
+
+  std::vector<std::vector<double> > window_coefficients(2);
+  window_coefficients[0] = {-0.5, 0.0, 0.5};
+  window_coefficients[1] = {1.0, -2.0, 1.0};
+
+  const int length(num_order + 1);
+  const int read_size(2 * length * 3);
+  std::vector<double> data(static_cast<std::size_t>(read_size) * num_frame);
+  std::srand(1);
+  for (int t(0); t < num_frame; ++t) {
+    for (int i(0); i < 3 * length; ++i) {
+      const int index(t * read_size + i);
+      data[index] = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+      data[index + 3 * length] = 0.01 + static_cast<double>(std::rand()) /
+                                            RAND_MAX;
+    }
+  }
+
+  sptk::InputSourceFromVector input_source(false, read_size, &data);
+  sptk::RecursiveMaximumLikelihoodParameterGeneration generation(
+      num_order, num_past_frame, window_coefficients, &input_source);
+  if (!generation.IsValid()) {
+    std::cerr << "Failed to initialize" << std::endl;
+    return 1;
+  }
+
+  std::vector<double> smoothed_static_parameters(length);
+  double sum(0.0);
+  int num_output(0);
+  const std::chrono::steady_clock::time_point start(
+      std::chrono::steady_clock::now());
+  while (generation.Get(&smoothed_static_parameters)) {
+    sum += smoothed_static_parameters[0];
+    ++num_output;
+  }
+  const std::chrono::steady_clock::time_point end(
+      std::chrono::steady_clock::now());
+
+  const double elapsed_us(
+      std::chrono::duration<double, std::micro>(end - start).count());
+  std::cout << num_past_frame << " " << std::fixed << std::setprecision(1)
+            << elapsed_us / num_output << std::endl;
+
+  // Keep the output from being optimized away.
+  return (sum != sum) ? 1 : 0;
+}
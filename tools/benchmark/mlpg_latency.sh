@@ -0,0 +1,38 @@
+#!/bin/bash
+# ------------------------------------------------------------------------ #
+# Copyright 2021 SPTK Working Group                                        #
+#                                                                          #
+# Licensed under the Apache License, Version 2.0 (the "License");          #
+# you may not use this file except in compliance with the License.         #
+# You may obtain a copy of the License at                                  #
+#                                                                          #
+#     http://www.apache.org/licenses/LICENSE-2.0                           #
+#                                                                          #
+# Unless required by applicable law or agreed to in writing, software      #
+# distributed under the License is distributed on an "AS IS" BASIS,        #
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. #
+# See the License for the specific language governing permissions and      #
+# limitations under the License.                                           #
+# ------------------------------------------------------------------------ #
+
+# Print the average time in microseconds per frame of recursive MLPG for
+# several numbers of past frames. Run this after "make" in the top directory,
+# or give the directory containing libsptk.a. To compare two versions, run
+# this on each checkout.
+
+set -euo pipefail
+
+cd "$(dirname "$0")"
+
+root=../..
+libdir=${1:-$root/lib}
+work=$(mktemp -d)
+trap 'rm -rf $work' EXIT
+
+${CXX:-g++} -std=c++11 -O2 -I$root/include mlpg_latency.cc \
+    "$libdir"/libsptk.a -lpthread -o "$work"/mlpg_latency
+
+echo "past_frames time_per_frame_us"
+for s in 5 10 20 30 60 100; do
+    "$work"/mlpg_latency "$s" 24
+done